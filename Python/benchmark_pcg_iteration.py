@@ -0,0 +1,128 @@
+"""
+Benchmark PCG parameter-tweak iteration time: full rebuild vs incremental regeneration.
+
+Point it at a level actor whose PCGComponent runs a large scattering graph
+(e.g. a landscape surface sampler feeding a static mesh spawner) and at one
+of that graph's user parameters. For each value the script sets the
+parameter, regenerates, and waits for the generation job to finish, once in
+"full" mode (CleanupLocal + forced generate, the old generate_pcg behaviour)
+and once in "incremental" mode.
+
+Run with:
+    uv run python benchmark_pcg_iteration.py <actor_name> <graph_path> <param_name> <value> [<value> ...]
+
+Example:
+    uv run python benchmark_pcg_iteration.py PCG_Forest /Game/PCG/PCG_ForestScatter Density 0.5 0.6 0.7 0.8
+
+The parameter is left at the last value. Run in a test level.
+"""
+import os
+import statistics
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(__file__))
+
+from unreal_mcp_server_advanced import UnrealConnection
+from helpers.pcg_graph import parameter_manager
+
+WAIT_TIMEOUT_SECONDS = 600
+REPEATS_PER_VALUE = 2
+
+
+def parse_value(text):
+    """Interpret a command-line value as bool, int, float or string."""
+    if text.lower() in ("true", "false"):
+        return text.lower() == "true"
+    for cast in (int, float):
+        try:
+            return cast(text)
+        except ValueError:
+            pass
+    return text
+
+
+def unwrap(response):
+    """Bridge responses wrap the command result in {"status", "result"}."""
+    if isinstance(response, dict):
+        return response.get("result", response)
+    return response or {}
+
+
+def run_generation(conn, actor_name, mode):
+    """Generate and wait; returns the final job status."""
+    started = unwrap(parameter_manager.generate_pcg(conn, actor_name, mode))
+    job_id = started.get("job_id")
+    if not job_id:
+        raise RuntimeError(f"generate_pcg failed: {started}")
+    return parameter_manager.wait_pcg_generation(conn, job_id, WAIT_TIMEOUT_SECONDS)
+
+
+def benchmark_mode(conn, actor_name, graph_path, param_name, values, mode):
+    """Returns wall times as two series: runs after a value change, and no-change repeats."""
+    timings = {"changed": [], "repeat": []}
+    for value in values:
+        for repeat in range(REPEATS_PER_VALUE):
+            # The second repeat measures a no-change regenerate
+            if repeat == 0:
+                parameter_manager.set_pcg_graph_parameter(conn, graph_path, param_name, value)
+
+            request_start = time.monotonic()
+            status = run_generation(conn, actor_name, mode)
+            round_trip_ms = (time.monotonic() - request_start) * 1000.0
+
+            if status.get("timed_out") or status.get("state") != "completed":
+                print(f"  [{mode}] {param_name}={value}: {status.get('state')} {status.get('message', '')}")
+                continue
+
+            timings["changed" if repeat == 0 else "repeat"].append(status.get("wall_time_ms", 0.0))
+            print(f"  [{mode}] {param_name}={value} run {repeat + 1}: "
+                  f"wall {status.get('wall_time_ms', 0.0):8.1f} ms, round trip {round_trip_ms:8.1f} ms, "
+                  f"points {status.get('point_count', 0)}, instances {status.get('instance_count', 0)}"
+                  f"{' (skipped)' if status.get('skipped') else ''}")
+    return timings
+
+
+def summarize(label, timings):
+    if not timings:
+        print(f"{label:24s} no completed runs")
+        return
+    print(f"{label:24s} runs {len(timings):3d}   median {statistics.median(timings):8.1f} ms   "
+          f"min {min(timings):8.1f} ms   max {max(timings):8.1f} ms")
+
+
+def main():
+    if len(sys.argv) < 5:
+        print(__doc__)
+        sys.exit(1)
+
+    actor_name, graph_path, param_name = sys.argv[1:4]
+    values = [parse_value(v) for v in sys.argv[4:]]
+
+    conn = UnrealConnection()
+
+    # Warm-up so both modes start from a generated component
+    print(f"Warm-up generation on '{actor_name}'...")
+    run_generation(conn, actor_name, "full")
+
+    results = {}
+    for mode in ("full", "incremental"):
+        print(f"\nMode: {mode}")
+        results[mode] = benchmark_mode(conn, actor_name, graph_path, param_name, values, mode)
+
+    # Changed values and no-change repeats are reported apart: a skipped repeat costs almost
+    # nothing, so pooling them would overstate the incremental speedup on real tweaks
+    print("\nParameter-tweak iteration time (generation wall time)")
+    for series in ("changed", "repeat"):
+        for mode, timings in results.items():
+            summarize(f"{mode} ({series})", timings[series])
+
+    for series, title in (("changed", "after a value change"), ("repeat", "on a no-change repeat")):
+        full, incremental = results["full"][series], results["incremental"][series]
+        if full and incremental:
+            speedup = statistics.median(full) / max(statistics.median(incremental), 0.001)
+            print(f"Incremental speedup {title} (median): {speedup:.1f}x")
+
+
+if __name__ == "__main__":
+    main()
@@ -1,7 +1,7 @@
 """
 Filename: material_graph.py
 Description: Python wrappers for material graph creation and editing commands.
-Includes 7 thin wrappers for individual C++ commands and 1 compound helper
+Includes thin wrappers for individual C++ commands and 1 compound helper
 that builds a complete height-blended landscape material from texture sets.
 """
 
@@ -261,27 +261,36 @@ def set_landscape_material(
 
 def compile_material(
     unreal_connection,
-    material_path: str
+    material_path: str,
+    wait: bool = False,
+    save: bool = False
 ) -> Dict[str, Any]:
     """
-    Recompile and save a material.
+    Start recompiling a material. Shaders compile in the background; the
+    returned job_id can be polled with get_material_compile_status.
 
     Args:
         unreal_connection: Connection to Unreal Engine
         material_path: Content path to the material
+        wait: Block the editor until the shaders are compiled
+        save: Save the material package after starting the compile
 
     Returns:
-        Dictionary with success status and message
+        Dictionary with job_id, state, done, compile_time_ms and, once done,
+        errors and per-platform shader statistics
     """
     try:
         response = unreal_connection.send_command("compile_material", {
-            "material_path": material_path
+            "material_path": material_path,
+            "wait": wait,
+            "save": save
         })
 
-        if response.get("success"):
-            logger.info(f"Compiled material at '{material_path}'")
+        result = response.get("result", response) if isinstance(response, dict) else {}
+        if result.get("success"):
+            logger.info(f"Started compile of material at '{material_path}' (job {result.get('job_id', '?')})")
         else:
-            logger.error(f"Failed to compile material: {response.get('error', 'Unknown error')}")
+            logger.error(f"Failed to compile material: {result.get('error', 'Unknown error')}")
 
         return response
 
@@ -290,6 +299,229 @@ def compile_material(
         return {"success": False, "error": str(e)}
 
 
+def get_material_compile_status(
+    unreal_connection,
+    job_id: str
+) -> Dict[str, Any]:
+    """
+    Get the state of a material compile job.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        job_id: Job handle returned by compile_material
+
+    Returns:
+        Dictionary containing:
+            - state (str): compiling, completed, failed or cancelled
+            - done (bool): Whether the job reached a terminal state
+            - compile_time_ms (float): Time since the request (or total time once done)
+            - shader_jobs_remaining (int): Shader compiler backlog while compiling
+            - errors (list): Compile errors, once done
+            - platforms (list): Shader platform with instruction and sampler counts, once done
+    """
+    try:
+        return unreal_connection.send_command("get_material_compile_status", {"job_id": job_id})
+
+    except Exception as e:
+        logger.error(f"Exception in get_material_compile_status: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def wait_material_compile(
+    unreal_connection,
+    job_id: str,
+    timeout_seconds: float = 120.0,
+    poll_interval: float = 0.1
+) -> Dict[str, Any]:
+    """
+    Wait until a material compile job finishes or the timeout expires.
+
+    Polls from this side so the editor keeps ticking the shader compiler while we wait.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        job_id: Job handle returned by compile_material
+        timeout_seconds: Maximum time to wait
+        poll_interval: Delay between status requests
+
+    Returns:
+        The final status, with timed_out set if it was still compiling
+    """
+    deadline = time.monotonic() + timeout_seconds
+
+    while True:
+        response = get_material_compile_status(unreal_connection, job_id)
+        if not response:
+            return {"success": False, "error": "No response from Unreal"}
+
+        # Bridge responses wrap the command result in {"status", "result"}
+        status = response.get("result", response) if isinstance(response, dict) else response
+        if response.get("status") == "error" or status.get("success") is False:
+            return status
+
+        if status.get("done"):
+            return status
+        if time.monotonic() >= deadline:
+            status["timed_out"] = True
+            logger.warning(f"Timed out waiting for material compile '{job_id}' after {timeout_seconds}s")
+            return status
+
+        time.sleep(poll_interval)
+
+
+def save_materials(
+    unreal_connection,
+    material_paths: List[str],
+    only_dirty: bool = True
+) -> Dict[str, Any]:
+    """
+    Save one or more material packages in a single request.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        material_paths: Content paths of the materials to save
+        only_dirty: Skip packages with no unsaved changes
+
+    Returns:
+        Dictionary with saved, skipped and failed path lists
+    """
+    try:
+        response = unreal_connection.send_command("save_materials", {
+            "material_paths": material_paths,
+            "only_dirty": only_dirty
+        })
+
+        result = response.get("result", response) if isinstance(response, dict) else {}
+        if result.get("success"):
+            logger.info(f"Saved {len(result.get('saved', []))} material(s)")
+        else:
+            logger.error(f"Failed to save materials: {result.get('error', 'Unknown error')}")
+
+        return response
+
+    except Exception as e:
+        logger.error(f"Exception in save_materials: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def apply_material_variant(
+    unreal_connection,
+    parent_material: str,
+    parameters: Dict[str, Any],
+    targets: List[Any],
+    material_slot: int = 0,
+    mode: str = "constant",
+    asset_folder: str = "/Game/MCP/MaterialVariants",
+    save: bool = True
+) -> Dict[str, Any]:
+    """
+    Apply a cached material variant to many actors in one request.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        parent_material: Content path of the base material
+        parameters: {name: [r, g, b(, a)] | number | texture path}
+        targets: Actor names/labels, or dicts with actor_name, component_name, material_slot
+        material_slot: Slot for targets that do not set one
+        mode: "constant", "dynamic" or "shared_dynamic"
+        asset_folder: Folder for constant variants
+        save: Save the constant variant if it was created or repaired
+
+    Returns:
+        Dictionary with variant_path, created, applied_components and missing_actors
+    """
+    try:
+        response = unreal_connection.send_command("apply_material_variant", {
+            "parent_material": parent_material,
+            "parameters": parameters,
+            "targets": targets,
+            "material_slot": material_slot,
+            "mode": mode,
+            "asset_folder": asset_folder,
+            "save": save
+        })
+
+        result = response.get("result", response) if isinstance(response, dict) else {}
+        if result.get("success"):
+            logger.info(f"Applied variant {result.get('variant_path')} to {result.get('applied_components', 0)} component(s)")
+        else:
+            logger.error(f"Failed to apply material variant: {result.get('error', 'Unknown error')}")
+
+        return response
+
+    except Exception as e:
+        logger.error(f"Exception in apply_material_variant: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def build_material_graph(
+    unreal_connection,
+    material_path: str,
+    nodes: List[Dict[str, Any]],
+    links: Optional[List[Dict[str, Any]]] = None,
+    outputs: Optional[List[Dict[str, Any]]] = None,
+    two_sided: Optional[bool] = None,
+    create_if_missing: bool = True,
+    clear_existing: bool = False,
+    recompile: bool = True,
+    save: bool = True,
+    wait: bool = False
+) -> Dict[str, Any]:
+    """
+    Build a whole material expression graph in one request.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        material_path: Content path to the material (created if missing)
+        nodes: Node dicts with node_name, expression_class, optional pos_x/pos_y
+            and params ({param_name: param_value}, as in set_material_expression_param)
+        links: Link dicts with from_expression, to_expression, from_output_index, to_input_index
+        outputs: Output dicts with expression_name, material_property, output_index
+        two_sided: Set the material's two-sided flag when given
+        create_if_missing: Create the material if it does not exist
+        clear_existing: Delete existing expressions before building
+        recompile: Compile once after the graph is built
+        save: Save the material package (skipped when any graph element failed)
+        wait: Block until shaders finish and report stats; otherwise poll job_id
+            with get_material_compile_status
+
+    Returns:
+        Dictionary with node/link/output counts, nodes, errors, job_id and,
+        when waited, compile_time_ms and stats
+    """
+    try:
+        params: Dict[str, Any] = {
+            "material_path": material_path,
+            "nodes": nodes,
+            "links": links or [],
+            "outputs": outputs or [],
+            "create_if_missing": create_if_missing,
+            "clear_existing": clear_existing,
+            "compile": recompile,
+            "save": save,
+            "wait": wait
+        }
+        if two_sided is not None:
+            params["two_sided"] = two_sided
+
+        response = unreal_connection.send_command("build_material_graph", params)
+
+        result = response.get("result", response) if isinstance(response, dict) else {}
+        if result.get("success"):
+            logger.info(
+                f"Built material graph at '{material_path}': {result.get('node_count', 0)} nodes, "
+                f"{result.get('link_count', 0)} links, {result.get('output_count', 0)} outputs"
+            )
+        else:
+            logger.error(f"Failed to build material graph: {result.get('error', 'Unknown error')}")
+
+        return response
+
+    except Exception as e:
+        logger.error(f"Exception in build_material_graph: {e}")
+        return {"success": False, "error": str(e)}
+
+
 # ============================================================================
 # Compound helper: Build height-blended landscape material
 # ============================================================================
@@ -477,8 +709,12 @@ def create_landscape_height_material(
         _send(connect_material_to_output, mat_full_path, "LerpORM", "Roughness", 2, step_name="output_roughness")
         _send(connect_material_to_output, mat_full_path, "LerpORM", "Metallic", 3, step_name="output_metallic")
 
-        # Step 8: Compile
-        _send(compile_material, mat_full_path, step_name="compile")
+        # Step 8: Compile, then save once the shaders are done
+        compile_response = _send(compile_material, mat_full_path, step_name="compile")
+        compile_status = compile_response.get("result", compile_response) if isinstance(compile_response, dict) else {}
+        if compile_status.get("job_id") and not compile_status.get("done"):
+            wait_material_compile(unreal_connection, compile_status["job_id"])
+        _send(save_materials, [mat_full_path], step_name="save")
 
         # Step 9: Assign to landscape if requested
         if landscape_actor:
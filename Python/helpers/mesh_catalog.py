@@ -0,0 +1,135 @@
+"""
+Filename: mesh_catalog.py
+Description: Python wrappers for the editor's native mesh catalog index
+"""
+
+import logging
+import os
+from typing import Dict, Any, List, Optional
+
+logger = logging.getLogger("MeshCatalog")
+
+# Catalogs directory (sibling of helpers/)
+CATALOGS_DIR = os.path.join(os.path.dirname(os.path.dirname(__file__)), "catalogs")
+
+
+def _catalog_params(catalog_name: str, root_path: str = "") -> Dict[str, Any]:
+    """Identify a catalog: its sidecar name, curated JSON overlay and content root."""
+    params: Dict[str, Any] = {"catalog": catalog_name}
+    overlay_file = os.path.join(CATALOGS_DIR, f"{catalog_name}.json")
+    if os.path.isfile(overlay_file):
+        params["overlay_file"] = os.path.abspath(overlay_file)
+    if root_path:
+        params["root_path"] = root_path
+    return params
+
+
+def query_catalog(
+    unreal_connection,
+    catalog_name: str = "modularscifi_meshes",
+    query: str = "",
+    text_fields: str = "name",
+    category: str = "",
+    tags: Optional[List[str]] = None,
+    socket_types: Optional[List[str]] = None,
+    min_size_cm: Optional[List[Optional[float]]] = None,
+    max_size_cm: Optional[List[Optional[float]]] = None,
+    has_bounds: bool = False,
+    offset: int = 0,
+    limit: int = 0,
+    root_path: str = "",
+    rebuild: bool = False
+) -> Dict[str, Any]:
+    """
+    Query the native catalog index in the editor.
+
+    The index is built from asset registry data (sizes come from the ApproxSize tag,
+    so meshes are not loaded) overlaid with the catalog JSON, persisted as a binary
+    sidecar and kept current from asset add/remove/rename events.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        catalog_name: Catalog name; catalogs/<name>.json is used as the overlay
+        query: Case-insensitive substring
+        text_fields: "name" or "all" (name, display_name, description, function)
+        category: Exact category
+        tags: Require all of these tags (catalog tags and style tags)
+        socket_types: Require all of these socket types
+        min_size_cm, max_size_cm: [x, y, z] size range; None components are ignored
+        has_bounds: Only meshes with a known size
+        offset, limit: Page of results (limit 0 = all)
+        root_path: Content path to index (default: the overlay's base_path)
+        rebuild: Discard the index and sidecar and rebuild
+
+    Returns:
+        Dictionary with meshes, result_count, total_matches and timings
+    """
+    try:
+        params = _catalog_params(catalog_name, root_path)
+        params.update({
+            "query": query,
+            "text_fields": text_fields,
+            "category": category,
+            "has_bounds": has_bounds,
+            "offset": offset,
+            "limit": limit,
+            "rebuild": rebuild
+        })
+        if tags:
+            params["tags"] = tags
+        if socket_types:
+            params["socket_types"] = socket_types
+        if min_size_cm:
+            params["min_size_cm"] = min_size_cm
+        if max_size_cm:
+            params["max_size_cm"] = max_size_cm
+
+        return unreal_connection.send_command("query_mesh_catalog", params)
+
+    except Exception as e:
+        logger.error(f"Exception in query_catalog: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def get_catalog_info(
+    unreal_connection,
+    catalog_name: str = "modularscifi_meshes",
+    root_path: str = "",
+    rebuild: bool = False
+) -> Dict[str, Any]:
+    """
+    Get category counts and index statistics for a catalog.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        catalog_name: Catalog name; catalogs/<name>.json is used as the overlay
+        root_path: Content path to index (default: the overlay's base_path)
+        rebuild: Discard the index and sidecar and rebuild
+
+    Returns:
+        Dictionary with asset_pack, total_meshes, categories, descriptions and index details
+    """
+    try:
+        params = _catalog_params(catalog_name, root_path)
+        params["rebuild"] = rebuild
+        return unreal_connection.send_command("get_mesh_catalog_info", params)
+
+    except Exception as e:
+        logger.error(f"Exception in get_catalog_info: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def unwrap(response: Dict[str, Any]) -> Optional[Dict[str, Any]]:
+    """
+    Unwrap a bridge response.
+
+    Returns:
+        The result dictionary, or None if the command failed (callers fall back to the JSON catalog)
+    """
+    if not response:
+        return None
+    result = response.get("result", response) if isinstance(response, dict) else None
+    if not isinstance(result, dict) or response.get("status") == "error" or result.get("success") is False:
+        logger.warning(f"Native catalog unavailable: {response.get('error') or (result or {}).get('error', 'unknown error')}")
+        return None
+    return result
@@ -9,5 +9,6 @@ from . import node_connector
 from . import node_properties
 from . import parameter_manager
 from . import spawner_entries
+from . import output_reader
 
-__all__ = ['graph_creator', 'node_manager', 'node_connector', 'node_properties', 'parameter_manager', 'spawner_entries']
+__all__ = ['graph_creator', 'node_manager', 'node_connector', 'node_properties', 'parameter_manager', 'spawner_entries', 'output_reader']
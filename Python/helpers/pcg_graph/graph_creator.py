@@ -4,7 +4,7 @@ Description: Python wrapper for PCG graph creation and reading
 """
 
 import logging
-from typing import Dict, Any, Optional
+from typing import Dict, Any, List, Optional
 
 logger = logging.getLogger("PCGGraph.GraphCreator")
 
@@ -84,3 +84,61 @@ def read_pcg_graph(
     except Exception as e:
         logger.error(f"Exception in read_pcg_graph: {e}")
         return {"success": False, "error": str(e)}
+
+
+def build_pcg_graph(
+    unreal_connection,
+    nodes: List[Dict[str, Any]],
+    edges: Optional[List[Dict[str, Any]]] = None,
+    graph_path: Optional[str] = None,
+    graph_name: Optional[str] = None,
+    path: str = "/Game/PCG",
+    clear_existing: bool = False
+) -> Dict[str, Any]:
+    """
+    Build a whole PCG graph (nodes, properties, edges) in one command.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        nodes: Node specs with name, node_type, optional pos_x/pos_y and properties
+        edges: Edge specs with from, to, optional from_pin/to_pin
+        graph_path: Existing graph to build into
+        graph_name: Name of a new graph to create when graph_path is not given
+        path: Content path for a new graph (default: /Game/PCG)
+        clear_existing: Remove all nodes except Input/Output first
+
+    Returns:
+        Dictionary containing:
+            - success (bool): Whether every node, property and edge was applied
+            - graph_path (str): Graph that was built
+            - node_map (dict): Spec name -> node id
+            - nodes_created, edges_created, properties_set (int): Counts
+            - errors (list): Per-item problems that were skipped
+            - error (str): Error message if failed
+    """
+    try:
+        params: Dict[str, Any] = {
+            "nodes": nodes,
+            "edges": edges or [],
+            "clear_existing": clear_existing
+        }
+        if graph_path:
+            params["graph_path"] = graph_path
+        elif graph_name:
+            params["graph_name"] = graph_name
+            params["path"] = path
+        else:
+            return {"success": False, "error": "Must provide either graph_path or graph_name"}
+
+        response = unreal_connection.send_command("build_pcg_graph", params)
+
+        if response.get("success"):
+            logger.info(f"Successfully built PCG graph '{graph_path or graph_name}'")
+        else:
+            logger.error(f"Failed to build PCG graph: {response.get('error', 'Unknown error')}")
+
+        return response
+
+    except Exception as e:
+        logger.error(f"Exception in build_pcg_graph: {e}")
+        return {"success": False, "error": str(e)}
@@ -0,0 +1,104 @@
+"""
+Filename: output_reader.py
+Description: Python wrapper for exporting PCG generated points as a columnar binary blob
+"""
+
+import base64
+import logging
+from array import array
+from typing import Dict, Any, List, Optional
+
+logger = logging.getLogger("PCGGraph.OutputReader")
+
+_DTYPE_CODES = {"float32": "f", "int32": "i"}
+
+
+def get_pcg_output(
+    unreal_connection,
+    actor_name: str,
+    columns: Optional[List[str]] = None,
+    attributes: Optional[List[str]] = None,
+    pin: str = "",
+    max_points: int = 0,
+    output: str = "auto"
+) -> Dict[str, Any]:
+    """
+    Export the generated output points of an actor's PCG component.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        actor_name: Label or name of the actor with the PCGComponent
+        columns: Point columns to export (position, rotation, scale, density, seed,
+            bounds_min, bounds_max, color, steepness). Default: position, rotation,
+            scale, density, seed
+        attributes: Numeric metadata attributes to export as extra columns
+        pin: Only export data from this output pin
+        max_points: Stop after this many points (0 = all)
+        output: "auto", "base64" or "file" (auto writes a file under Saved/ for large blobs)
+
+    Returns:
+        Dictionary containing:
+            - success (bool): Whether operation succeeded
+            - point_count (int): Number of exported points
+            - columns (list): name, dtype, components, offset, byte_length per column
+            - segments (list): Per output data pin, tags, point_offset, point_count
+            - data_base64 (str) or file_path (str): The columnar blob
+            - error (str): Error message if failed
+    """
+    try:
+        params: Dict[str, Any] = {
+            "actor_name": actor_name,
+            "output": output
+        }
+        if columns:
+            params["columns"] = columns
+        if attributes:
+            params["attributes"] = attributes
+        if pin:
+            params["pin"] = pin
+        if max_points:
+            params["max_points"] = max_points
+
+        response = unreal_connection.send_command("get_pcg_output", params)
+
+        result = response.get("result", response) if isinstance(response, dict) else {}
+        if result.get("success"):
+            logger.info(f"Exported {result.get('point_count', 0)} PCG points from '{actor_name}'")
+        else:
+            logger.error(f"Failed to export PCG output: {result.get('error', 'Unknown error')}")
+
+        return response
+
+    except Exception as e:
+        logger.error(f"Exception in get_pcg_output: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def decode_pcg_output(result: Dict[str, Any]) -> Dict[str, array]:
+    """
+    Decode a get_pcg_output result into one flat typed array per column.
+
+    Column values are interleaved per point, so component c of point i is at
+    index i * components + c.
+
+    Args:
+        result: get_pcg_output response (wrapped or unwrapped)
+
+    Returns:
+        Dictionary of column name -> array('f') or array('i')
+    """
+    result = result.get("result", result)
+
+    if result.get("data_base64") is not None:
+        blob = base64.b64decode(result["data_base64"])
+    else:
+        with open(result["file_path"], "rb") as blob_file:
+            blob = blob_file.read()
+
+    decoded = {}
+    for column in result.get("columns", []):
+        values = array(_DTYPE_CODES[column["dtype"]])
+        start = int(column["offset"])
+        values.frombytes(blob[start:start + int(column["byte_length"])])
+        decoded[column["name"]] = values
+    return decoded
@@ -3,8 +3,11 @@ Filename: parameter_manager.py
 Description: Python wrapper for PCG graph parameter management and graph assignment
 """
 
+import itertools
 import logging
-from typing import Dict, Any, Optional, Union
+import re
+import time
+from typing import Dict, Any, List, Optional, Union
 
 logger = logging.getLogger("PCGGraph.ParameterManager")
 
@@ -97,7 +100,8 @@ def assign_pcg_graph(
     unreal_connection,
     graph_path: str,
     actor_name: Optional[str] = None,
-    blueprint_name: Optional[str] = None
+    blueprint_name: Optional[str] = None,
+    mode: str = "full"
 ) -> Dict[str, Any]:
     """
     Assign a PCG graph to an actor's or Blueprint's PCGComponent.
@@ -107,6 +111,7 @@ def assign_pcg_graph(
         graph_path: Content path to the PCG graph
         actor_name: Name of an actor in the level (provide this OR blueprint_name)
         blueprint_name: Name of a Blueprint asset (provide this OR actor_name)
+        mode: "full" or "incremental" regeneration of a level actor
 
     Returns:
         Dictionary containing:
@@ -116,7 +121,7 @@ def assign_pcg_graph(
             - error (str): Error message if failed
     """
     try:
-        params = {"graph_path": graph_path}
+        params = {"graph_path": graph_path, "mode": mode}
         if actor_name:
             params["actor_name"] = actor_name
         elif blueprint_name:
@@ -141,25 +146,41 @@ def assign_pcg_graph(
 
 def generate_pcg(
     unreal_connection,
-    actor_name: str
+    actor_name: str,
+    mode: str = "full",
+    seed: Optional[int] = None
 ) -> Dict[str, Any]:
     """
     Force-generate a PCG graph on an actor's PCGComponent.
 
+    Generation is scheduled and finishes over later editor ticks; use the
+    returned job_id with get_pcg_job_status or wait_pcg_generation.
+
     Args:
         unreal_connection: Connection to Unreal Engine
         actor_name: Name of actor in the level with a PCGComponent
+        mode: "full" cleans up and rebuilds; "incremental" regenerates in place
+            using PCG's cache and skips the actor when no input changed
+        seed: Set the component's seed before generating
 
     Returns:
         Dictionary containing:
             - success (bool): Whether operation succeeded
             - actor_name (str): Actor that was generated
+            - job_id (str): Generation job handle
+            - seed (int): Component seed used
+            - previous_seed (int): Seed before this call, when seed changed it
             - error (str): Error message if failed
     """
     try:
-        response = unreal_connection.send_command("generate_pcg", {
-            "actor_name": actor_name
-        })
+        params: Dict[str, Any] = {
+            "actor_name": actor_name,
+            "mode": mode
+        }
+        if seed is not None:
+            params["seed"] = seed
+
+        response = unreal_connection.send_command("generate_pcg", params)
 
         if response.get("success"):
             logger.info(f"Successfully triggered PCG generation on '{actor_name}'")
@@ -171,3 +192,321 @@ def generate_pcg(
     except Exception as e:
         logger.error(f"Exception in generate_pcg: {e}")
         return {"success": False, "error": str(e)}
+
+
+def generate_pcg_all(
+    unreal_connection,
+    actor_filter: str = "",
+    graph_filter: str = "",
+    bounds_min: Optional[list] = None,
+    bounds_max: Optional[list] = None,
+    mode: str = "full"
+) -> Dict[str, Any]:
+    """
+    Generate every PCG component in the level that matches the filters, as one batch.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        actor_filter: Substring or wildcard pattern (* / ?) for actor label or name
+        graph_filter: Substring of the assigned graph's path
+        bounds_min: [x, y, z] corner of a region; actors must intersect it
+        bounds_max: [x, y, z] opposite corner of the region
+        mode: "full" or "incremental"
+
+    Returns:
+        Dictionary containing:
+            - success (bool): Whether any component was scheduled
+            - batch_id (str): Handle for get_pcg_job_status / wait_pcg_generation
+            - component_count (int): Number of components scheduled
+            - local_components_skipped (int): Partition-local components left to their original
+            - jobs (list): job_id, actor_name, graph_path per component
+            - error (str): Error message if failed
+    """
+    try:
+        params: Dict[str, Any] = {"mode": mode}
+        if actor_filter:
+            params["actor_filter"] = actor_filter
+        if graph_filter:
+            params["graph_filter"] = graph_filter
+        if bounds_min and bounds_max:
+            params["bounds_min"] = bounds_min
+            params["bounds_max"] = bounds_max
+
+        response = unreal_connection.send_command("generate_pcg_all", params)
+
+        if response.get("success"):
+            logger.info(f"Scheduled {response.get('component_count', 0)} PCG components")
+        else:
+            logger.error(f"Failed to generate PCG components: {response.get('error', 'Unknown error')}")
+
+        return response
+
+    except Exception as e:
+        logger.error(f"Exception in generate_pcg_all: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def _unwrap(response: Any) -> Dict[str, Any]:
+    """Bridge responses wrap the command result in {"status", "result"}."""
+    if isinstance(response, dict):
+        return response.get("result", response)
+    return {}
+
+
+def get_pcg_job_status(
+    unreal_connection,
+    job_id: str = "",
+    batch_id: str = "",
+    include_jobs: bool = True
+) -> Dict[str, Any]:
+    """
+    Get the state and statistics of a PCG generation job or batch.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        job_id: Job handle returned by generate_pcg
+        batch_id: Batch handle returned by generate_pcg_all (used instead of job_id)
+        include_jobs: For a batch, include per-component status
+
+    Returns:
+        Dictionary containing:
+            - success (bool): Whether the job was found
+            - state (str): running, completed, cancelled or failed
+            - done (bool): Whether the job reached a terminal state
+            - wall_time_ms (float): Time since the request (or total time once done)
+            - point_count, instance_count, node_timings: Present once completed
+            - progress, per-state counts, jobs: For a batch (pruned counts jobs whose
+              outcome was dropped from the editor's history)
+            - error (str): Error message if failed
+    """
+    try:
+        if batch_id:
+            params: Dict[str, Any] = {"batch_id": batch_id, "include_jobs": include_jobs}
+        else:
+            params = {"job_id": job_id}
+        return unreal_connection.send_command("get_pcg_job_status", params)
+
+    except Exception as e:
+        logger.error(f"Exception in get_pcg_job_status: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def wait_pcg_generation(
+    unreal_connection,
+    job_id: str = "",
+    timeout_seconds: float = 60.0,
+    poll_interval: float = 0.1,
+    batch_id: str = ""
+) -> Dict[str, Any]:
+    """
+    Wait until a PCG generation job or batch finishes or the timeout expires.
+
+    Polls from this side so the editor's game thread keeps ticking the
+    generation while we wait.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        job_id: Job handle returned by generate_pcg
+        timeout_seconds: Maximum time to wait
+        poll_interval: Delay between status requests
+        batch_id: Batch handle returned by generate_pcg_all (used instead of job_id)
+
+    Returns:
+        The final status, with timed_out set if it was still running
+    """
+    deadline = time.monotonic() + timeout_seconds
+    handle = batch_id or job_id
+
+    while True:
+        # Batches are polled without per-component detail, which is fetched once at the end
+        response = get_pcg_job_status(unreal_connection, job_id, batch_id, include_jobs=False)
+        if not response:
+            return {"success": False, "error": "No response from Unreal"}
+
+        # done and success live in the command result, not the bridge envelope
+        status = _unwrap(response)
+        if response.get("status") == "error" or status.get("success") is False:
+            return status or {"success": False, "error": response.get("error", "Unknown error")}
+
+        timed_out = time.monotonic() >= deadline
+        if status.get("done") or timed_out:
+            if batch_id:
+                final = _unwrap(get_pcg_job_status(unreal_connection, batch_id=batch_id, include_jobs=True))
+                if final.get("success") is not False:
+                    status = final
+            if timed_out and not status.get("done"):
+                status["timed_out"] = True
+                logger.warning(f"Timed out waiting for PCG generation '{handle}' after {timeout_seconds}s")
+            return status
+
+        time.sleep(poll_interval)
+
+
+def pcg_parameter_sweep(
+    unreal_connection,
+    actor_name: str,
+    graph_path: str,
+    parameters: Dict[str, List[Any]],
+    mode: str = "full",
+    capture_thumbnails: bool = False,
+    thumbnail_delay: float = 0.5,
+    timeout_seconds: float = 120.0,
+    max_variants: int = 64,
+    max_instances: int = 0,
+    max_time_ms: float = 0.0,
+    restore: bool = True
+) -> Dict[str, Any]:
+    """
+    Generate one component for every combination of a grid of parameter values.
+
+    Each variant sets the graph user parameters that changed since the previous
+    variant (and the component seed when "seed" is in the grid), generates,
+    waits for the job and records its cost. Variants run in grid order, so the
+    same grid always produces the same sequence of runs.
+
+    The swept values are written to the graph asset's defaults, which every
+    component running that graph shares. The sweep refuses to start unless
+    actor_name's component runs graph_path and does not override any swept
+    parameter, and the originals are restored even if the sweep is interrupted.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        actor_name: Actor whose PCGComponent runs the graph
+        graph_path: Graph whose user parameters are swept
+        parameters: Parameter name -> list of values; the key "seed" sweeps the component seed
+        mode: Generation mode per variant ("full" keeps runs independent of each other)
+        capture_thumbnails: Save a viewport screenshot after each variant
+        thumbnail_delay: Seconds to let the viewport redraw before a screenshot
+        timeout_seconds: Maximum wait per variant
+        max_variants: Refuse grids larger than this
+        max_instances: Budget; variants above it are flagged (0 = no budget)
+        max_time_ms: Budget; variants slower than this are flagged (0 = no budget)
+        restore: Put the original parameter values and seed back and regenerate at the end
+
+    Returns:
+        Dictionary containing:
+            - success (bool): Whether the sweep ran
+            - variants (list): values, seed, state, wall_time_ms, point_count, instance_count,
+              within_budget and thumbnail per variant
+            - summary (dict): fastest, slowest, fewest/most instances and budget counts
+            - error (str): Error message if failed
+    """
+    if not parameters:
+        return {"success": False, "error": "parameters must map at least one name to a list of values"}
+
+    names = list(parameters.keys())
+    value_lists = [values if isinstance(values, list) else [values] for values in parameters.values()]
+    combinations = list(itertools.product(*value_lists))
+    if len(combinations) > max_variants:
+        return {"success": False, "error": f"Grid has {len(combinations)} variants, more than max_variants={max_variants}"}
+
+    # The sweep edits the graph asset's defaults, so the component has to run that graph and
+    # take the swept parameters from it rather than from its own overrides
+    check = _unwrap(unreal_connection.send_command("generate_pcg", {
+        "actor_name": actor_name,
+        "graph_path": graph_path,
+        "require_defaults": [name for name in names if name != "seed"],
+        "validate_only": True
+    }))
+    if not check.get("success"):
+        return {"success": False, "error": check.get("error", f"Cannot sweep '{actor_name}' with '{graph_path}'")}
+    original_seed: Optional[int] = check.get("seed")
+
+    # Remember current defaults so the graph can be put back afterwards
+    original_values: Dict[str, Any] = {}
+    graph_info = _unwrap(unreal_connection.send_command("read_pcg_graph", {"graph_path": graph_path}))
+    for param in graph_info.get("parameters", []):
+        if param.get("param_name") in parameters and "default_value" in param:
+            original_values[param["param_name"]] = param["default_value"]
+
+    variants = []
+    current: Dict[str, Any] = {}
+    sweep_start = time.monotonic()
+    safe_actor = re.sub(r"[^A-Za-z0-9_-]", "_", actor_name)
+
+    try:
+        for index, combination in enumerate(combinations):
+            values = dict(zip(names, combination))
+            variant: Dict[str, Any] = {"index": index, "values": values}
+
+            error = None
+            for name, value in values.items():
+                if name == "seed" or current.get(name, object()) == value:
+                    continue
+                set_result = _unwrap(set_pcg_graph_parameter(unreal_connection, graph_path, name, value))
+                if not set_result.get("success"):
+                    error = set_result.get("error", f"Could not set '{name}'")
+                    break
+                current[name] = value
+
+            if error:
+                variant.update({"state": "failed", "message": error})
+                variants.append(variant)
+                current.clear()
+                continue
+
+            seed = values.get("seed")
+            started = _unwrap(generate_pcg(unreal_connection, actor_name, mode, int(seed) if seed is not None else None))
+            if not started.get("job_id"):
+                variant.update({"state": "failed", "message": started.get("error", "generate_pcg failed")})
+                variants.append(variant)
+                continue
+
+            status = wait_pcg_generation(unreal_connection, started["job_id"], timeout_seconds)
+            variant.update({
+                "seed": started.get("seed"),
+                "job_id": started["job_id"],
+                "state": "timed_out" if status.get("timed_out") else status.get("state", "unknown"),
+                "wall_time_ms": status.get("wall_time_ms", 0.0),
+                "point_count": status.get("point_count", 0),
+                "instance_count": status.get("instance_count", 0),
+            })
+
+            within_budget = variant["state"] == "completed"
+            if max_instances and variant["instance_count"] > max_instances:
+                within_budget = False
+            if max_time_ms and variant["wall_time_ms"] > max_time_ms:
+                within_budget = False
+            variant["within_budget"] = within_budget
+
+            if capture_thumbnails and variant["state"] == "completed":
+                time.sleep(thumbnail_delay)
+                shot = _unwrap(unreal_connection.send_command(
+                    "take_screenshot", {"filename": f"PCGSweep/{safe_actor}_{index:03d}.png"}))
+                variant["thumbnail"] = shot.get("file_path", "")
+
+            logger.info(f"PCG sweep {index + 1}/{len(combinations)} {values}: {variant['state']}, "
+                        f"{variant['wall_time_ms']:.1f} ms, {variant['instance_count']} instances")
+            variants.append(variant)
+    finally:
+        # Runs even when a variant raises, so the shared graph asset is never left on a swept value
+        if restore:
+            for name, value in original_values.items():
+                if current.get(name, object()) != value:
+                    set_pcg_graph_parameter(unreal_connection, graph_path, name, value)
+            restored = _unwrap(generate_pcg(unreal_connection, actor_name, mode, original_seed))
+            if restored.get("job_id"):
+                wait_pcg_generation(unreal_connection, restored["job_id"], timeout_seconds)
+
+    completed = [v for v in variants if v.get("state") == "completed"]
+    summary: Dict[str, Any] = {
+        "variant_count": len(variants),
+        "completed": len(completed),
+        "within_budget": sum(1 for v in variants if v.get("within_budget")),
+        "sweep_time_s": round(time.monotonic() - sweep_start, 2),
+    }
+    if completed:
+        summary["fastest"] = min(completed, key=lambda v: v["wall_time_ms"])["index"]
+        summary["slowest"] = max(completed, key=lambda v: v["wall_time_ms"])["index"]
+        summary["fewest_instances"] = min(completed, key=lambda v: v["instance_count"])["index"]
+        summary["most_instances"] = max(completed, key=lambda v: v["instance_count"])["index"]
+
+    return {
+        "success": True,
+        "actor_name": actor_name,
+        "graph_path": graph_path,
+        "parameters": names,
+        "restored": restore,
+        "variants": variants,
+        "summary": summary,
+    }
@@ -13,7 +13,8 @@ def set_pcg_spawner_entries(
     unreal_connection,
     graph_path: str,
     node_id: str,
-    entries: List[Dict[str, Any]]
+    entries: List[Dict[str, Any]],
+    preload: str = "wait"
 ) -> Dict[str, Any]:
     """
     Set mesh entries on a PCG Static Mesh Spawner node.
@@ -25,19 +26,25 @@ def set_pcg_spawner_entries(
         entries: List of dictionaries, each with:
             - mesh_path (str): Content path to a static mesh asset
             - weight (int, optional): Selection weight (default: 1)
+        preload: "wait" (load all meshes in one request and block once), "async"
+            (request them and return immediately) or "none"
 
     Returns:
         Dictionary containing:
             - success (bool): Whether operation succeeded
             - node_id (str): Node that was modified
             - entry_count (int): Number of entries set
+            - mesh_count (int): Number of unique meshes requested
+            - load_time_ms (float): Time spent loading meshes
+            - missing_meshes (list): Mesh paths that failed to load (preload="wait")
             - error (str): Error message if failed
     """
     try:
         response = unreal_connection.send_command("set_pcg_spawner_entries", {
             "graph_path": graph_path,
             "node_id": node_id,
-            "entries": entries
+            "entries": entries,
+            "preload": preload
         })
 
         if response.get("success"):
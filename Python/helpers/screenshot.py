@@ -0,0 +1,238 @@
+"""
+Filename: screenshot.py
+Description: Python wrappers for asynchronous viewport screenshots
+"""
+
+import logging
+import time
+from typing import Dict, Any, List, Optional
+
+logger = logging.getLogger("Screenshot")
+
+
+def _encode_params(
+    max_dimension: int,
+    image_format: str,
+    quality: int,
+    output: str,
+    change_detection: str = "off",
+    view_key: str = ""
+) -> Dict[str, Any]:
+    """Build the scaling/codec/output/change parameters shared by the screenshot commands."""
+    params: Dict[str, Any] = {
+        "max_dimension": max_dimension,
+        "format": image_format,
+        "quality": quality,
+        "output": output
+    }
+    if change_detection and change_detection != "off":
+        params["change_detection"] = change_detection
+        if view_key:
+            params["view_key"] = view_key
+    return params
+
+
+def start_screenshot(
+    unreal_connection,
+    filename: str = "",
+    max_dimension: int = 0,
+    image_format: str = "png",
+    quality: int = 90,
+    output: str = "file",
+    change_detection: str = "off",
+    view_key: str = "viewport"
+) -> Dict[str, Any]:
+    """
+    Queue an asynchronous viewport capture.
+
+    The editor copies the last rendered frame into a GPU readback and encodes the
+    image on a worker thread, so the game thread is never flushed or stalled. If the
+    viewport cannot be read back asynchronously the editor captures synchronously
+    and returns the finished result directly (async = False).
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        filename: Output path; relative names resolve under Saved/Screenshots
+        max_dimension: Downscale so the longer side is at most this many pixels (0 = native)
+        image_format: "png" or "jpeg"
+        quality: JPEG quality, 1-100
+        output: "file", "base64" (inline, nothing written) or "both"
+        change_detection: "off", "bbox" (report the changed region) or "crop" (return
+            only the changed region); unchanged frames are not encoded or written
+        view_key: Frames are compared with the previous capture under the same key
+
+    Returns:
+        Job status with job_id and state, or the finished synchronous result
+    """
+    try:
+        params: Dict[str, Any] = {"async": True}
+        params.update(_encode_params(max_dimension, image_format, quality, output, change_detection, view_key))
+        if filename:
+            params["filename"] = filename
+        return unreal_connection.send_command("take_screenshot", params)
+
+    except Exception as e:
+        logger.error(f"Exception in start_screenshot: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def get_screenshot_status(unreal_connection, job_id: str) -> Dict[str, Any]:
+    """
+    Get the status of an asynchronous screenshot.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        job_id: Job handle returned by start_screenshot
+
+    Returns:
+        Dictionary with state, done, width, height, timings and (once completed) file_path
+    """
+    try:
+        return unreal_connection.send_command("get_screenshot_status", {"job_id": job_id})
+
+    except Exception as e:
+        logger.error(f"Exception in get_screenshot_status: {e}")
+        return {"success": False, "error": str(e)}
+
+
+def capture_screenshot(
+    unreal_connection,
+    filename: str = "",
+    max_dimension: int = 0,
+    image_format: str = "png",
+    quality: int = 90,
+    output: str = "file",
+    change_detection: str = "off",
+    view_key: str = "viewport",
+    timeout_seconds: float = 10.0,
+    poll_interval: float = 0.02
+) -> Dict[str, Any]:
+    """
+    Capture a screenshot and wait until it is written.
+
+    Polls from this side so the editor keeps rendering while the readback and
+    encode are in flight.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        filename: Output path; relative names resolve under Saved/Screenshots
+        max_dimension: Downscale so the longer side is at most this many pixels (0 = native)
+        image_format: "png" or "jpeg"
+        quality: JPEG quality, 1-100
+        output: "file", "base64" (inline, nothing written) or "both"
+        change_detection: "off", "bbox" or "crop" (see start_screenshot)
+        view_key: Frames are compared with the previous capture under the same key
+        timeout_seconds: Maximum time to wait
+        poll_interval: Delay between status requests
+
+    Returns:
+        The final result (unwrapped), with width, height, mime_type and file_path
+        and/or data_base64 when it succeeded; with change detection, change is
+        "first", "changed" (with changed_bbox) or "unchanged" (no image)
+    """
+    response = start_screenshot(
+        unreal_connection, filename, max_dimension, image_format, quality, output, change_detection, view_key
+    )
+    if not response:
+        return {"success": False, "error": "No response from Unreal"}
+
+    # Bridge responses wrap the command result in {"status", "result"}
+    result = response.get("result", response) if isinstance(response, dict) else response
+    if response.get("status") == "error" or result.get("success") is False:
+        return {"success": False, "error": response.get("error") or result.get("error", "Unknown error")}
+    if not result.get("async"):
+        result["success"] = True
+        return result
+
+    job_id = result["job_id"]
+    deadline = time.monotonic() + timeout_seconds
+
+    while not result.get("done"):
+        if time.monotonic() >= deadline:
+            logger.warning(f"Timed out waiting for screenshot '{job_id}' after {timeout_seconds}s")
+            return {"success": False, "error": "Timed out waiting for screenshot", "job_id": job_id}
+
+        time.sleep(poll_interval)
+        response = get_screenshot_status(unreal_connection, job_id)
+        result = response.get("result", response) if isinstance(response, dict) else {}
+        if response.get("status") == "error" or result.get("success") is False:
+            return {"success": False, "error": response.get("error") or result.get("error", "Unknown error")}
+
+    result["success"] = result.get("state") == "completed"
+    if not result["success"]:
+        result["error"] = result.get("message", "Screenshot failed")
+    return result
+
+
+def capture_views(
+    unreal_connection,
+    actor_names: Optional[List[str]] = None,
+    center: Optional[List[float]] = None,
+    extent: Optional[List[float]] = None,
+    orbit_count: int = 4,
+    orbit_pitch: float = -30.0,
+    include_top: bool = True,
+    views: Optional[List[Dict[str, Any]]] = None,
+    resolution: int = 512,
+    layout: str = "contact_sheet",
+    filename: str = "",
+    max_dimension: int = 0,
+    image_format: str = "png",
+    quality: int = 90,
+    output: str = "file",
+    change_detection: str = "off",
+    view_key: str = ""
+) -> Dict[str, Any]:
+    """
+    Render several cameras around a target offscreen, independent of the editor viewport.
+
+    Args:
+        unreal_connection: Connection to Unreal Engine
+        actor_names: Frame these actors (default: the editor selection)
+        center, extent: Frame an explicit box instead of actors
+        orbit_count: Perspective views evenly spaced around the target
+        orbit_pitch: Orbit camera pitch in degrees
+        include_top: Add a top-down orthographic view
+        views: Custom views, dicts with location and rotation or look_at, fov, orthographic, name
+        resolution: Square size of each view in pixels
+        layout: "contact_sheet" (one image) or "array" (one image per view)
+        filename: Output path; relative names resolve under Saved/Screenshots
+        max_dimension, image_format, quality, output: Same as start_screenshot
+        change_detection, view_key: Same as start_screenshot; the array layout
+            compares each view separately (default key: capture_views)
+
+    Returns:
+        Dictionary with views, the encoded sheet or per-view images, and timings
+    """
+    try:
+        params: Dict[str, Any] = {
+            "orbit_count": orbit_count,
+            "orbit_pitch": orbit_pitch,
+            "include_top": include_top,
+            "resolution": resolution,
+            "layout": layout
+        }
+        params.update(_encode_params(max_dimension, image_format, quality, output, change_detection, view_key))
+        if actor_names:
+            params["actor_names"] = actor_names
+        if center is not None and extent is not None:
+            params["center"] = center
+            params["extent"] = extent
+        if views:
+            params["views"] = views
+        if filename:
+            params["filename"] = filename
+
+        response = unreal_connection.send_command("capture_views", params)
+
+        result = response.get("result", response) if isinstance(response, dict) else {}
+        if response.get("status") == "error" or result.get("success") is False:
+            logger.error(f"Failed to capture views: {response.get('error') or result.get('error', 'Unknown error')}")
+        else:
+            logger.info(f"Captured {result.get('view_count', 0)} views in {result.get('capture_ms', 0):.1f} ms")
+
+        return response
+
+    except Exception as e:
+        logger.error(f"Exception in capture_views: {e}")
+        return {"success": False, "error": str(e)}
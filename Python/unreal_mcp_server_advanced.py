@@ -5,6 +5,7 @@ A streamlined MCP server focused on advanced composition tools for Unreal Engine
 Contains only the advanced tools from the expanded MCP tool system to keep tool count manageable.
 """
 
+import base64
 import logging
 import socket
 import json
@@ -50,6 +51,7 @@ from helpers.bridge_aqueduct_creation import (
 from helpers.outpost_creation import build_outpost_compound
 from helpers import hab_spawner
 from helpers import catalog_enricher
+from helpers import mesh_catalog as mesh_catalog_helper
 from helpers import scene_scanner
 from helpers import layout_generator
 
@@ -74,12 +76,18 @@ from helpers.pcg_graph import node_connector as pcg_node_connector
 from helpers.pcg_graph import node_properties as pcg_node_properties
 from helpers.pcg_graph import parameter_manager as pcg_parameter_manager
 from helpers.pcg_graph import spawner_entries as pcg_spawner_entries
+from helpers.pcg_graph import output_reader as pcg_output_reader
 
 # ============================================================================
 # Material Graph Tools
 # ============================================================================
 from helpers import material_graph as mat_graph_helper
 
+# ============================================================================
+# Screenshot Tools
+# ============================================================================
+from helpers import screenshot as screenshot_helper
+
 
 # Configure logging with more detailed format
 logging.basicConfig(
@@ -133,6 +141,7 @@ class UnrealConnection:
     LARGE_OPERATION_COMMANDS = {
         "get_available_materials",
         "list_content_browser_meshes",
+        "get_pcg_output",
         "create_town",
         "create_castle_fortress",
         "construct_mansion",
@@ -752,24 +761,31 @@ def spawn_static_mesh_actor(
 def list_content_browser_meshes(
     search_path: str = "/Game/",
     name_filter: str = "",
-    max_results: int = 100
+    max_results: int = 100,
+    offset: int = 0
 ) -> Dict[str, Any]:
     """Browse static meshes available in the Content Browser.
 
     Use this to discover mesh asset paths before placing them with
-    spawn_static_mesh_actor.
+    spawn_static_mesh_actor. Listings are cached per folder in the editor and
+    kept current as assets change, so repeated and filtered calls are cheap.
 
     Args:
         search_path: Content Browser folder to search (e.g. "/Game/ModularSciFi/")
-        name_filter: Only return meshes whose name contains this substring
+        name_filter: Only return meshes whose name contains this substring (case-insensitive)
         max_results: Maximum number of results to return (default 100)
+        offset: Skip this many matches; pass the previous next_offset to get the next page
+
+    Returns:
+        Dictionary with meshes ordered by path, count, total_found (meshes in the folder),
+        total_matches (after name_filter) and next_offset (-1 on the last page)
     """
     unreal = get_unreal_connection()
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
 
     try:
-        params = {"search_path": search_path, "max_results": max_results}
+        params = {"search_path": search_path, "max_results": max_results, "offset": offset}
         if name_filter:
             params["name_filter"] = name_filter
         response = unreal.send_command("list_content_browser_meshes", params)
@@ -1213,18 +1229,40 @@ def modular_cluster_snap(
         return {"success": False, "message": str(e)}
 
 @mcp.tool()
-def take_screenshot(filename: str = "") -> list:
+def take_screenshot(
+    filename: str = "",
+    max_dimension: int = 0,
+    format: str = "png",
+    quality: int = 90,
+    output: str = "file",
+    change_detection: str = "off",
+    view_key: str = "viewport"
+) -> list:
     """Capture a screenshot of the active UE5 editor viewport.
 
     Saves the current editor viewport as a PNG image and returns it
     as viewable image content. Useful for verifying actor placement,
     reviewing kitbash results, and visual debugging.
 
+    For tight validation loops, max_dimension=1024, format="jpeg" and
+    output="base64" return a small image inline without touching disk.
+
     Args:
         filename: Optional file path for the screenshot. Defaults to
                   ProjectSaved/Screenshots/MCP_Screenshot.png
-    """
-    if os.name == "nt":
+        max_dimension: Downscale so the longer side is at most this many pixels (0 = native)
+        format: "png" or "jpeg" (WebP is not available in the editor's encoders)
+        quality: JPEG quality, 1-100
+        output: "file", "base64" (inline, nothing written) or "both"
+        change_detection: "off", "bbox" (report the changed region) or "crop" (send only
+            the changed region). If nothing changed since the last capture with the same
+            view_key, no image is sent.
+        view_key: Name of the view to compare against (e.g. one per camera setup)
+    """
+    # The F9 path only produces native-size PNG files
+    use_f9 = max_dimension == 0 and format.lower() == "png" and output == "file" and change_detection == "off"
+
+    if os.name == "nt" and use_f9:
         try:
             user32 = ctypes.WinDLL("user32", use_last_error=True)
             windows = []
@@ -1346,16 +1384,31 @@ def take_screenshot(filename: str = "") -> list:
 
     unreal = get_unreal_connection()
     try:
-        params = {}
-        if filename:
-            params["filename"] = filename
-        response = unreal.send_command("take_screenshot", params)
+        # GPU readback + worker-thread encode; the editor never flushes or stalls for it
+        result = screenshot_helper.capture_screenshot(
+            unreal, filename, max_dimension, format, quality, output, change_detection, view_key
+        )
 
-        if response and response.get("status") == "success":
-            result = response.get("result", {})
+        if result.get("success") and result.get("change") == "unchanged":
+            return [f"Screenshot unchanged since the last '{view_key}' capture — no image sent"]
+
+        if result.get("success"):
             file_path = result.get("file_path", "")
             width = result.get("width", 0)
             height = result.get("height", 0)
+            if result.get("change") == "changed":
+                bbox = result.get("changed_bbox", {})
+                file_path = (f"{file_path} [changed region x={bbox.get('x')} y={bbox.get('y')} "
+                             f"w={bbox.get('width')} h={bbox.get('height')}"
+                             f"{', cropped' if result.get('cropped') else ''}]")
+
+            if result.get("data_base64"):
+                image_format = "jpeg" if result.get("format") == "jpg" else result.get("format", "png")
+                location = f"saved: {file_path}" if file_path else "captured in memory"
+                return [
+                    f"Screenshot {location} ({width}x{height}, {result.get('encoded_bytes', 0)} bytes)",
+                    Image(data=base64.b64decode(result["data_base64"]), format=image_format),
+                ]
 
             if file_path and os.path.exists(file_path):
                 return [
@@ -1365,12 +1418,82 @@ def take_screenshot(filename: str = "") -> list:
 
             return [f"Screenshot saved: {file_path} ({width}x{height}) — file not found on disk for preview"]
 
-        error = response.get("error", "Unknown error") if response else "No response"
-        return [f"Screenshot failed: {error}"]
+        return [f"Screenshot failed: {result.get('error', 'Unknown error')}"]
     except Exception as e:
         logger.error(f"take_screenshot error: {e}")
         return [f"Screenshot error: {e}"]
 
+@mcp.tool()
+def capture_views(
+    actor_names: List[str] = None,
+    center: List[float] = None,
+    extent: List[float] = None,
+    orbit_count: int = 4,
+    orbit_pitch: float = -30.0,
+    include_top: bool = True,
+    views: List[Dict[str, Any]] = None,
+    resolution: int = 512,
+    layout: str = "contact_sheet",
+    format: str = "jpeg",
+    quality: int = 85,
+    output: str = "base64",
+    change_detection: str = "off"
+) -> list:
+    """Render several camera views of a target offscreen and return them as images.
+
+    Uses scene captures instead of the editor viewport, so it works with the
+    editor minimised and replaces moving the camera and screenshotting N times.
+
+    Args:
+        actor_names: Actors to frame (default: the current editor selection)
+        center: Box center [x, y, z] to frame instead of actors (use with extent)
+        extent: Box half-size [x, y, z]
+        orbit_count: Perspective views evenly spaced around the target
+        orbit_pitch: Orbit camera pitch in degrees (negative looks down)
+        include_top: Add a top-down orthographic view
+        views: Custom views: {"location": [x,y,z], "rotation": [p,y,r] or "look_at": [x,y,z],
+               "fov": 60, "orthographic": false, "name": "..."}
+        resolution: Square size of each view in pixels
+        layout: "contact_sheet" (one grid image) or "array" (one image per view)
+        format: "jpeg" or "png"
+        quality: JPEG quality, 1-100
+        output: "base64" (inline), "file" or "both"
+        change_detection: "off", "bbox" or "crop"; views unchanged since the previous
+            capture_views call are skipped
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return ["Failed to connect to Unreal Engine"]
+
+    try:
+        response = screenshot_helper.capture_views(
+            unreal, actor_names, center, extent, orbit_count, orbit_pitch, include_top,
+            views, resolution, layout, image_format=format, quality=quality, output=output,
+            change_detection=change_detection
+        )
+        result = response.get("result", response) if isinstance(response, dict) else {}
+        if response.get("status") == "error" or result.get("success") is False:
+            return [f"Capture failed: {response.get('error') or result.get('error', 'Unknown error')}"]
+
+        names = ", ".join(view.get("name", "") for view in result.get("views", []))
+        content = [f"Captured {result.get('view_count', 0)} views ({names}) in {result.get('capture_ms', 0):.0f} ms"]
+
+        images = [result] if result.get("layout") == "contact_sheet" else result.get("views", [])
+        unchanged = [image.get("name", "contact_sheet") for image in images if image.get("change") == "unchanged"]
+        if unchanged:
+            content[0] += f"; unchanged, not sent: {', '.join(unchanged)}"
+        for image in images:
+            image_format = "jpeg" if image.get("format") == "jpg" else image.get("format", "png")
+            if image.get("data_base64"):
+                content.append(Image(data=base64.b64decode(image["data_base64"]), format=image_format))
+            elif image.get("file_path") and os.path.exists(image["file_path"]):
+                content.append(Image(path=image["file_path"]))
+        return content
+
+    except Exception as e:
+        logger.error(f"capture_views error: {e}")
+        return [f"Capture error: {e}"]
+
 # Essential Blueprint Tools for Physics Actors
 @mcp.tool()
 def create_blueprint(name: str, parent_class: str) -> Dict[str, Any]:
@@ -1490,6 +1613,43 @@ def compile_blueprint(blueprint_name: str) -> Dict[str, Any]:
         logger.error(f"compile_blueprint error: {e}")
         return {"success": False, "message": str(e)}
 
+@mcp.tool()
+def compile_blueprints(
+    blueprint_names: List[str] = None,
+    folder_path: str = "",
+    recursive: bool = True,
+    batch: bool = True
+) -> Dict[str, Any]:
+    """
+    Compile and validate many Blueprints in one request.
+
+    Args:
+        blueprint_names: Blueprint names or full asset paths to compile
+        folder_path: Content folder to collect Blueprints from (e.g. "/Game/Blueprints")
+        recursive: Include Blueprints in subfolders of folder_path
+        batch: Queue everything on the engine's compilation manager and compile in one
+               dependency-ordered pass (fast). Set False to compile one at a time and get
+               exact per-Blueprint compile_time_ms.
+
+    Returns:
+        Per-Blueprint status, errors and warnings plus aggregate counts and total compile time
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        params = {"recursive": recursive, "batch": batch}
+        if blueprint_names:
+            params["blueprint_names"] = blueprint_names
+        if folder_path:
+            params["folder_path"] = folder_path
+        response = unreal.send_command("compile_blueprints", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"compile_blueprints error: {e}")
+        return {"success": False, "message": str(e)}
+
 @mcp.tool()
 def read_blueprint_content(
     blueprint_path: str,
@@ -2249,9 +2409,35 @@ def create_maze(
 @mcp.tool()
 def get_available_materials(
     search_path: str = "/Game/",
-    include_engine_materials: bool = True
+    include_engine_materials: bool = True,
+    name_filter: str = "",
+    parent: str = "",
+    blend_mode: str = "",
+    kind: str = "all",
+    offset: int = 0,
+    limit: int = 0
 ) -> Dict[str, Any]:
-    """Get a list of available materials in the project that can be applied to objects."""
+    """
+    Get a list of available materials in the project that can be applied to objects.
+
+    Answered from the asset registry only, so no material is loaded.
+
+    Args:
+        search_path: Content folder to search recursively (default: /Game/)
+        include_engine_materials: Also search /Engine
+        name_filter: Only materials whose name contains this string
+        parent: Only instances whose parent material path contains this string
+        blend_mode: Only materials whose blend mode contains this (e.g. "Translucent", "Masked");
+            instances use their parent material's blend mode
+        kind: "all", "material" (base materials) or "instance"
+        offset: Index of the first result to return (results are sorted by path)
+        limit: Page size (0 = everything, the default)
+
+    Returns:
+        Dictionary with materials (name, path, package, class and Parent / BlendMode /
+        MaterialDomain / ShadingModel / TwoSided tags when known; instances report their
+        parent material's values), count, total, has_more, next_offset
+    """
     unreal = get_unreal_connection()
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
@@ -2259,8 +2445,17 @@ def get_available_materials(
     try:
         params = {
             "search_path": search_path,
-            "include_engine_materials": include_engine_materials
+            "include_engine_materials": include_engine_materials,
+            "kind": kind,
+            "offset": offset,
+            "limit": limit
         }
+        if name_filter:
+            params["name_filter"] = name_filter
+        if parent:
+            params["parent"] = parent
+        if blend_mode:
+            params["blend_mode"] = blend_mode
         response = unreal.send_command("get_available_materials", params)
         return response or {"success": False, "message": "No response from Unreal"}
     except Exception as e:
@@ -2339,9 +2534,26 @@ def set_mesh_material_color(
     color: List[float],
     material_path: str = "/Engine/BasicShapes/BasicShapeMaterial",
     parameter_name: str = "BaseColor",
-    material_slot: int = 0
+    material_slot: int = 0,
+    variant_mode: str = "constant",
+    save: bool = False
 ) -> Dict[str, Any]:
-    """Set material color on a mesh component using the proven color system."""
+    """
+    Set material color on a mesh component using the proven color system.
+
+    The color goes through the shared material variant cache, so every component
+    given the same material and color uses one instance.
+
+    Note: in the default "constant" mode a new color creates a MaterialInstanceConstant
+    asset under /Game/MCP/MaterialVariants (returned as variant_path). It stays unsaved
+    unless save is True, and the editor offers to save it with the blueprint.
+
+    Args:
+        variant_mode: "constant" (persistent instance asset shared by all components, default)
+            "dynamic" (MID owned by this component, saved with the blueprint; no asset is created)
+            or "shared_dynamic" (one MID per color shared by the blueprint's components; no asset)
+        save: Save the constant variant asset to disk if it was created or repaired (default: False)
+    """
     unreal = get_unreal_connection()
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
@@ -2354,41 +2566,35 @@ def set_mesh_material_color(
         # Ensure all color values are floats between 0 and 1
         color = [float(min(1.0, max(0.0, val))) for val in color]
         
-        # Set BaseColor parameter first
-        params_base = {
-            "blueprint_name": blueprint_name,
-            "component_name": component_name,
-            "color": color,
-            "material_path": material_path,
-            "parameter_name": "BaseColor",
-            "material_slot": material_slot
-        }
-        response_base = unreal.send_command("set_mesh_material_color", params_base)
-        
-        # Set Color parameter second (for maximum compatibility)
-        params_color = {
+        # Set BaseColor and Color in one variant (for maximum compatibility)
+        parameter_names = [parameter_name] + [name for name in ("BaseColor", "Color") if name != parameter_name]
+        params = {
             "blueprint_name": blueprint_name,
             "component_name": component_name,
             "color": color,
             "material_path": material_path,
-            "parameter_name": "Color",
-            "material_slot": material_slot
+            "parameter_name": parameter_name,
+            "parameter_names": parameter_names,
+            "material_slot": material_slot,
+            "variant_mode": variant_mode,
+            "save": save
         }
-        response_color = unreal.send_command("set_mesh_material_color", params_color)
+        response = unreal.send_command("set_mesh_material_color", params)
         
-        # Return success if either parameter setting worked
-        if (response_base and response_base.get("status") == "success") or (response_color and response_color.get("status") == "success"):
+        if response and response.get("status") == "success":
+            result = response.get("result", {})
             return {
                 "success": True, 
                 "message": f"Color applied successfully to slot {material_slot}: {color}",
-                "base_color_result": response_base,
-                "color_result": response_color,
+                "variant_path": result.get("variant_path"),
+                "variant_created": result.get("variant_created"),
+                "variant_saved": result.get("variant_saved"),
                 "material_slot": material_slot
             }
         else:
             return {
                 "success": False, 
-                "message": f"Failed to set color parameters on slot {material_slot}. BaseColor: {response_base}, Color: {response_color}"
+                "message": f"Failed to set color parameters on slot {material_slot}: {response}"
             }
             
     except Exception as e:
@@ -3724,6 +3930,148 @@ def rename_function(
         return {"success": False, "message": str(e)}
 
 
+@mcp.tool()
+def find_in_blueprints(
+    query: str,
+    search_type: str = "all",
+    variable_access: str = "any",
+    search_path: str = "/Game/",
+    max_results: int = 200,
+    rebuild: bool = False
+) -> Dict[str, Any]:
+    """
+    Search every Blueprint under a content path for nodes, function calls,
+    variable reads/writes or pin types, using a cached project-wide index.
+
+    The index is built on first use, refreshed when Blueprints are saved, and
+    Blueprints with unsaved edits are re-indexed on each query.
+
+    Args:
+        query: Pattern to find. Supports * and ? wildcards (e.g. "KismetMathLibrary.*"),
+               otherwise a case-insensitive substring match
+        search_type: "all", "node", "function", "variable" or "pin_type"
+        variable_access: For variable searches: "any", "read" or "write"
+        search_path: Content path to search (default "/Game/")
+        max_results: Maximum matches returned (total_matches still counts all)
+        rebuild: Discard cached entries under search_path and re-index
+
+    Returns:
+        Dictionary with matches (blueprint_path, graph, node_guid, node_title, match_type, match)
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        params = {
+            "query": query,
+            "search_type": search_type,
+            "variable_access": variable_access,
+            "search_path": search_path,
+            "max_results": max_results,
+            "rebuild": rebuild
+        }
+        response = unreal.send_command("find_in_blueprints", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"find_in_blueprints error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def layout_blueprint_graph(
+    blueprint_name: str,
+    function_name: Optional[str] = None,
+    all_graphs: bool = False,
+    spacing_x: float = 400.0,
+    spacing_y: float = 64.0
+) -> Dict[str, Any]:
+    """
+    Automatically arrange the nodes of a Blueprint graph.
+
+    Exec-connected nodes are placed in left-to-right layers following execution
+    flow; pure/data nodes are placed just left of the node that consumes them.
+    Run this once after building a graph node-by-node instead of passing
+    positions to every add_node call or moving nodes afterwards.
+
+    Args:
+        blueprint_name: Name of the Blueprint
+        function_name: Function graph to lay out (default: EventGraph)
+        all_graphs: Lay out the EventGraph and every function graph
+        spacing_x: Horizontal distance between execution layers
+        spacing_y: Vertical gap between nodes
+
+    Returns:
+        Dictionary with per-graph nodes_positioned and layers, plus layout_time_ms
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        params = {
+            "blueprint_name": blueprint_name,
+            "all_graphs": all_graphs,
+            "spacing_x": spacing_x,
+            "spacing_y": spacing_y
+        }
+        if function_name:
+            params["function_name"] = function_name
+        response = unreal.send_command("layout_blueprint_graph", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"layout_blueprint_graph error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def scaffold_blueprint_interface(
+    blueprint_name: str,
+    variables: Optional[List[Dict[str, Any]]] = None,
+    functions: Optional[List[Dict[str, Any]]] = None,
+    compile: bool = True,
+    auto_layout: bool = True
+) -> Dict[str, Any]:
+    """
+    Declare many variables and function signatures on a Blueprint in one call.
+
+    Everything is applied in a single undo transaction with one compile at the
+    end, instead of one compile per create_variable / create_function call.
+
+    Args:
+        blueprint_name: Name of the Blueprint to modify
+        variables: List of variable specs, same fields as create_variable:
+            {"variable_name": "Health", "variable_type": "float", "default_value": 100,
+             "is_public": True, "tooltip": "...", "category": "Stats"}
+        functions: List of function specs:
+            {"function_name": "ApplyDamage",
+             "inputs": [{"param_name": "Amount", "param_type": "float", "default_value": "10"}],
+             "outputs": [{"param_name": "bKilled", "param_type": "bool"}]}
+        compile: Compile once after all members are added (default True)
+        auto_layout: Arrange the nodes of each new function graph (default True)
+
+    Returns:
+        Dictionary with variables_created, functions_created, errors and compiled
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        params = {
+            "blueprint_name": blueprint_name,
+            "variables": variables or [],
+            "functions": functions or [],
+            "compile": compile,
+            "auto_layout": auto_layout
+        }
+        response = unreal.send_command("scaffold_blueprint_interface", params)
+        return response or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"scaffold_blueprint_interface error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 # ============================================================================
 # PCG Graph Tools
 # ============================================================================
@@ -3781,6 +4129,53 @@ def read_pcg_graph(
         return {"success": False, "message": str(e)}
 
 
+@mcp.tool()
+def build_pcg_graph(
+    nodes: List[Dict[str, Any]],
+    edges: Optional[List[Dict[str, Any]]] = None,
+    graph_path: str = "",
+    graph_name: str = "",
+    path: str = "/Game/PCG",
+    clear_existing: bool = False
+) -> Dict[str, Any]:
+    """
+    Build a whole PCG graph in one command instead of one call per node, edge and property.
+
+    The graph is notified and marked dirty once at the end.
+
+    Args:
+        nodes: List of node specs, e.g.
+            {"name": "sampler", "node_type": "SurfaceSampler", "properties": {"PointsPerSquaredMeter": 0.05}}
+            pos_x/pos_y are optional (nodes are laid out left to right otherwise)
+        edges: List of edge specs, e.g. {"from": "Input", "from_pin": "Landscape", "to": "sampler", "to_pin": "Surface"}
+            from/to accept spec names, existing node ids, "Input" or "Output"; pins default to "Out" -> "In"
+        graph_path: Existing graph to build into (provide this OR graph_name)
+        graph_name: Name of a new graph to create
+        path: Content path for a new graph (default: "/Game/PCG")
+        clear_existing: Remove all nodes except Input/Output before building
+
+    Returns:
+        Dictionary with graph_path, node_map (spec name -> node id), counts and per-item errors;
+        success is False if any node, property or edge failed (the rest is still built)
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        result = pcg_graph_creator.build_pcg_graph(
+            unreal, nodes, edges,
+            graph_path=graph_path if graph_path else None,
+            graph_name=graph_name if graph_name else None,
+            path=path,
+            clear_existing=clear_existing
+        )
+        return result
+    except Exception as e:
+        logger.error(f"build_pcg_graph error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 @mcp.tool()
 def add_pcg_node(
     graph_path: str,
@@ -3797,7 +4192,8 @@ def add_pcg_node(
                    "TransformPoints", "CreatePointsGrid", "DensityFilter", "CopyPoints",
                    "Merge", "Difference", "Subgraph", "GetActorData", "AttributeFilter",
                    "CreateAttribute", "DensityNoise", "DensityRemap", "Projection",
-                   "Intersection", "SplineSampler", "VolumeSampler"
+                   "Intersection", "SplineSampler", "VolumeSampler". Matching ignores case and
+                   separators; unknown types return close matches in "suggestions"
         pos_x: X position in graph editor (default: 0)
         pos_y: Y position in graph editor (default: 0)
 
@@ -3979,7 +4375,8 @@ def set_pcg_graph_parameter(
 def assign_pcg_graph(
     graph_path: str,
     actor_name: str = "",
-    blueprint_name: str = ""
+    blueprint_name: str = "",
+    mode: str = "full"
 ) -> Dict[str, Any]:
     """
     Assign a PCG graph to an actor's or Blueprint's PCGComponent.
@@ -3988,6 +4385,7 @@ def assign_pcg_graph(
         graph_path: Content path to the PCG graph
         actor_name: Name of an actor in the level (provide this OR blueprint_name)
         blueprint_name: Name of a Blueprint asset (provide this OR actor_name)
+        mode: "full" (cleanup + rebuild) or "incremental" regeneration of a level actor
 
     Returns:
         Dictionary with graph_path and target assignment info or error
@@ -4000,7 +4398,8 @@ def assign_pcg_graph(
         result = pcg_parameter_manager.assign_pcg_graph(
             unreal, graph_path,
             actor_name=actor_name if actor_name else None,
-            blueprint_name=blueprint_name if blueprint_name else None
+            blueprint_name=blueprint_name if blueprint_name else None,
+            mode=mode
         )
         return result
     except Exception as e:
@@ -4012,13 +4411,22 @@ def assign_pcg_graph(
 def set_pcg_spawner_entries(
     graph_path: str,
     node_id: str,
-    entries: List[Dict[str, Any]]
+    entries: List[Dict[str, Any]] = None,
+    catalog_category: str = "",
+    catalog_query: str = "",
+    catalog: str = "modularscifi_meshes",
+    default_weight: int = 1,
+    max_entries: int = 0,
+    preload: str = "wait"
 ) -> Dict[str, Any]:
     """
     Set mesh entries on a PCG Static Mesh Spawner node.
 
     Replaces all existing mesh entries with the provided list.
     Each entry specifies a static mesh asset and an optional selection weight.
+    Entries can also be filled straight from the mesh catalog by category
+    and/or name query; catalog matches are appended after any explicit entries.
+    All referenced meshes are loaded with a single async request.
 
     Args:
         graph_path: Content path to the PCG graph (e.g., "/Game/Custom/PCG/HabGenerator/PCG_Hab_Main")
@@ -4026,17 +4434,60 @@ def set_pcg_spawner_entries(
         entries: List of mesh entry dicts, each with:
             - mesh_path (str): Content path to a static mesh (e.g., "/Game/ModularSciFi/.../SM_Wall_Merged")
             - weight (int, optional): Selection weight for weighted random (default: 1)
+        catalog_category: Add every catalog mesh in this category (see get_mesh_categories)
+        catalog_query: Add catalog meshes whose name contains this string (case-insensitive)
+        catalog: Catalog file name (default: modularscifi_meshes)
+        default_weight: Weight for catalog-selected entries (default: 1)
+        max_entries: Cap on catalog-selected entries (0 = no cap)
+        preload: "wait" (default) loads all meshes in one request and blocks once,
+                 "async" returns while they stream in, "none" only writes the paths
 
     Returns:
-        Dictionary with node_id, entry_count, or error
+        Dictionary with node_id, entry_count, mesh_count, load_time_ms, missing_meshes, or error
     """
     unreal = get_unreal_connection()
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
 
     try:
+        all_entries = list(entries or [])
+
+        if catalog_category or catalog_query:
+            native = mesh_catalog_helper.unwrap(mesh_catalog_helper.query_catalog(
+                unreal, catalog, query=catalog_query, category=catalog_category, limit=max_entries
+            ))
+            if native is not None:
+                meshes = native.get("meshes", [])
+            else:
+                data = _load_mesh_catalog(catalog)
+                if "error" in data:
+                    return data
+                meshes = data.get("meshes", [])
+
+            category_lower = catalog_category.lower()
+            query_lower = catalog_query.lower()
+            catalog_entries = []
+            for m in meshes:
+                if category_lower and m.get("category", "").lower() != category_lower:
+                    continue
+                if query_lower and query_lower not in m.get("name", "").lower():
+                    continue
+                catalog_entries.append({"mesh_path": m["path"], "weight": default_weight})
+                if max_entries and len(catalog_entries) >= max_entries:
+                    break
+
+            if not catalog_entries:
+                return {
+                    "success": False,
+                    "message": f"No catalog meshes match category '{catalog_category}' and query '{catalog_query}'"
+                }
+            all_entries.extend(catalog_entries)
+
+        if not all_entries:
+            return {"success": False, "message": "Provide entries or a catalog_category / catalog_query selector"}
+
         result = pcg_spawner_entries.set_pcg_spawner_entries(
-            unreal, graph_path, node_id, entries
+            unreal, graph_path, node_id, all_entries, preload
         )
         return result
     except Exception as e:
@@ -4046,29 +4497,244 @@ def set_pcg_spawner_entries(
 
 @mcp.tool()
 def generate_pcg(
-    actor_name: str
+    actor_name: str,
+    mode: str = "full",
+    seed: Optional[int] = None
 ) -> Dict[str, Any]:
     """
     Force-generate a PCG graph on an actor's PCGComponent.
 
+    Returns as soon as generation is scheduled. Pass the returned job_id to
+    wait_pcg_generation or get_pcg_job_status for timing and output counts.
+
     Args:
         actor_name: Name of actor in the level with a PCGComponent
+        mode: "full" cleans up and rebuilds everything (default). "incremental" regenerates
+            in place, reusing PCG's cached results and managed components, and skips the
+            actor when its graph, parameters, node settings and transform are unchanged.
+        seed: Set the PCGComponent's seed before generating (optional)
 
     Returns:
-        Dictionary with success, actor_name or error
+        Dictionary with success, actor_name, job_id, seed or error
     """
     unreal = get_unreal_connection()
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
 
     try:
-        result = pcg_parameter_manager.generate_pcg(unreal, actor_name)
+        result = pcg_parameter_manager.generate_pcg(unreal, actor_name, mode, seed)
         return result
     except Exception as e:
         logger.error(f"generate_pcg error: {e}")
         return {"success": False, "message": str(e)}
 
 
+@mcp.tool()
+def pcg_parameter_sweep(
+    actor_name: str,
+    graph_path: str,
+    parameters: Dict[str, List[Any]],
+    mode: str = "full",
+    capture_thumbnails: bool = False,
+    timeout_seconds: float = 120.0,
+    max_variants: int = 64,
+    max_instances: int = 0,
+    max_time_ms: float = 0.0,
+    restore: bool = True
+) -> Dict[str, Any]:
+    """
+    Generate a PCG component once per combination of a parameter grid and report each variant's cost.
+
+    Variants run in grid order on the same component. Only parameters that changed since the previous
+    variant are set. Values are written to the graph asset's defaults, which every component running
+    the graph shares, so the sweep refuses to start unless actor_name's component runs graph_path and
+    does not override a swept parameter. The originals are restored even if the sweep stops early.
+
+    Args:
+        actor_name: Actor whose PCGComponent runs the graph
+        graph_path: Graph whose user parameters are swept (defaults are edited on the graph asset)
+        parameters: Parameter name -> values, e.g. {"Density": [0.5, 1.0], "seed": [1, 2, 3]}.
+                    The key "seed" sweeps the component seed instead of a graph parameter.
+        mode: "full" (default, each run independent) or "incremental"
+        capture_thumbnails: Save a viewport screenshot per variant under Saved/Screenshots/PCGSweep
+        timeout_seconds: Maximum wait per variant
+        max_variants: Refuse grids with more combinations than this (default: 64)
+        max_instances: Flag variants that spawn more instances than this (0 = no budget)
+        max_time_ms: Flag variants whose generation takes longer than this (0 = no budget)
+        restore: Restore the original parameter values and seed and regenerate at the end (default: True)
+
+    Returns:
+        Dictionary with variants (values, seed, state, wall_time_ms, point_count, instance_count,
+        within_budget, thumbnail) and a summary (fastest, slowest, fewest/most instances)
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        result = pcg_parameter_manager.pcg_parameter_sweep(
+            unreal, actor_name, graph_path, parameters,
+            mode=mode,
+            capture_thumbnails=capture_thumbnails,
+            timeout_seconds=timeout_seconds,
+            max_variants=max_variants,
+            max_instances=max_instances,
+            max_time_ms=max_time_ms,
+            restore=restore
+        )
+        return result
+    except Exception as e:
+        logger.error(f"pcg_parameter_sweep error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def generate_pcg_all(
+    actor_filter: str = "",
+    graph_filter: str = "",
+    bounds_min: Optional[List[float]] = None,
+    bounds_max: Optional[List[float]] = None,
+    mode: str = "full"
+) -> Dict[str, Any]:
+    """
+    Generate every PCG component in the level that matches the filters, scheduled together.
+
+    With no filters, every PCG component with a graph is generated. Returns a batch_id;
+    pass it to wait_pcg_generation or get_pcg_job_status for progress and per-component timing.
+
+    Args:
+        actor_filter: Substring or wildcard pattern (* and ?) matched against actor label or name
+        graph_filter: Substring of the assigned PCG graph path (e.g. "PCG_Forest")
+        bounds_min: [x, y, z] corner of a region; only actors intersecting it are generated
+        bounds_max: [x, y, z] opposite corner of the region
+        mode: "full" (cleanup + rebuild) or "incremental"
+
+    Returns:
+        Dictionary with batch_id, component_count, local_components_skipped (partition-local
+        components, generated by their original) and jobs (job_id, actor_name, graph_path)
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        result = pcg_parameter_manager.generate_pcg_all(
+            unreal, actor_filter, graph_filter, bounds_min, bounds_max, mode
+        )
+        return result or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"generate_pcg_all error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def get_pcg_job_status(
+    job_id: str = "",
+    batch_id: str = ""
+) -> Dict[str, Any]:
+    """
+    Get the state of a PCG generation job (generate_pcg) or batch (generate_pcg_all).
+
+    Args:
+        job_id: Job handle returned by generate_pcg or assign_pcg_graph
+        batch_id: Batch handle returned by generate_pcg_all (provide this OR job_id)
+
+    Returns:
+        For a job: state (running/completed/cancelled/failed), done, wall_time_ms, and once
+        completed: point_count, instance_count, instances_by_mesh, node_timings.
+        For a batch: progress, per-state counts (pruned = dropped from history, outcome unknown),
+        aggregate counts and per-component jobs.
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    if not job_id and not batch_id:
+        return {"success": False, "message": "Provide job_id or batch_id"}
+
+    try:
+        result = pcg_parameter_manager.get_pcg_job_status(unreal, job_id, batch_id)
+        return result or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_pcg_job_status error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def wait_pcg_generation(
+    job_id: str = "",
+    timeout_seconds: float = 60.0,
+    batch_id: str = ""
+) -> Dict[str, Any]:
+    """
+    Wait for a PCG generation job or batch to finish and return its statistics.
+
+    Args:
+        job_id: Job handle returned by generate_pcg or assign_pcg_graph
+        timeout_seconds: Maximum time to wait (default 60)
+        batch_id: Batch handle returned by generate_pcg_all (provide this OR job_id)
+
+    Returns:
+        Final status (see get_pcg_job_status); timed_out is set if it was still running
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+    if not job_id and not batch_id:
+        return {"success": False, "message": "Provide job_id or batch_id"}
+
+    try:
+        return pcg_parameter_manager.wait_pcg_generation(
+            unreal, job_id, timeout_seconds, batch_id=batch_id
+        )
+    except Exception as e:
+        logger.error(f"wait_pcg_generation error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def get_pcg_output(
+    actor_name: str,
+    columns: Optional[List[str]] = None,
+    attributes: Optional[List[str]] = None,
+    pin: str = "",
+    max_points: int = 0,
+    output: str = "auto"
+) -> Dict[str, Any]:
+    """
+    Export the points generated by an actor's PCG component as a compact columnar binary blob.
+
+    Each column is one contiguous little-endian array (float32, seed is int32) with its values
+    interleaved per point, e.g. position is x0 y0 z0 x1 y1 z1 ...; rotation is a quaternion
+    (x, y, z, w). Decode with helpers.pcg_graph.output_reader.decode_pcg_output.
+
+    Args:
+        actor_name: Label or name of the actor with the PCGComponent (generation must be finished)
+        columns: Any of "position", "rotation", "scale", "density", "seed", "bounds_min",
+                 "bounds_max", "color", "steepness" (default: position, rotation, scale, density, seed)
+        attributes: Numeric metadata attributes to add as columns (missing values are NaN)
+        pin: Only export data from this output pin
+        max_points: Stop after this many points (0 = all)
+        output: "auto" (inline unless larger than 64 KB), "base64" or "file" (written to Saved/MCP/PCGOutput
+                with a .json layout sidecar)
+
+    Returns:
+        Dictionary with point_count, columns (name, dtype, components, offset, byte_length),
+        segments (per output data), and data_base64 or file_path
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        result = pcg_output_reader.get_pcg_output(
+            unreal, actor_name, columns, attributes, pin, max_points, output
+        )
+        return result or {"success": False, "message": "No response from Unreal"}
+    except Exception as e:
+        logger.error(f"get_pcg_output error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 @mcp.tool()
 def get_pcg_node_property(
     graph_path: str,
@@ -4208,7 +4874,9 @@ def spawn_hab(
     validation = _validate_build_internal(label)
 
     output = [f"{summary}\n\n{result_json}"]
-    if validation["image"] is not None:
+    if validation.get("unchanged"):
+        output[0] += "\n\n(No visible change since the previous validation screenshot)"
+    elif validation["image"] is not None:
         output.append(validation["image"])
     else:
         output[0] += f"\n\n(Screenshot failed: {validation.get('error', 'unknown')})"
@@ -4221,10 +4889,14 @@ def spawn_hab(
 
 def _validate_build_internal(label: str = "build") -> Dict[str, Any]:
     """
-    Internal helper: takes a validation screenshot via F9 and returns the result.
+    Internal helper: takes a validation screenshot and returns the result.
+
+    Uses the editor's change detection first, so a build step that changed nothing
+    visible sends no image and a small change sends only the changed region. Falls
+    back to the F9 screenshot path if the editor capture fails.
 
     Returns:
-        Dict with "image" (Image object or None) and optional "error" string.
+        Dict with "image" (Image object or None), "unchanged" (bool) and optional "error" string.
     """
     try:
         safe_label = label.replace(" ", "_").replace("/", "_").replace("\\", "_")
@@ -4232,16 +4904,36 @@ def _validate_build_internal(label: str = "build") -> Dict[str, Any]:
             r"F:\UE Projects\ThoughtSpace\Saved\Screenshots",
             f"validate_{safe_label}.png"
         )
+
+        unreal = get_unreal_connection()
+        if unreal:
+            result = screenshot_helper.capture_screenshot(
+                unreal, screenshot_filename, change_detection="crop", view_key="validate_build"
+            )
+            if result.get("success"):
+                if result.get("change") == "unchanged":
+                    return {"image": None, "unchanged": True, "path": screenshot_filename}
+                file_path = result.get("file_path", screenshot_filename)
+                if os.path.exists(file_path):
+                    return {
+                        "image": Image(path=file_path),
+                        "unchanged": False,
+                        "path": file_path,
+                        "changed_bbox": result.get("changed_bbox"),
+                        "cropped": result.get("cropped", False)
+                    }
+            logger.warning(f"Editor validation capture failed: {result.get('error', 'file not found')}; using F9")
+
         screenshot_result = take_screenshot(filename=screenshot_filename)
 
         if len(screenshot_result) >= 2:
-            return {"image": screenshot_result[1], "path": screenshot_filename}
+            return {"image": screenshot_result[1], "unchanged": False, "path": screenshot_filename}
         else:
-            return {"image": None, "error": "F9 screenshot did not produce a file"}
+            return {"image": None, "unchanged": False, "error": "F9 screenshot did not produce a file"}
 
     except Exception as e:
         logger.warning(f"validate_build screenshot failed: {e}")
-        return {"image": None, "error": str(e)}
+        return {"image": None, "unchanged": False, "error": str(e)}
 
 
 @mcp.tool()
@@ -4267,9 +4959,12 @@ def validate_build(
     """
     validation = _validate_build_internal(label)
 
+    if validation.get("unchanged"):
+        return ["No visible change since the previous validation screenshot — no image sent"]
     if validation["image"] is not None:
+        region = " (changed region only)" if validation.get("cropped") else ""
         return [
-            f"Validation screenshot captured: {validation.get('path', label)}",
+            f"Validation screenshot captured{region}: {validation.get('path', label)}",
             validation["image"],
         ]
     else:
@@ -4334,7 +5029,9 @@ def search_mesh_catalog(
     """
     Search the pre-built mesh catalog by name or category.
 
-    Much faster than list_content_browser_meshes — no UE5 query needed.
+    Served by the editor's native catalog index (asset registry data plus the
+    catalog JSON, kept current as assets are added, removed or renamed); falls
+    back to scanning the catalog JSON when the editor is not reachable.
     Returns mesh names, full asset paths (ready for spawn_static_mesh_actor),
     categories, and tags.
 
@@ -4350,6 +5047,20 @@ def search_mesh_catalog(
     Returns:
         Dict with matching meshes, their paths, categories, and tags.
     """
+    native = mesh_catalog_helper.unwrap(mesh_catalog_helper.query_catalog(
+        get_unreal_connection(), catalog, query=query, category=category
+    ))
+    if native is not None:
+        return {
+            "success": True,
+            "query": query,
+            "category_filter": category,
+            "result_count": native.get("result_count", 0),
+            "meshes": native.get("meshes", []),
+            "source": "native_index",
+            "query_ms": native.get("query_ms"),
+        }
+
     data = _load_mesh_catalog(catalog)
     if "error" in data:
         return data
@@ -4402,6 +5113,17 @@ def get_mesh_categories(
     Returns:
         Dict with category names, counts, and descriptions.
     """
+    native = mesh_catalog_helper.unwrap(mesh_catalog_helper.get_catalog_info(get_unreal_connection(), catalog))
+    if native is not None:
+        return {
+            "success": True,
+            "asset_pack": native.get("asset_pack", "unknown"),
+            "total_meshes": native.get("total_meshes", 0),
+            "categories": native.get("categories", {}),
+            "descriptions": native.get("descriptions", {}),
+            "source": "native_index",
+        }
+
     data = _load_mesh_catalog(catalog)
     if "error" in data:
         return data
@@ -4518,7 +5240,9 @@ def query_catalog(
     max_size_cm: List[float] = None,
     has_bounds: bool = False,
     catalog: str = "modularscifi_meshes",
-    limit: int = 20
+    limit: int = 20,
+    socket_types: Optional[List[str]] = None,
+    offset: int = 0
 ) -> Dict[str, Any]:
     """
     Enhanced mesh catalog search with multi-criteria filtering.
@@ -4529,6 +5253,10 @@ def query_catalog(
 
     Text query matches against: mesh name, display_name, description, and function.
 
+    Served by the editor's native catalog index (inverted indices per name token,
+    category, tag and socket type, size-sorted orders for ranges); falls back to
+    scanning the catalog JSON when the editor is not reachable.
+
     Args:
         query: Text search string (case-insensitive). Matches name, display_name,
             description, and function fields. Empty returns all (filtered by other criteria).
@@ -4540,11 +5268,30 @@ def query_catalog(
         has_bounds: If True, only return meshes that have measured bounds.
         catalog: Catalog file name (default: modularscifi_meshes).
         limit: Maximum results to return (default 20).
+        socket_types: Require ALL of these socket types (native index only).
+        offset: Skip this many matches, for paging (native index only).
 
     Returns:
-        Dictionary with result_count and matching meshes with full metadata.
+        Dictionary with result_count, total_matches (native index) and matching meshes with full metadata.
     """
     try:
+        native = mesh_catalog_helper.unwrap(mesh_catalog_helper.query_catalog(
+            get_unreal_connection(), catalog, query=query, text_fields="all", category=category,
+            tags=tags, socket_types=socket_types, min_size_cm=min_size_cm, max_size_cm=max_size_cm,
+            has_bounds=has_bounds, offset=offset, limit=limit
+        ))
+        if native is not None:
+            return {
+                "success": True,
+                "query": query,
+                "category_filter": category,
+                "result_count": native.get("result_count", 0),
+                "total_matches": native.get("total_matches", 0),
+                "meshes": native.get("meshes", []),
+                "source": "native_index",
+                "query_ms": native.get("query_ms"),
+            }
+
         return catalog_enricher.query_meshes(
             catalog_name=catalog,
             query=query,
@@ -5070,30 +5817,205 @@ def set_landscape_material(
 
 @mcp.tool()
 def compile_material(
-    material_path: str
+    material_path: str,
+    wait: bool = True,
+    timeout_seconds: float = 120.0,
+    save: bool = False
 ) -> Dict[str, Any]:
     """
-    Recompile and save a material. Call this after making changes to a material
+    Recompile a material. Call this after making changes to a material
     graph to apply all expression connections and parameter changes.
 
+    Graph edits (add_material_expression, set_material_expression_param,
+    connect_material_expressions, connect_material_to_output) only mark the
+    material dirty, so a whole graph is compiled once here rather than per edit.
+
+    The editor starts the compile and returns a job id right away; shaders
+    finish in the background. With wait=True this tool polls until they are
+    done, without blocking the editor. Saving is a separate step (save=True
+    here, or save_materials for several materials at once).
+
     Args:
         material_path: Content path to the material
+        wait: Poll until the shaders are compiled (default: True)
+        timeout_seconds: Maximum time to wait when wait=True
+        save: Save the material package after starting the compile
 
     Returns:
-        Dictionary with success status and message
+        Dictionary with job_id, state, compile_time_ms and, once done, errors and
+        platforms (shader platform, vertex/pixel instruction counts, samplers, texture samples)
     """
     unreal = get_unreal_connection()
     if not unreal:
         return {"success": False, "message": "Failed to connect to Unreal Engine"}
 
     try:
-        result = mat_graph_helper.compile_material(unreal, material_path)
+        result = mat_graph_helper.compile_material(unreal, material_path, save=save)
+        status = result.get("result", result) if isinstance(result, dict) else result
+        if wait and status.get("job_id") and not status.get("done"):
+            final = mat_graph_helper.wait_material_compile(unreal, status["job_id"], timeout_seconds)
+            final.setdefault("saved", status.get("saved", False))
+            final.setdefault("had_pending_edits", status.get("had_pending_edits", False))
+            return final
         return result
     except Exception as e:
         logger.error(f"compile_material error: {e}")
         return {"success": False, "message": str(e)}
 
 
+@mcp.tool()
+def get_material_compile_status(
+    job_id: str
+) -> Dict[str, Any]:
+    """
+    Get the state of a material compile started by compile_material(wait=False).
+
+    Args:
+        job_id: Job handle returned by compile_material
+
+    Returns:
+        Dictionary with state (compiling, completed, failed, cancelled), done,
+        compile_time_ms, shader_jobs_remaining and, once done, errors and platforms
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        return mat_graph_helper.get_material_compile_status(unreal, job_id)
+    except Exception as e:
+        logger.error(f"get_material_compile_status error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def save_materials(
+    material_paths: List[str],
+    only_dirty: bool = True
+) -> Dict[str, Any]:
+    """
+    Save several material packages in one request, e.g. after compiling a batch.
+
+    Args:
+        material_paths: Content paths of the materials to save
+        only_dirty: Skip materials with no unsaved changes (default: True)
+
+    Returns:
+        Dictionary with saved, skipped and failed path lists
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        return mat_graph_helper.save_materials(unreal, material_paths, only_dirty)
+    except Exception as e:
+        logger.error(f"save_materials error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def build_material_graph(
+    material_path: str,
+    nodes: List[Dict[str, Any]],
+    links: List[Dict[str, Any]] = None,
+    outputs: List[Dict[str, Any]] = None,
+    two_sided: bool = None,
+    create_if_missing: bool = True,
+    clear_existing: bool = False,
+    recompile: bool = True,
+    save: bool = True,
+    wait: bool = False
+) -> Dict[str, Any]:
+    """
+    Build a complete material graph in one request and compile it once.
+
+    Replaces the create_material / add_material_expression / set_material_expression_param /
+    connect_material_expressions / connect_material_to_output sequence. Nodes are
+    created in one pass and links resolve through a name map, so large graphs
+    need a single round trip.
+
+    Args:
+        material_path: Content path to the material (e.g., "/Game/Materials/M_Rock"); created if missing
+        nodes: List of node dicts:
+            - node_name (str): Name used by links and outputs
+            - expression_class (str): Same names as add_material_expression (TextureSample, Lerp, ...)
+            - pos_x, pos_y (int, optional): Graph position
+            - params (dict, optional): {param_name: param_value}, same params as set_material_expression_param
+        links: List of dicts with from_expression, to_expression, from_output_index, to_input_index
+        outputs: List of dicts with expression_name, material_property (BaseColor, Normal, ...), output_index
+        two_sided: Set the two-sided flag when given
+        create_if_missing: Create the material if it does not exist (default: True)
+        clear_existing: Delete existing expressions first (default: False)
+        recompile: Compile once at the end (default: True)
+        save: Save the material package (default: True); skipped when any graph element failed
+        wait: Block until shaders finish and report instruction and sampler counts (default: False);
+              otherwise poll the returned job_id with get_material_compile_status
+
+    Returns:
+        Dictionary with node_count, link_count, output_count, nodes, errors, job_id,
+        compile_time_ms and, once shaders are done (wait=True), stats (vertex/pixel
+        shader instructions, samplers, texture samples)
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        result = mat_graph_helper.build_material_graph(
+            unreal, material_path, nodes, links, outputs, two_sided,
+            create_if_missing, clear_existing, recompile, save, wait
+        )
+        return result
+    except Exception as e:
+        logger.error(f"build_material_graph error: {e}")
+        return {"success": False, "message": str(e)}
+
+
+@mcp.tool()
+def apply_material_variant(
+    parent_material: str,
+    parameters: Dict[str, Any],
+    targets: List[Any],
+    material_slot: int = 0,
+    mode: str = "constant",
+    asset_folder: str = "/Game/MCP/MaterialVariants",
+    save: bool = True
+) -> Dict[str, Any]:
+    """
+    Apply one material variant (parent + parameter overrides) to many actors in one request.
+
+    Variants are cached by parent and parameter values: every call with the same
+    overrides reuses one instance instead of creating a material per actor.
+
+    Args:
+        parent_material: Content path of the base material
+        parameters: {name: value}; [r, g, b(, a)] sets a vector, a number sets a scalar,
+            a string sets a texture path
+        targets: Actor names/labels, or dicts with actor_name, component_name, material_slot
+        material_slot: Slot for targets that do not set one (default: 0)
+        mode: "constant" (persistent instance asset, default), "dynamic" (one MID owned by each
+            component, saved with its level; not shared across components) or "shared_dynamic"
+            (one MID per level shared by all its components; no asset is created)
+        asset_folder: Folder for constant variants
+        save: Save the constant variant if it was created or repaired (default: True)
+
+    Returns:
+        Dictionary with variant_path, created, applied_components, applied_actors, missing_actors
+    """
+    unreal = get_unreal_connection()
+    if not unreal:
+        return {"success": False, "message": "Failed to connect to Unreal Engine"}
+
+    try:
+        return mat_graph_helper.apply_material_variant(
+            unreal, parent_material, parameters, targets, material_slot, mode, asset_folder, save
+        )
+    except Exception as e:
+        logger.error(f"apply_material_variant error: {e}")
+        return {"success": False, "message": str(e)}
+
+
 @mcp.tool()
 def create_landscape_height_material(
     material_name: str,
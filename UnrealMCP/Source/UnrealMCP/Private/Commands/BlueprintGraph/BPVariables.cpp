@@ -4,12 +4,87 @@
 #include "EdGraphSchema_K2.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/Kismet2NameValidators.h"
 #include "Subsystems/AssetEditorSubsystem.h"
 #include "EditorSubsystem.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "PropertyEditorModule.h"
 #include "Modules/ModuleManager.h"
 
+bool FBPVariables::AddVariableToBlueprint(UBlueprint* Blueprint, const TSharedPtr<FJsonObject>& VariableSpec, FString& OutError, bool bDeferStructuralUpdate)
+{
+    FString VariableName;
+    FString VariableType;
+    if (!Blueprint || !VariableSpec.IsValid()
+        || !VariableSpec->TryGetStringField(TEXT("variable_name"), VariableName)
+        || !VariableSpec->TryGetStringField(TEXT("variable_type"), VariableType))
+    {
+        OutError = TEXT("Missing 'variable_name' or 'variable_type'");
+        return false;
+    }
+
+    bool IsPublic = VariableSpec->HasField(TEXT("is_public")) ? VariableSpec->GetBoolField(TEXT("is_public")) : false;
+    FString Tooltip = VariableSpec->HasField(TEXT("tooltip")) ? VariableSpec->GetStringField(TEXT("tooltip")) : TEXT("");
+    FString Category = VariableSpec->HasField(TEXT("category")) ? VariableSpec->GetStringField(TEXT("category")) : TEXT("Default");
+
+    FEdGraphPinType VarType = GetPinTypeFromString(VariableType);
+    FName VarName = FName(*VariableName);
+
+    if (bDeferStructuralUpdate)
+    {
+        // AddMemberVariable marks the Blueprint structurally modified (skeleton recompile) on every call.
+        // Batched callers append the description directly and notify once when they are done.
+        // The skeleton class is stale during a batch, so check earlier batch entries explicitly too.
+        if (FBlueprintEditorUtils::FindNewVariableIndex(Blueprint, VarName) != INDEX_NONE)
+        {
+            OutError = FString::Printf(TEXT("Variable '%s' already exists"), *VariableName);
+            return false;
+        }
+
+        // Same check AddMemberVariable makes: reserved words, functions, components, inherited members
+        const EValidatorResult NameResult = FKismetNameValidator(Blueprint).IsValid(VarName);
+        if (NameResult != EValidatorResult::Ok)
+        {
+            OutError = FString::Printf(TEXT("Invalid variable name '%s': %s"), *VariableName,
+                *INameValidatorInterface::GetErrorText(VariableName, NameResult).ToString());
+            return false;
+        }
+
+        FBPVariableDescription NewVariable;
+        NewVariable.VarName = VarName;
+        NewVariable.VarGuid = FGuid::NewGuid();
+        NewVariable.VarType = VarType;
+        NewVariable.ReplicationCondition = COND_None;
+        Blueprint->NewVariables.Add(NewVariable);
+    }
+    else if (!FBlueprintEditorUtils::AddMemberVariable(Blueprint, VarName, VarType))
+    {
+        OutError = FString::Printf(TEXT("Failed to create variable '%s'"), *VariableName);
+        return false;
+    }
+
+    FBPVariableDescription& Variable = Blueprint->NewVariables.Last();
+    Variable.FriendlyName = VariableName;
+    Variable.Category = FText::FromString(Category);
+    Variable.PropertyFlags = CPF_BlueprintVisible | CPF_BlueprintReadOnly;
+    if (IsPublic)
+    {
+        Variable.PropertyFlags |= CPF_Edit;
+    }
+
+    if (!Tooltip.IsEmpty())
+    {
+        Variable.SetMetaData(FBlueprintMetadata::MD_Tooltip, Tooltip);
+    }
+
+    if (VariableSpec->HasField(TEXT("default_value")))
+    {
+        SetDefaultValue(Variable, VariableSpec->Values.FindRef("default_value"));
+    }
+
+    return true;
+}
+
 TSharedPtr<FJsonObject> FBPVariables::CreateVariable(const TSharedPtr<FJsonObject>& Params)
 {
     TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
@@ -19,7 +94,6 @@ TSharedPtr<FJsonObject> FBPVariables::CreateVariable(const TSharedPtr<FJsonObjec
     FString VariableType = Params->GetStringField(TEXT("variable_type"));
 
     bool IsPublic = Params->HasField(TEXT("is_public")) ? Params->GetBoolField(TEXT("is_public")) : false;
-    FString Tooltip = Params->HasField(TEXT("tooltip")) ? Params->GetStringField(TEXT("tooltip")) : TEXT("");
     FString Category = Params->HasField(TEXT("category")) ? Params->GetStringField(TEXT("category")) : TEXT("Default");
 
     UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
@@ -31,30 +105,9 @@ TSharedPtr<FJsonObject> FBPVariables::CreateVariable(const TSharedPtr<FJsonObjec
         return Result;
     }
 
-    FEdGraphPinType VarType = GetPinTypeFromString(VariableType);
-    FName VarName = FName(*VariableName);
-
-    if (FBlueprintEditorUtils::AddMemberVariable(Blueprint, VarName, VarType))
+    FString Error;
+    if (AddVariableToBlueprint(Blueprint, Params, Error))
     {
-        FBPVariableDescription& Variable = Blueprint->NewVariables.Last();
-        Variable.FriendlyName = VariableName;
-        Variable.Category = FText::FromString(Category);
-        Variable.PropertyFlags = CPF_BlueprintVisible | CPF_BlueprintReadOnly;
-        if (IsPublic)
-        {
-            Variable.PropertyFlags |= CPF_Edit;
-        }
-
-        if (!Tooltip.IsEmpty())
-        {
-            Variable.SetMetaData(FBlueprintMetadata::MD_Tooltip, Tooltip);
-        }
-
-        if (Params->HasField(TEXT("default_value")))
-        {
-            SetDefaultValue(Variable, Params->Values.FindRef("default_value"));
-        }
-
         Blueprint->MarkPackageDirty();
 
         // Force immediate refresh of the Blueprint editor
@@ -0,0 +1,230 @@
+#include "Commands/BlueprintGraph/BlueprintScaffolder.h"
+#include "Commands/BlueprintGraph/BPVariables.h"
+#include "Commands/BlueprintGraph/GraphLayout.h"
+#include "Commands/BlueprintGraph/Function/FunctionManager.h"
+#include "Commands/BlueprintGraph/Function/FunctionIO.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "K2Node_FunctionEntry.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Kismet2/KismetEditorUtilities.h"
+#include "ScopedTransaction.h"
+
+// Add the parameters of one direction to a freshly created function graph
+static void AddScaffoldParameters(
+	UBlueprint* Blueprint,
+	UEdGraph* FunctionGraph,
+	const TArray<TSharedPtr<FJsonValue>>* ParamArray,
+	bool bIsInput,
+	TArray<TSharedPtr<FJsonValue>>& OutAdded,
+	TArray<TSharedPtr<FJsonValue>>& OutErrors)
+{
+	if (!ParamArray)
+	{
+		return;
+	}
+
+	const FString FunctionName = FunctionGraph->GetName();
+	UK2Node_FunctionEntry* EntryNode = nullptr;
+
+	for (const TSharedPtr<FJsonValue>& ParamValue : *ParamArray)
+	{
+		const TSharedPtr<FJsonObject>* ParamObj = nullptr;
+		FString ParamName;
+		FString ParamType;
+		if (!ParamValue->TryGetObject(ParamObj)
+			|| !(*ParamObj)->TryGetStringField(TEXT("param_name"), ParamName)
+			|| !(*ParamObj)->TryGetStringField(TEXT("param_type"), ParamType))
+		{
+			OutErrors.Add(MakeShared<FJsonValueString>(FString::Printf(
+				TEXT("%s: each parameter needs 'param_name' and 'param_type'"), *FunctionName)));
+			continue;
+		}
+
+		if (!FFunctionIO::ValidateParameterName(ParamName))
+		{
+			OutErrors.Add(MakeShared<FJsonValueString>(FString::Printf(
+				TEXT("%s: invalid parameter name '%s'"), *FunctionName, *ParamName)));
+			continue;
+		}
+
+		bool bIsArray = false;
+		(*ParamObj)->TryGetBoolField(TEXT("is_array"), bIsArray);
+
+		if (!FFunctionIO::AddFunctionParameter(Blueprint, FunctionName, ParamName, ParamType, bIsInput, bIsArray, /*bNotify=*/false))
+		{
+			OutErrors.Add(MakeShared<FJsonValueString>(FString::Printf(
+				TEXT("%s: failed to add %s '%s'"), *FunctionName, bIsInput ? TEXT("input") : TEXT("output"), *ParamName)));
+			continue;
+		}
+
+		// Input defaults live on the entry node's user-defined pin
+		FString DefaultValue;
+		if (bIsInput && (*ParamObj)->TryGetStringField(TEXT("default_value"), DefaultValue))
+		{
+			if (!EntryNode)
+			{
+				for (UEdGraphNode* Node : FunctionGraph->Nodes)
+				{
+					EntryNode = Cast<UK2Node_FunctionEntry>(Node);
+					if (EntryNode)
+					{
+						break;
+					}
+				}
+			}
+
+			if (EntryNode)
+			{
+				for (TSharedPtr<FUserPinInfo>& PinInfo : EntryNode->UserDefinedPins)
+				{
+					if (PinInfo.IsValid() && PinInfo->PinName == FName(*ParamName))
+					{
+						EntryNode->ModifyUserDefinedPinDefaultValue(PinInfo, DefaultValue);
+						break;
+					}
+				}
+			}
+		}
+
+		OutAdded.Add(MakeShared<FJsonValueString>(ParamName));
+	}
+}
+
+TSharedPtr<FJsonObject> FBlueprintScaffolder::ScaffoldBlueprintInterface(const TSharedPtr<FJsonObject>& Params)
+{
+	FString BlueprintName;
+	if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+	{
+		return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* VariablesArray = nullptr;
+	Params->TryGetArrayField(TEXT("variables"), VariablesArray);
+
+	const TArray<TSharedPtr<FJsonValue>>* FunctionsArray = nullptr;
+	Params->TryGetArrayField(TEXT("functions"), FunctionsArray);
+
+	if ((!VariablesArray || VariablesArray->Num() == 0) && (!FunctionsArray || FunctionsArray->Num() == 0))
+	{
+		return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide at least one entry in 'variables' or 'functions'"));
+	}
+
+	bool bCompile = true;
+	Params->TryGetBoolField(TEXT("compile"), bCompile);
+
+	bool bAutoLayout = true;
+	Params->TryGetBoolField(TEXT("auto_layout"), bAutoLayout);
+
+	UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+	if (!Blueprint)
+	{
+		return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+	}
+
+	TArray<TSharedPtr<FJsonValue>> VariablesCreated;
+	TArray<TSharedPtr<FJsonValue>> FunctionsCreated;
+	TArray<TSharedPtr<FJsonValue>> Errors;
+
+	{
+		FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "ScaffoldBlueprintInterface", "Scaffold Blueprint Interface"));
+		Blueprint->Modify();
+
+		if (VariablesArray)
+		{
+			for (const TSharedPtr<FJsonValue>& VariableValue : *VariablesArray)
+			{
+				const TSharedPtr<FJsonObject>* VariableObj = nullptr;
+				if (!VariableValue->TryGetObject(VariableObj))
+				{
+					Errors.Add(MakeShared<FJsonValueString>(TEXT("Variable entries must be objects")));
+					continue;
+				}
+
+				FString Error;
+				if (FBPVariables::AddVariableToBlueprint(Blueprint, *VariableObj, Error, /*bDeferStructuralUpdate=*/true))
+				{
+					VariablesCreated.Add(MakeShared<FJsonValueString>((*VariableObj)->GetStringField(TEXT("variable_name"))));
+				}
+				else
+				{
+					Errors.Add(MakeShared<FJsonValueString>(Error));
+				}
+			}
+		}
+
+		if (FunctionsArray)
+		{
+			for (const TSharedPtr<FJsonValue>& FunctionValue : *FunctionsArray)
+			{
+				const TSharedPtr<FJsonObject>* FunctionObj = nullptr;
+				FString FunctionName;
+				if (!FunctionValue->TryGetObject(FunctionObj) || !(*FunctionObj)->TryGetStringField(TEXT("function_name"), FunctionName))
+				{
+					Errors.Add(MakeShared<FJsonValueString>(TEXT("Function entries need a 'function_name'")));
+					continue;
+				}
+
+				FString Error;
+				UEdGraph* FunctionGraph = FFunctionManager::CreateFunctionGraph(Blueprint, FunctionName, Error, /*bDeferStructuralUpdate=*/true);
+				if (!FunctionGraph)
+				{
+					Errors.Add(MakeShared<FJsonValueString>(Error));
+					continue;
+				}
+
+				const TArray<TSharedPtr<FJsonValue>>* Inputs = nullptr;
+				(*FunctionObj)->TryGetArrayField(TEXT("inputs"), Inputs);
+				const TArray<TSharedPtr<FJsonValue>>* Outputs = nullptr;
+				(*FunctionObj)->TryGetArrayField(TEXT("outputs"), Outputs);
+
+				TArray<TSharedPtr<FJsonValue>> InputsAdded;
+				TArray<TSharedPtr<FJsonValue>> OutputsAdded;
+				AddScaffoldParameters(Blueprint, FunctionGraph, Inputs, true, InputsAdded, Errors);
+				AddScaffoldParameters(Blueprint, FunctionGraph, Outputs, false, OutputsAdded, Errors);
+
+				if (bAutoLayout)
+				{
+					FBlueprintGraphLayout::ApplyLayout(FunctionGraph, FBlueprintGraphLayoutSettings());
+				}
+
+				TSharedPtr<FJsonObject> FunctionInfo = MakeShared<FJsonObject>();
+				FunctionInfo->SetStringField(TEXT("function_name"), FunctionName);
+				FunctionInfo->SetStringField(TEXT("graph_id"), FunctionGraph->GetName());
+				FunctionInfo->SetArrayField(TEXT("inputs"), InputsAdded);
+				FunctionInfo->SetArrayField(TEXT("outputs"), OutputsAdded);
+				FunctionsCreated.Add(MakeShared<FJsonValueObject>(FunctionInfo));
+			}
+		}
+
+		// One structural notification for the whole batch
+		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+	}
+
+	bool bCompiled = false;
+	double CompileTimeMs = 0.0;
+	if (bCompile)
+	{
+		const double CompileStart = FPlatformTime::Seconds();
+		FKismetEditorUtilities::CompileBlueprint(Blueprint);
+		CompileTimeMs = (FPlatformTime::Seconds() - CompileStart) * 1000.0;
+		bCompiled = Blueprint->Status != BS_Error;
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("FBlueprintScaffolder: Added %d variables and %d functions to %s (%d errors)"),
+		VariablesCreated.Num(), FunctionsCreated.Num(), *BlueprintName, Errors.Num());
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("blueprint_name"), BlueprintName);
+	Result->SetArrayField(TEXT("variables_created"), VariablesCreated);
+	Result->SetArrayField(TEXT("functions_created"), FunctionsCreated);
+	Result->SetArrayField(TEXT("errors"), Errors);
+	Result->SetBoolField(TEXT("compiled"), bCompiled);
+	if (bCompile)
+	{
+		Result->SetNumberField(TEXT("compile_time_ms"), CompileTimeMs);
+	}
+	return Result;
+}
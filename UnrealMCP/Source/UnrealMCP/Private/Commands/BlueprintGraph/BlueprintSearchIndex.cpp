@@ -0,0 +1,388 @@
+#include "Commands/BlueprintGraph/BlueprintSearchIndex.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "K2Node_CallFunction.h"
+#include "K2Node_Variable.h"
+#include "K2Node_VariableSet.h"
+#include "K2Node_Event.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "UObject/Package.h"
+#include "UObject/ObjectSaveContext.h"
+
+// A single indexed node
+struct FBlueprintSearchEntry
+{
+	FString GraphName;
+	FGuid NodeGuid;
+	FString NodeTitle;
+	FString NodeClass;
+	FString FunctionRef;
+	FString VariableRef;
+	bool bVariableWrite = false;
+	TArray<FString> PinTypes;
+};
+
+// All indexed nodes for one Blueprint, keyed by package name in the index
+struct FBlueprintSearchRecord
+{
+	FString BlueprintPath;
+	TArray<FBlueprintSearchEntry> Entries;
+};
+
+struct FBlueprintSearchIndexState
+{
+	TMap<FName, FBlueprintSearchRecord> Records;
+	bool bDelegatesRegistered = false;
+	FDelegateHandle PackageSavedHandle;
+	FDelegateHandle RemovedHandle;
+	FDelegateHandle RenamedHandle;
+};
+
+static FBlueprintSearchIndexState& GetIndexState()
+{
+	static FBlueprintSearchIndexState State;
+	return State;
+}
+
+// Compact textual pin type, e.g. "bool", "object:Actor", "struct:Vector"
+static FString DescribePinType(const FEdGraphPinType& PinType)
+{
+	FString Type = PinType.PinCategory.ToString();
+	if (const UObject* SubObject = PinType.PinSubCategoryObject.Get())
+	{
+		Type += TEXT(":") + SubObject->GetName();
+	}
+	else if (!PinType.PinSubCategory.IsNone())
+	{
+		Type += TEXT(":") + PinType.PinSubCategory.ToString();
+	}
+	if (PinType.IsArray())
+	{
+		Type = TEXT("array<") + Type + TEXT(">");
+	}
+	return Type;
+}
+
+void FBlueprintSearchIndex::IndexBlueprint(UBlueprint* Blueprint)
+{
+	if (!Blueprint)
+	{
+		return;
+	}
+
+	FBlueprintSearchRecord Record;
+	Record.BlueprintPath = Blueprint->GetPathName();
+
+	const FString SelfClassName = Blueprint->GeneratedClass ? Blueprint->GeneratedClass->GetName() : Blueprint->GetName();
+
+	TArray<UEdGraph*> Graphs;
+	Blueprint->GetAllGraphs(Graphs);
+
+	for (UEdGraph* Graph : Graphs)
+	{
+		if (!Graph)
+		{
+			continue;
+		}
+
+		for (UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (!Node)
+			{
+				continue;
+			}
+
+			FBlueprintSearchEntry& Entry = Record.Entries.AddDefaulted_GetRef();
+			Entry.GraphName = Graph->GetName();
+			Entry.NodeGuid = Node->NodeGuid;
+			Entry.NodeTitle = Node->GetNodeTitle(ENodeTitleType::ListView).ToString();
+			Entry.NodeClass = Node->GetClass()->GetName();
+
+			if (UK2Node_CallFunction* CallNode = Cast<UK2Node_CallFunction>(Node))
+			{
+				const UClass* OwnerClass = CallNode->FunctionReference.GetMemberParentClass();
+				const FString OwnerName = OwnerClass ? OwnerClass->GetName() : SelfClassName;
+				Entry.FunctionRef = FString::Printf(TEXT("%s.%s"), *OwnerName, *CallNode->FunctionReference.GetMemberName().ToString());
+			}
+			else if (UK2Node_Event* EventNode = Cast<UK2Node_Event>(Node))
+			{
+				const FName EventName = EventNode->CustomFunctionName.IsNone()
+					? EventNode->EventReference.GetMemberName()
+					: EventNode->CustomFunctionName;
+				Entry.FunctionRef = FString::Printf(TEXT("%s.%s"), *SelfClassName, *EventName.ToString());
+			}
+			else if (UK2Node_Variable* VariableNode = Cast<UK2Node_Variable>(Node))
+			{
+				Entry.VariableRef = VariableNode->VariableReference.GetMemberName().ToString();
+				Entry.bVariableWrite = Node->IsA<UK2Node_VariableSet>();
+			}
+
+			for (UEdGraphPin* Pin : Node->Pins)
+			{
+				if (Pin && !Pin->bHidden)
+				{
+					Entry.PinTypes.AddUnique(DescribePinType(Pin->PinType));
+				}
+			}
+		}
+	}
+
+	GetIndexState().Records.Add(Blueprint->GetOutermost()->GetFName(), MoveTemp(Record));
+}
+
+void FBlueprintSearchIndex::OnPackageSaved(const FString& PackageFileName, UPackage* Package)
+{
+	if (!Package)
+	{
+		return;
+	}
+
+	// Only refresh Blueprints we have indexed before; others are picked up lazily on the next query
+	if (!GetIndexState().Records.Contains(Package->GetFName()))
+	{
+		return;
+	}
+
+	ForEachObjectWithPackage(Package, [](UObject* Object)
+	{
+		if (UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+		{
+			IndexBlueprint(Blueprint);
+		}
+		return true;
+	}, false);
+}
+
+void FBlueprintSearchIndex::EnsureDelegatesRegistered()
+{
+	FBlueprintSearchIndexState& State = GetIndexState();
+	if (State.bDelegatesRegistered)
+	{
+		return;
+	}
+	State.bDelegatesRegistered = true;
+
+	State.PackageSavedHandle = UPackage::PackageSavedWithContextEvent.AddLambda(
+		[](const FString& PackageFileName, UPackage* Package, FObjectPostSaveContext)
+		{
+			OnPackageSaved(PackageFileName, Package);
+		});
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+	State.RemovedHandle = AssetRegistry.OnAssetRemoved().AddLambda([](const FAssetData& AssetData)
+	{
+		GetIndexState().Records.Remove(AssetData.PackageName);
+	});
+	State.RenamedHandle = AssetRegistry.OnAssetRenamed().AddLambda([](const FAssetData& AssetData, const FString& OldObjectPath)
+	{
+		GetIndexState().Records.Remove(FName(*FPackageName::ObjectPathToPackageName(OldObjectPath)));
+	});
+}
+
+void FBlueprintSearchIndex::UnregisterDelegates()
+{
+	FBlueprintSearchIndexState& State = GetIndexState();
+	if (!State.bDelegatesRegistered)
+	{
+		return;
+	}
+	State.bDelegatesRegistered = false;
+
+	UPackage::PackageSavedWithContextEvent.Remove(State.PackageSavedHandle);
+
+	// The asset registry may already be gone during editor shutdown
+	if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+	{
+		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+		AssetRegistry.OnAssetRemoved().Remove(State.RemovedHandle);
+		AssetRegistry.OnAssetRenamed().Remove(State.RenamedHandle);
+	}
+	State.PackageSavedHandle.Reset();
+	State.RemovedHandle.Reset();
+	State.RenamedHandle.Reset();
+}
+
+int32 FBlueprintSearchIndex::RefreshPath(const FString& SearchPath, bool bForceRebuild)
+{
+	FBlueprintSearchIndexState& State = GetIndexState();
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.PackagePaths.Add(*SearchPath);
+	Filter.bRecursivePaths = true;
+
+	TArray<FAssetData> AssetDataArray;
+	FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get().GetAssets(Filter, AssetDataArray);
+
+	int32 IndexedCount = 0;
+	for (const FAssetData& AssetData : AssetDataArray)
+	{
+		bool bNeedsIndex = bForceRebuild || !State.Records.Contains(AssetData.PackageName);
+		if (!bNeedsIndex)
+		{
+			// Unsaved edits are not covered by the save hook; re-index those on demand
+			UPackage* Package = FindPackage(nullptr, *AssetData.PackageName.ToString());
+			bNeedsIndex = Package && Package->IsDirty();
+		}
+
+		if (!bNeedsIndex)
+		{
+			continue;
+		}
+
+		if (UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset()))
+		{
+			IndexBlueprint(Blueprint);
+			IndexedCount++;
+		}
+	}
+
+	return IndexedCount;
+}
+
+bool FBlueprintSearchIndex::MatchesQuery(const FString& Value, const FString& Query, bool bWildcard)
+{
+	if (Value.IsEmpty())
+	{
+		return false;
+	}
+	return bWildcard ? Value.MatchesWildcard(Query, ESearchCase::IgnoreCase) : Value.Contains(Query, ESearchCase::IgnoreCase);
+}
+
+TSharedPtr<FJsonObject> FBlueprintSearchIndex::FindInBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+	FString Query;
+	if (!Params->TryGetStringField(TEXT("query"), Query) || Query.IsEmpty())
+	{
+		return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'query' parameter"));
+	}
+
+	FString SearchType = TEXT("all");
+	Params->TryGetStringField(TEXT("search_type"), SearchType);
+	SearchType.ToLowerInline();
+
+	if (SearchType != TEXT("all") && SearchType != TEXT("node") && SearchType != TEXT("function")
+		&& SearchType != TEXT("variable") && SearchType != TEXT("pin_type"))
+	{
+		return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+			FString::Printf(TEXT("Invalid search_type '%s'. Use all, node, function, variable or pin_type"), *SearchType));
+	}
+
+	FString VariableAccess = TEXT("any");
+	Params->TryGetStringField(TEXT("variable_access"), VariableAccess);
+	VariableAccess.ToLowerInline();
+
+	FString SearchPath = TEXT("/Game/");
+	Params->TryGetStringField(TEXT("search_path"), SearchPath);
+	if (!SearchPath.StartsWith(TEXT("/")))
+	{
+		SearchPath = TEXT("/") + SearchPath;
+	}
+	SearchPath.RemoveFromEnd(TEXT("/"));
+
+	int32 MaxResults = 200;
+	if (Params->HasField(TEXT("max_results")))
+	{
+		MaxResults = static_cast<int32>(Params->GetNumberField(TEXT("max_results")));
+	}
+
+	bool bRebuild = false;
+	Params->TryGetBoolField(TEXT("rebuild"), bRebuild);
+
+	EnsureDelegatesRegistered();
+
+	const double StartTime = FPlatformTime::Seconds();
+	const int32 IndexedCount = RefreshPath(SearchPath, bRebuild);
+	const double IndexTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	const bool bWildcard = Query.Contains(TEXT("*")) || Query.Contains(TEXT("?"));
+	const bool bAll = SearchType == TEXT("all");
+	const FString PathPrefix = SearchPath + TEXT("/");
+
+	TArray<TSharedPtr<FJsonValue>> Matches;
+	int32 TotalMatches = 0;
+	int32 SearchedBlueprints = 0;
+
+	for (const TPair<FName, FBlueprintSearchRecord>& Pair : GetIndexState().Records)
+	{
+		if (!Pair.Key.ToString().StartsWith(PathPrefix))
+		{
+			continue;
+		}
+		SearchedBlueprints++;
+
+		const FBlueprintSearchRecord& Record = Pair.Value;
+		for (const FBlueprintSearchEntry& Entry : Record.Entries)
+		{
+			FString MatchType;
+			FString MatchValue;
+
+			if ((bAll || SearchType == TEXT("function")) && MatchesQuery(Entry.FunctionRef, Query, bWildcard))
+			{
+				MatchType = TEXT("function");
+				MatchValue = Entry.FunctionRef;
+			}
+			else if ((bAll || SearchType == TEXT("variable")) && MatchesQuery(Entry.VariableRef, Query, bWildcard)
+				&& (VariableAccess == TEXT("any") || Entry.bVariableWrite == (VariableAccess == TEXT("write"))))
+			{
+				MatchType = Entry.bVariableWrite ? TEXT("variable_write") : TEXT("variable_read");
+				MatchValue = Entry.VariableRef;
+			}
+			else if ((bAll || SearchType == TEXT("node"))
+				&& (MatchesQuery(Entry.NodeTitle, Query, bWildcard) || MatchesQuery(Entry.NodeClass, Query, bWildcard)))
+			{
+				MatchType = TEXT("node");
+				MatchValue = Entry.NodeTitle;
+			}
+			else if (bAll || SearchType == TEXT("pin_type"))
+			{
+				for (const FString& PinType : Entry.PinTypes)
+				{
+					if (MatchesQuery(PinType, Query, bWildcard))
+					{
+						MatchType = TEXT("pin_type");
+						MatchValue = PinType;
+						break;
+					}
+				}
+			}
+
+			if (MatchType.IsEmpty())
+			{
+				continue;
+			}
+
+			TotalMatches++;
+			if (Matches.Num() >= MaxResults)
+			{
+				continue;
+			}
+
+			TSharedPtr<FJsonObject> MatchObj = MakeShared<FJsonObject>();
+			MatchObj->SetStringField(TEXT("blueprint_path"), Record.BlueprintPath);
+			MatchObj->SetStringField(TEXT("graph"), Entry.GraphName);
+			MatchObj->SetStringField(TEXT("node_guid"), Entry.NodeGuid.ToString());
+			MatchObj->SetStringField(TEXT("node_title"), Entry.NodeTitle);
+			MatchObj->SetStringField(TEXT("node_class"), Entry.NodeClass);
+			MatchObj->SetStringField(TEXT("match_type"), MatchType);
+			MatchObj->SetStringField(TEXT("match"), MatchValue);
+			Matches.Add(MakeShared<FJsonValueObject>(MatchObj));
+		}
+	}
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("query"), Query);
+	Result->SetStringField(TEXT("search_type"), SearchType);
+	Result->SetArrayField(TEXT("matches"), Matches);
+	Result->SetNumberField(TEXT("count"), Matches.Num());
+	Result->SetNumberField(TEXT("total_matches"), TotalMatches);
+	Result->SetNumberField(TEXT("blueprints_searched"), SearchedBlueprints);
+	Result->SetNumberField(TEXT("blueprints_reindexed"), IndexedCount);
+	Result->SetNumberField(TEXT("index_time_ms"), IndexTimeMs);
+	return Result;
+}
@@ -142,7 +142,8 @@ bool FFunctionIO::AddFunctionParameter(
 	const FString& ParamName,
 	const FString& ParamType,
 	bool bIsInput,
-	bool bIsArray)
+	bool bIsArray,
+	bool bNotify)
 {
 	if (!Blueprint)
 	{
@@ -278,8 +279,11 @@ bool FFunctionIO::AddFunctionParameter(
 	}
 
 	// Update the function signature
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-	FunctionGraph->NotifyGraphChanged();
+	if (bNotify)
+	{
+		FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+		FunctionGraph->NotifyGraphChanged();
+	}
 
 	return true;
 }
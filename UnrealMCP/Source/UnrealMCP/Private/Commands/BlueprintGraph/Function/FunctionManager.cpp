@@ -1,6 +1,7 @@
 #include "Commands/BlueprintGraph/Function/FunctionManager.h"
 #include "Engine/Blueprint.h"
 #include "EdGraph/EdGraph.h"
+#include "EdGraphSchema_K2.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "EditorAssetLibrary.h"
@@ -45,15 +46,60 @@ TSharedPtr<FJsonObject> FFunctionManager::CreateFunction(const TSharedPtr<FJsonO
 		return CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
 	}
 
+	// Store current graph count to track which graph was created
+	int32 GraphCountBefore = Blueprint->FunctionGraphs.Num();
+
+	FString Error;
+	UEdGraph* NewGraph = CreateFunctionGraph(Blueprint, FunctionName, Error);
+	if (!NewGraph)
+	{
+		return CreateErrorResponse(Error);
+	}
+
+	// Mark Blueprint as modified
+	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+
+	// Compile the Blueprint AFTER verifying nodes (like GenBlueprintUtils does)
+	FKismetEditorUtilities::CompileBlueprint(Blueprint);
+
+	// Get the actual graph name that was created
+	FString ActualGraphName = NewGraph->GetFName().ToString();
+	if (Blueprint->FunctionGraphs.Num() > GraphCountBefore)
+	{
+		// Use the newly added graph's name
+		UEdGraph* CreatedGraph = Blueprint->FunctionGraphs[Blueprint->FunctionGraphs.Num() - 1];
+		if (CreatedGraph)
+		{
+			ActualGraphName = CreatedGraph->GetFName().ToString();
+		}
+	}
+
+	UE_LOG(LogTemp, Display, TEXT("Successfully created function '%s' with internal name '%s' in %s"), *FunctionName, *ActualGraphName, *BlueprintName);
+
+	return CreateSuccessResponse(FunctionName, ActualGraphName);
+}
+
+UEdGraph* FFunctionManager::CreateFunctionGraph(UBlueprint* Blueprint, const FString& FunctionName, FString& OutError, bool bDeferStructuralUpdate)
+{
+	if (!Blueprint)
+	{
+		OutError = TEXT("Invalid Blueprint");
+		return nullptr;
+	}
+
+	if (!ValidateFunctionName(FunctionName))
+	{
+		OutError = FString::Printf(TEXT("Invalid function name '%s': contains spaces or special characters"), *FunctionName);
+		return nullptr;
+	}
+
 	// Check if function already exists
 	if (FunctionExists(Blueprint, FunctionName))
 	{
-		return CreateErrorResponse(FString::Printf(TEXT("Function already exists: %s"), *FunctionName));
+		OutError = FString::Printf(TEXT("Function already exists: %s"), *FunctionName);
+		return nullptr;
 	}
 
-	// Store current graph count to track which graph was created
-	int32 GraphCountBefore = Blueprint->FunctionGraphs.Num();
-
 	// Create the function using FBlueprintEditorUtils
 	UEdGraph* NewGraph = FBlueprintEditorUtils::CreateNewGraph(
 		Blueprint,
@@ -64,11 +110,26 @@ TSharedPtr<FJsonObject> FFunctionManager::CreateFunction(const TSharedPtr<FJsonO
 
 	if (!NewGraph)
 	{
-		return CreateErrorResponse(TEXT("Failed to create function graph"));
+		OutError = TEXT("Failed to create function graph");
+		return nullptr;
 	}
 
-	// Add the function to the Blueprint (bIsUserCreated = true)
-	FBlueprintEditorUtils::AddFunctionGraph<UClass>(Blueprint, NewGraph, true, nullptr);
+	if (bDeferStructuralUpdate)
+	{
+		// AddFunctionGraph ends with MarkBlueprintAsStructurallyModified (skeleton recompile) on every call.
+		// Batched callers do the same setup here and notify once when they are done.
+		const UEdGraphSchema_K2* K2Schema = GetDefault<UEdGraphSchema_K2>();
+		K2Schema->CreateFunctionGraphTerminators(*NewGraph, static_cast<UClass*>(nullptr));
+		K2Schema->AddExtraFunctionFlags(NewGraph, (FUNC_BlueprintCallable | FUNC_BlueprintEvent | FUNC_Public));
+		K2Schema->MarkFunctionEntryAsEditable(NewGraph, true);
+		Blueprint->FunctionGraphs.Add(NewGraph);
+		FBlueprintEditorUtils::ValidateBlueprintChildVariables(Blueprint, NewGraph->GetFName());
+	}
+	else
+	{
+		// Add the function to the Blueprint (bIsUserCreated = true)
+		FBlueprintEditorUtils::AddFunctionGraph<UClass>(Blueprint, NewGraph, true, nullptr);
+	}
 
 	// Verify that FunctionEntry and FunctionResult nodes were created correctly
 	UK2Node_FunctionEntry* EntryNode = nullptr;
@@ -118,27 +179,7 @@ TSharedPtr<FJsonObject> FFunctionManager::CreateFunction(const TSharedPtr<FJsonO
 		}
 	}
 
-	// Mark Blueprint as modified
-	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
-
-	// Compile the Blueprint AFTER verifying nodes (like GenBlueprintUtils does)
-	FKismetEditorUtilities::CompileBlueprint(Blueprint);
-
-	// Get the actual graph name that was created
-	FString ActualGraphName = NewGraph->GetFName().ToString();
-	if (Blueprint->FunctionGraphs.Num() > GraphCountBefore)
-	{
-		// Use the newly added graph's name
-		UEdGraph* CreatedGraph = Blueprint->FunctionGraphs[Blueprint->FunctionGraphs.Num() - 1];
-		if (CreatedGraph)
-		{
-			ActualGraphName = CreatedGraph->GetFName().ToString();
-		}
-	}
-
-	UE_LOG(LogTemp, Display, TEXT("Successfully created function '%s' with internal name '%s' in %s"), *FunctionName, *ActualGraphName, *BlueprintName);
-
-	return CreateSuccessResponse(FunctionName, ActualGraphName);
+	return NewGraph;
 }
 
 TSharedPtr<FJsonObject> FFunctionManager::DeleteFunction(const TSharedPtr<FJsonObject>& Params)
@@ -0,0 +1,447 @@
+#include "Commands/BlueprintGraph/GraphLayout.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Engine/Blueprint.h"
+#include "EdGraph/EdGraph.h"
+#include "EdGraph/EdGraphNode.h"
+#include "EdGraph/EdGraphPin.h"
+#include "EdGraphNode_Comment.h"
+#include "EdGraphSchema_K2.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "ScopedTransaction.h"
+
+int32 FBlueprintGraphLayout::ApplyLayout(UEdGraph* Graph, const FBlueprintGraphLayoutSettings& Settings, int32* OutLayerCount)
+{
+	if (OutLayerCount)
+	{
+		*OutLayerCount = 0;
+	}
+
+	if (!Graph)
+	{
+		return 0;
+	}
+
+	// Flatten the graph into index-based adjacency lists
+	TArray<UEdGraphNode*> Nodes;
+	TMap<UEdGraphNode*, int32> NodeIndices;
+	for (UEdGraphNode* Node : Graph->Nodes)
+	{
+		if (Node && !Node->IsA<UEdGraphNode_Comment>())
+		{
+			NodeIndices.Add(Node, Nodes.Add(Node));
+		}
+	}
+
+	const int32 NumNodes = Nodes.Num();
+	if (NumNodes == 0)
+	{
+		return 0;
+	}
+
+	TArray<TArray<int32>> ExecSuccessors;
+	TArray<TArray<int32>> ExecPredecessors;
+	TArray<TArray<int32>> DataInputs;
+	TArray<bool> bHasExecPins;
+	TArray<bool> bHasDataConsumer;
+	TArray<float> Heights;
+	ExecSuccessors.SetNum(NumNodes);
+	ExecPredecessors.SetNum(NumNodes);
+	DataInputs.SetNum(NumNodes);
+	bHasExecPins.Init(false, NumNodes);
+	bHasDataConsumer.Init(false, NumNodes);
+	Heights.Init(0.0f, NumNodes);
+
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		int32 VisibleInputs = 0;
+		int32 VisibleOutputs = 0;
+
+		for (UEdGraphPin* Pin : Nodes[NodeIndex]->Pins)
+		{
+			if (!Pin)
+			{
+				continue;
+			}
+
+			const bool bExecPin = Pin->PinType.PinCategory == UEdGraphSchema_K2::PC_Exec;
+			bHasExecPins[NodeIndex] |= bExecPin;
+
+			if (!Pin->bHidden && Pin->Direction == EGPD_Input)
+			{
+				++VisibleInputs;
+			}
+			else if (!Pin->bHidden)
+			{
+				++VisibleOutputs;
+			}
+
+			for (UEdGraphPin* LinkedPin : Pin->LinkedTo)
+			{
+				const int32* OtherIndex = LinkedPin ? NodeIndices.Find(LinkedPin->GetOwningNode()) : nullptr;
+				if (!OtherIndex || *OtherIndex == NodeIndex)
+				{
+					continue;
+				}
+
+				if (bExecPin && Pin->Direction == EGPD_Output)
+				{
+					ExecSuccessors[NodeIndex].Add(*OtherIndex);
+					ExecPredecessors[*OtherIndex].Add(NodeIndex);
+				}
+				else if (!bExecPin && Pin->Direction == EGPD_Input)
+				{
+					DataInputs[NodeIndex].Add(*OtherIndex);
+					bHasDataConsumer[*OtherIndex] = true;
+				}
+			}
+		}
+
+		// Approximate the rendered height from the pin rows
+		Heights[NodeIndex] = 48.0f + 26.0f * FMath::Max(VisibleInputs, VisibleOutputs);
+	}
+
+	// The layered backbone: every node with exec pins, plus pure nodes nobody consumes
+	TArray<bool> bBackbone;
+	bBackbone.SetNum(NumNodes);
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		bBackbone[NodeIndex] = bHasExecPins[NodeIndex] || !bHasDataConsumer[NodeIndex];
+	}
+
+	// Longest-path layering over exec links (Kahn). Exec cycles are broken by forcing the
+	// first unresolved node, placing it after whichever predecessors are already layered.
+	TArray<int32> Layers;
+	TArray<int32> InDegrees;
+	TArray<bool> bQueued;
+	Layers.Init(0, NumNodes);
+	InDegrees.SetNum(NumNodes);
+	bQueued.Init(false, NumNodes);
+
+	TArray<int32> Queue;
+	Queue.Reserve(NumNodes);
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		InDegrees[NodeIndex] = ExecPredecessors[NodeIndex].Num();
+		if (bBackbone[NodeIndex] && InDegrees[NodeIndex] == 0)
+		{
+			bQueued[NodeIndex] = true;
+			Queue.Add(NodeIndex);
+		}
+	}
+
+	int32 QueueHead = 0;
+	int32 ForceCursor = 0;
+	while (true)
+	{
+		while (QueueHead < Queue.Num())
+		{
+			const int32 Current = Queue[QueueHead++];
+			for (int32 Successor : ExecSuccessors[Current])
+			{
+				if (bQueued[Successor])
+				{
+					continue;
+				}
+
+				Layers[Successor] = FMath::Max(Layers[Successor], Layers[Current] + 1);
+				if (--InDegrees[Successor] <= 0)
+				{
+					bQueued[Successor] = true;
+					Queue.Add(Successor);
+				}
+			}
+		}
+
+		while (ForceCursor < NumNodes && (!bBackbone[ForceCursor] || bQueued[ForceCursor]))
+		{
+			++ForceCursor;
+		}
+		if (ForceCursor >= NumNodes)
+		{
+			break;
+		}
+
+		bQueued[ForceCursor] = true;
+		Queue.Add(ForceCursor);
+	}
+
+	int32 NumLayers = 0;
+	for (int32 NodeIndex : Queue)
+	{
+		NumLayers = FMath::Max(NumLayers, Layers[NodeIndex] + 1);
+	}
+
+	// Bucket backbone nodes by layer, seeded in the author's vertical order
+	TArray<int32> SeedOrder = Queue;
+	SeedOrder.StableSort([&Nodes](int32 A, int32 B)
+	{
+		return Nodes[A]->NodePosY < Nodes[B]->NodePosY;
+	});
+
+	TArray<TArray<int32>> LayerMembers;
+	LayerMembers.SetNum(NumLayers);
+	for (int32 NodeIndex : SeedOrder)
+	{
+		LayerMembers[Layers[NodeIndex]].Add(NodeIndex);
+	}
+
+	// Attach every pure node to its nearest consumer on the backbone (BFS along data links)
+	TArray<int32> Anchors;
+	TArray<int32> Depths;
+	Anchors.Init(INDEX_NONE, NumNodes);
+	Depths.Init(0, NumNodes);
+
+	TArray<int32> DataQueue;
+	DataQueue.Reserve(NumNodes);
+	for (const TArray<int32>& Members : LayerMembers)
+	{
+		DataQueue.Append(Members);
+	}
+
+	for (int32 DataHead = 0; DataHead < DataQueue.Num(); ++DataHead)
+	{
+		const int32 Consumer = DataQueue[DataHead];
+		for (int32 Input : DataInputs[Consumer])
+		{
+			if (bBackbone[Input] || Anchors[Input] != INDEX_NONE)
+			{
+				continue;
+			}
+
+			Anchors[Input] = bBackbone[Consumer] ? Consumer : Anchors[Consumer];
+			Depths[Input] = bBackbone[Consumer] ? 1 : Depths[Consumer] + 1;
+			DataQueue.Add(Input);
+		}
+	}
+
+	// Stack each anchor's pure nodes per depth column; the block height drives vertical spacing
+	TArray<float> BlockHeights = Heights;
+	TArray<float> DataOffsetsY;
+	TArray<int32> LayerDataDepths;
+	DataOffsetsY.Init(0.0f, NumNodes);
+	LayerDataDepths.Init(0, NumLayers);
+
+	TMap<int32, TArray<float>> ColumnHeights;
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		const int32 Anchor = Anchors[NodeIndex];
+		if (Anchor == INDEX_NONE)
+		{
+			continue;
+		}
+
+		TArray<float>& Columns = ColumnHeights.FindOrAdd(Anchor);
+		if (Columns.Num() <= Depths[NodeIndex])
+		{
+			Columns.SetNumZeroed(Depths[NodeIndex] + 1);
+		}
+
+		DataOffsetsY[NodeIndex] = Columns[Depths[NodeIndex]];
+		Columns[Depths[NodeIndex]] += Heights[NodeIndex] + Settings.SpacingY;
+
+		BlockHeights[Anchor] = FMath::Max(BlockHeights[Anchor], Columns[Depths[NodeIndex]] - Settings.SpacingY);
+		LayerDataDepths[Layers[Anchor]] = FMath::Max(LayerDataDepths[Layers[Anchor]], Depths[NodeIndex]);
+	}
+
+	// Horizontal position of each exec layer, leaving room for its data columns
+	TArray<float> LayerX;
+	LayerX.SetNum(NumLayers);
+	float CursorX = Settings.Origin.X;
+	for (int32 LayerIndex = 0; LayerIndex < NumLayers; ++LayerIndex)
+	{
+		CursorX += LayerDataDepths[LayerIndex] * Settings.DataSpacingX;
+		LayerX[LayerIndex] = CursorX;
+		CursorX += Settings.ExecSpacingX;
+	}
+
+	// Order each layer by the barycenter of its already placed predecessors, then place
+	// top to bottom, keeping a node level with its predecessors when there is room
+	TArray<float> PositionsY;
+	PositionsY.Init(0.0f, NumNodes);
+	TArray<float> SortKeys;
+	SortKeys.Init(0.0f, NumNodes);
+	TArray<bool> bHasBarycenter;
+	bHasBarycenter.Init(false, NumNodes);
+
+	for (int32 LayerIndex = 0; LayerIndex < NumLayers; ++LayerIndex)
+	{
+		TArray<int32>& Members = LayerMembers[LayerIndex];
+
+		for (int32 Position = 0; Position < Members.Num(); ++Position)
+		{
+			const int32 NodeIndex = Members[Position];
+			float Sum = 0.0f;
+			int32 Count = 0;
+			for (int32 Predecessor : ExecPredecessors[NodeIndex])
+			{
+				if (Layers[Predecessor] < LayerIndex)
+				{
+					Sum += PositionsY[Predecessor];
+					++Count;
+				}
+			}
+
+			bHasBarycenter[NodeIndex] = Count > 0;
+			SortKeys[NodeIndex] = Count > 0 ? Sum / Count : Settings.Origin.Y + Position;
+		}
+
+		if (LayerIndex > 0)
+		{
+			Members.StableSort([&SortKeys](int32 A, int32 B)
+			{
+				return SortKeys[A] < SortKeys[B];
+			});
+		}
+
+		float CursorY = Settings.Origin.Y;
+		for (int32 NodeIndex : Members)
+		{
+			const float Y = bHasBarycenter[NodeIndex] ? FMath::Max(CursorY, SortKeys[NodeIndex]) : CursorY;
+			PositionsY[NodeIndex] = Y;
+			CursorY = Y + BlockHeights[NodeIndex] + Settings.SpacingY;
+		}
+	}
+
+	// Commit positions
+	int32 PositionedCount = 0;
+	for (int32 NodeIndex = 0; NodeIndex < NumNodes; ++NodeIndex)
+	{
+		float X = 0.0f;
+		float Y = 0.0f;
+
+		if (bBackbone[NodeIndex])
+		{
+			X = LayerX[Layers[NodeIndex]];
+			Y = PositionsY[NodeIndex];
+		}
+		else if (Anchors[NodeIndex] != INDEX_NONE)
+		{
+			const int32 Anchor = Anchors[NodeIndex];
+			X = LayerX[Layers[Anchor]] - Depths[NodeIndex] * Settings.DataSpacingX;
+			Y = PositionsY[Anchor] + DataOffsetsY[NodeIndex];
+		}
+		else
+		{
+			continue;
+		}
+
+		const int32 NewX = FMath::RoundToInt(X);
+		const int32 NewY = FMath::RoundToInt(Y);
+		UEdGraphNode* Node = Nodes[NodeIndex];
+		if (Node->NodePosX != NewX || Node->NodePosY != NewY)
+		{
+			// Record the old position in the caller's transaction
+			Node->Modify();
+			Node->NodePosX = NewX;
+			Node->NodePosY = NewY;
+		}
+		++PositionedCount;
+	}
+
+	if (OutLayerCount)
+	{
+		*OutLayerCount = NumLayers;
+	}
+
+	return PositionedCount;
+}
+
+TSharedPtr<FJsonObject> FBlueprintGraphLayout::LayoutBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+	FString BlueprintName;
+	if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+	{
+		return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+	}
+
+	UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(BlueprintName);
+	if (!Blueprint)
+	{
+		return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Blueprint not found: %s"), *BlueprintName));
+	}
+
+	FBlueprintGraphLayoutSettings Settings;
+	double SpacingX = 0.0;
+	if (Params->TryGetNumberField(TEXT("spacing_x"), SpacingX) && SpacingX > 0.0)
+	{
+		Settings.ExecSpacingX = static_cast<float>(SpacingX);
+	}
+	double SpacingY = 0.0;
+	if (Params->TryGetNumberField(TEXT("spacing_y"), SpacingY) && SpacingY >= 0.0)
+	{
+		Settings.SpacingY = static_cast<float>(SpacingY);
+	}
+
+	bool bAllGraphs = false;
+	Params->TryGetBoolField(TEXT("all_graphs"), bAllGraphs);
+
+	FString FunctionName;
+	Params->TryGetStringField(TEXT("function_name"), FunctionName);
+
+	TArray<UEdGraph*> Graphs;
+	if (bAllGraphs)
+	{
+		Graphs.Append(Blueprint->UbergraphPages);
+		Graphs.Append(Blueprint->FunctionGraphs);
+	}
+	else if (!FunctionName.IsEmpty())
+	{
+		for (UEdGraph* FuncGraph : Blueprint->FunctionGraphs)
+		{
+			if (FuncGraph && FuncGraph->GetName().Equals(FunctionName, ESearchCase::IgnoreCase))
+			{
+				Graphs.Add(FuncGraph);
+				break;
+			}
+		}
+
+		if (Graphs.Num() == 0)
+		{
+			return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Function graph not found: %s"), *FunctionName));
+		}
+	}
+	else if (Blueprint->UbergraphPages.Num() > 0)
+	{
+		Graphs.Add(Blueprint->UbergraphPages[0]);
+	}
+	else
+	{
+		return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Blueprint has no event graph"));
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	TArray<TSharedPtr<FJsonValue>> GraphResults;
+	int32 TotalPositioned = 0;
+	FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "LayoutBlueprintGraph", "Layout Blueprint Graph"));
+	for (UEdGraph* Graph : Graphs)
+	{
+		if (!Graph)
+		{
+			continue;
+		}
+
+		int32 LayerCount = 0;
+		const int32 Positioned = ApplyLayout(Graph, Settings, &LayerCount);
+		TotalPositioned += Positioned;
+		Graph->NotifyGraphChanged();
+
+		TSharedPtr<FJsonObject> GraphObj = MakeShared<FJsonObject>();
+		GraphObj->SetStringField(TEXT("graph"), Graph->GetName());
+		GraphObj->SetNumberField(TEXT("nodes_positioned"), Positioned);
+		GraphObj->SetNumberField(TEXT("layers"), LayerCount);
+		GraphResults.Add(MakeShared<FJsonValueObject>(GraphObj));
+	}
+
+	const double LayoutTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
+
+	TSharedPtr<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetBoolField(TEXT("success"), true);
+	Result->SetStringField(TEXT("blueprint_name"), BlueprintName);
+	Result->SetArrayField(TEXT("graphs"), GraphResults);
+	Result->SetNumberField(TEXT("nodes_positioned"), TotalPositioned);
+	Result->SetNumberField(TEXT("layout_time_ms"), LayoutTimeMs);
+	return Result;
+}
@@ -21,6 +21,52 @@
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/KismetMathLibrary.h"
 
+const TMap<FName, FBlueprintNodeManager::FNodeCreatorFunc>& FBlueprintNodeManager::GetNodeCreatorRegistry()
+{
+	// FName keys compare case-insensitively, so one hash lookup replaces the per-type string comparisons
+	static TMap<FName, FNodeCreatorFunc> Registry;
+	if (Registry.Num() == 0)
+	{
+		// Control Flow Nodes
+		Registry.Add(TEXT("Branch"), &FControlFlowNodeCreator::CreateBranchNode);
+		Registry.Add(TEXT("Comparison"), &FControlFlowNodeCreator::CreateComparisonNode);
+		Registry.Add(TEXT("Switch"), &FControlFlowNodeCreator::CreateSwitchNode);
+		Registry.Add(TEXT("SwitchEnum"), &FControlFlowNodeCreator::CreateSwitchEnumNode);
+		Registry.Add(TEXT("SwitchInteger"), &FControlFlowNodeCreator::CreateSwitchIntegerNode);
+		Registry.Add(TEXT("ExecutionSequence"), &FControlFlowNodeCreator::CreateExecutionSequenceNode);
+
+		// Data Nodes
+		Registry.Add(TEXT("VariableGet"), &FDataNodeCreator::CreateVariableGetNode);
+		Registry.Add(TEXT("VariableSet"), &FDataNodeCreator::CreateVariableSetNode);
+		Registry.Add(TEXT("MakeArray"), &FDataNodeCreator::CreateMakeArrayNode);
+
+		// Utility Nodes
+		Registry.Add(TEXT("Print"), &FUtilityNodeCreator::CreatePrintNode);
+		Registry.Add(TEXT("CallFunction"), &FUtilityNodeCreator::CreateCallFunctionNode);
+		Registry.Add(TEXT("Select"), &FUtilityNodeCreator::CreateSelectNode);
+		Registry.Add(TEXT("SpawnActor"), &FUtilityNodeCreator::CreateSpawnActorNode);
+
+		// Casting Nodes
+		Registry.Add(TEXT("DynamicCast"), &FCastingNodeCreator::CreateDynamicCastNode);
+		Registry.Add(TEXT("ClassDynamicCast"), &FCastingNodeCreator::CreateClassDynamicCastNode);
+		Registry.Add(TEXT("CastByteToEnum"), &FCastingNodeCreator::CreateCastByteToEnumNode);
+
+		// Animation Nodes
+		Registry.Add(TEXT("Timeline"), &FAnimationNodeCreator::CreateTimelineNode);
+
+		// Specialized Nodes
+		Registry.Add(TEXT("GetDataTableRow"), &FSpecializedNodeCreator::CreateGetDataTableRowNode);
+		Registry.Add(TEXT("AddComponentByClass"), &FSpecializedNodeCreator::CreateAddComponentByClassNode);
+		Registry.Add(TEXT("Self"), &FSpecializedNodeCreator::CreateSelfNode);
+		Registry.Add(TEXT("ConstructObject"), &FSpecializedNodeCreator::CreateConstructObjectNode);
+		Registry.Add(TEXT("Knot"), &FSpecializedNodeCreator::CreateKnotNode);
+
+		// Event nodes (kept for backward compatibility - should use add_event_node)
+		Registry.Add(TEXT("Event"), [](UEdGraph* Graph, const TSharedPtr<FJsonObject>& NodeParams) -> UK2Node* { return CreateEventNode(Graph, NodeParams); });
+	}
+	return Registry;
+}
+
 TSharedPtr<FJsonObject> FBlueprintNodeManager::AddNode(const TSharedPtr<FJsonObject>& Params)
 {
 	// Validate parameters
@@ -112,112 +158,14 @@ TSharedPtr<FJsonObject> FBlueprintNodeManager::AddNode(const TSharedPtr<FJsonObj
 	}
 
 	// Create node based on type - routed to specialized node creators
-	UK2Node* NewNode = nullptr;
-
-	// Control Flow Nodes
-	if (NodeType.Equals(TEXT("Branch"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FControlFlowNodeCreator::CreateBranchNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("Comparison"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FControlFlowNodeCreator::CreateComparisonNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("Switch"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FControlFlowNodeCreator::CreateSwitchNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("SwitchEnum"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FControlFlowNodeCreator::CreateSwitchEnumNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("SwitchInteger"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FControlFlowNodeCreator::CreateSwitchIntegerNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("ExecutionSequence"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FControlFlowNodeCreator::CreateExecutionSequenceNode(Graph, NodeParams);
-	}
-	// Data Nodes
-	else if (NodeType.Equals(TEXT("VariableGet"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FDataNodeCreator::CreateVariableGetNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("VariableSet"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FDataNodeCreator::CreateVariableSetNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("MakeArray"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FDataNodeCreator::CreateMakeArrayNode(Graph, NodeParams);
-	}
-	// Utility Nodes
-	else if (NodeType.Equals(TEXT("Print"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FUtilityNodeCreator::CreatePrintNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("CallFunction"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FUtilityNodeCreator::CreateCallFunctionNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("Select"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FUtilityNodeCreator::CreateSelectNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("SpawnActor"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FUtilityNodeCreator::CreateSpawnActorNode(Graph, NodeParams);
-	}
-	// Casting Nodes
-	else if (NodeType.Equals(TEXT("DynamicCast"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FCastingNodeCreator::CreateDynamicCastNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("ClassDynamicCast"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FCastingNodeCreator::CreateClassDynamicCastNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("CastByteToEnum"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FCastingNodeCreator::CreateCastByteToEnumNode(Graph, NodeParams);
-	}
-	// Animation Nodes
-	else if (NodeType.Equals(TEXT("Timeline"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FAnimationNodeCreator::CreateTimelineNode(Graph, NodeParams);
-	}
-	// Specialized Nodes
-	else if (NodeType.Equals(TEXT("GetDataTableRow"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FSpecializedNodeCreator::CreateGetDataTableRowNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("AddComponentByClass"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FSpecializedNodeCreator::CreateAddComponentByClassNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("Self"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FSpecializedNodeCreator::CreateSelfNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("ConstructObject"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FSpecializedNodeCreator::CreateConstructObjectNode(Graph, NodeParams);
-	}
-	else if (NodeType.Equals(TEXT("Knot"), ESearchCase::IgnoreCase))
-	{
-		NewNode = FSpecializedNodeCreator::CreateKnotNode(Graph, NodeParams);
-	}
-	// Event nodes (kept for backward compatibility - should use add_event_node)
-	else if (NodeType.Equals(TEXT("Event"), ESearchCase::IgnoreCase))
-	{
-		NewNode = CreateEventNode(Graph, NodeParams);
-	}
-	else
+	const FNodeCreatorFunc* Creator = GetNodeCreatorRegistry().Find(FName(*NodeType, FNAME_Find));
+	if (!Creator)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Unknown node type: %s"), *NodeType));
 	}
 
+	UK2Node* NewNode = (*Creator)(Graph, NodeParams);
+
 	if (!NewNode)
 	{
 		return CreateErrorResponse(FString::Printf(TEXT("Failed to create %s node"), *NodeType));
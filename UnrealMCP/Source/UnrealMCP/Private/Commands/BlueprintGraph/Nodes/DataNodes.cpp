@@ -1,5 +1,6 @@
 #include "Commands/BlueprintGraph/Nodes/DataNodes.h"
 #include "Commands/BlueprintGraph/Nodes/NodeCreatorUtils.h"
+#include "Commands/BlueprintGraph/Nodes/NodeTemplateCache.h"
 #include "K2Node_VariableGet.h"
 #include "K2Node_VariableSet.h"
 #include "K2Node_MakeArray.h"
@@ -32,7 +33,7 @@ UK2Node* FDataNodeCreator::CreateVariableGetNode(UEdGraph* Graph, const TSharedP
 	VarGetNode->NodePosY = static_cast<int32>(PosY);
 
 	Graph->AddNode(VarGetNode, true, false);
-	FNodeCreatorUtils::InitializeK2Node(VarGetNode, Graph);
+	FNodeTemplateCache::InitializeSpawnedNode(VarGetNode, Graph);
 
 	return VarGetNode;
 }
@@ -64,7 +65,7 @@ UK2Node* FDataNodeCreator::CreateVariableSetNode(UEdGraph* Graph, const TSharedP
 	VarSetNode->NodePosY = static_cast<int32>(PosY);
 
 	Graph->AddNode(VarSetNode, true, false);
-	FNodeCreatorUtils::InitializeK2Node(VarSetNode, Graph);
+	FNodeTemplateCache::InitializeSpawnedNode(VarSetNode, Graph);
 
 	return VarSetNode;
 }
@@ -0,0 +1,87 @@
+#include "Commands/BlueprintGraph/Nodes/NodeTemplateCache.h"
+#include "K2Node.h"
+#include "EdGraph/EdGraph.h"
+#include "UObject/ObjectKey.h"
+
+static TMap<FString, TWeakObjectPtr<UClass>>& GetClassCache()
+{
+	static TMap<FString, TWeakObjectPtr<UClass>> ClassCache;
+	return ClassCache;
+}
+
+static TMap<TPair<FObjectKey, FName>, TWeakObjectPtr<UFunction>>& GetFunctionCache()
+{
+	static TMap<TPair<FObjectKey, FName>, TWeakObjectPtr<UFunction>> FunctionCache;
+	return FunctionCache;
+}
+
+UClass* FNodeTemplateCache::ResolveClass(const FString& ClassName)
+{
+	if (ClassName.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FString CacheKey = ClassName.ToLower();
+	if (const TWeakObjectPtr<UClass>* Cached = GetClassCache().Find(CacheKey))
+	{
+		if (UClass* CachedClass = Cached->Get())
+		{
+			return CachedClass;
+		}
+	}
+
+	UClass* FoundClass = Cast<UClass>(StaticFindObject(UClass::StaticClass(), nullptr, *ClassName));
+	if (!FoundClass && !ClassName.Contains(TEXT(".")))
+	{
+		FoundClass = FindFirstObject<UClass>(*ClassName, EFindFirstObjectOptions::NativeFirst);
+
+		// Accept C++ style names ("UKismetMathLibrary", "AActor")
+		if (!FoundClass && ClassName.Len() > 1 && (ClassName[0] == TEXT('U') || ClassName[0] == TEXT('A')) && FChar::IsUpper(ClassName[1]))
+		{
+			FoundClass = FindFirstObject<UClass>(*ClassName.RightChop(1), EFindFirstObjectOptions::NativeFirst);
+		}
+	}
+
+	if (FoundClass)
+	{
+		GetClassCache().Add(CacheKey, FoundClass);
+	}
+	return FoundClass;
+}
+
+UFunction* FNodeTemplateCache::ResolveFunction(UClass* Class, FName FunctionName)
+{
+	if (!Class || FunctionName.IsNone())
+	{
+		return nullptr;
+	}
+
+	const TPair<FObjectKey, FName> CacheKey(FObjectKey(Class), FunctionName);
+	if (const TWeakObjectPtr<UFunction>* Cached = GetFunctionCache().Find(CacheKey))
+	{
+		if (UFunction* CachedFunction = Cached->Get())
+		{
+			return CachedFunction;
+		}
+	}
+
+	UFunction* FoundFunction = Class->FindFunctionByName(FunctionName);
+	if (FoundFunction)
+	{
+		GetFunctionCache().Add(CacheKey, FoundFunction);
+	}
+	return FoundFunction;
+}
+
+void FNodeTemplateCache::InitializeSpawnedNode(UK2Node* Node, UEdGraph* Graph)
+{
+	if (!Node || !Graph)
+	{
+		return;
+	}
+
+	Node->CreateNewGuid();
+	Node->PostPlacedNewNode();
+	Node->AllocateDefaultPins();
+}
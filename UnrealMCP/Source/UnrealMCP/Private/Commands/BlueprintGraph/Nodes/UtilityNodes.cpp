@@ -1,5 +1,6 @@
 #include "Commands/BlueprintGraph/Nodes/UtilityNodes.h"
 #include "Commands/BlueprintGraph/Nodes/NodeCreatorUtils.h"
+#include "Commands/BlueprintGraph/Nodes/NodeTemplateCache.h"
 #include "K2Node_CallFunction.h"
 #include "K2Node_Select.h"
 #include "K2Node_SpawnActorFromClass.h"
@@ -20,7 +21,8 @@ UK2Node* FUtilityNodeCreator::CreatePrintNode(UEdGraph* Graph, const TSharedPtr<
 		return nullptr;
 	}
 
-	UFunction* PrintFunc = UKismetSystemLibrary::StaticClass()->FindFunctionByName(
+	UFunction* PrintFunc = FNodeTemplateCache::ResolveFunction(
+		UKismetSystemLibrary::StaticClass(),
 		GET_FUNCTION_NAME_CHECKED(UKismetSystemLibrary, PrintString)
 	);
 
@@ -38,7 +40,7 @@ UK2Node* FUtilityNodeCreator::CreatePrintNode(UEdGraph* Graph, const TSharedPtr<
 	PrintNode->NodePosY = static_cast<int32>(PosY);
 
 	Graph->AddNode(PrintNode, true, false);
-	FNodeCreatorUtils::InitializeK2Node(PrintNode, Graph);
+	FNodeTemplateCache::InitializeSpawnedNode(PrintNode, Graph);
 
 	// Set message if provided AFTER initialization
 	FString Message;
@@ -79,16 +81,12 @@ UK2Node* FUtilityNodeCreator::CreateCallFunctionNode(UEdGraph* Graph, const TSha
 	FString ClassName;
 	if (Params->TryGetStringField(TEXT("target_class"), ClassName))
 	{
-		UClass* TargetClass = Cast<UClass>(StaticFindObject(UClass::StaticClass(), nullptr, *ClassName));
-		if (TargetClass)
-		{
-			TargetFunc = TargetClass->FindFunctionByName(FName(*TargetFunction));
-		}
+		TargetFunc = FNodeTemplateCache::ResolveFunction(FNodeTemplateCache::ResolveClass(ClassName), FName(*TargetFunction));
 	}
 	else
 	{
 		// Try common Unreal classes
-		TargetFunc = UKismetSystemLibrary::StaticClass()->FindFunctionByName(FName(*TargetFunction));
+		TargetFunc = FNodeTemplateCache::ResolveFunction(UKismetSystemLibrary::StaticClass(), FName(*TargetFunction));
 	}
 
 	if (!TargetFunc)
@@ -105,7 +103,7 @@ UK2Node* FUtilityNodeCreator::CreateCallFunctionNode(UEdGraph* Graph, const TSha
 	CallNode->NodePosY = static_cast<int32>(PosY);
 
 	Graph->AddNode(CallNode, true, false);
-	FNodeCreatorUtils::InitializeK2Node(CallNode, Graph);
+	FNodeTemplateCache::InitializeSpawnedNode(CallNode, Graph);
 
 	return CallNode;
 }
@@ -1,5 +1,6 @@
 #include "Commands/EpicUnrealMCPBlueprintCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/MaterialGraph/MaterialVariantCache.h"
 #include "Engine/Blueprint.h"
 #include "Engine/BlueprintGeneratedClass.h"
 #include "Factories/BlueprintFactory.h"
@@ -19,12 +20,15 @@
 #include "Engine/Engine.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "Kismet2/KismetEditorUtilities.h"
+#include "Kismet2/CompilerResultsLog.h"
+#include "BlueprintCompilationManager.h"
 #include "Engine/SimpleConstructionScript.h"
 #include "Engine/SCS_Node.h"
 #include "UObject/Field.h"
 #include "UObject/FieldPath.h"
 #include "EditorAssetLibrary.h"
 #include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
 #include "GameFramework/Actor.h"
 #include "GameFramework/Pawn.h"
 #include "Kismet/GameplayStatics.h"
@@ -51,6 +55,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCommand(const FSt
     {
         return HandleCompileBlueprint(Params);
     }
+    else if (CommandType == TEXT("compile_blueprints"))
+    {
+        return HandleCompileBlueprints(Params);
+    }
     else if (CommandType == TEXT("set_static_mesh_properties"))
     {
         return HandleSetStaticMeshProperties(Params);
@@ -399,6 +407,229 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCompileBlueprint(
     return ResultObj;
 }
 
+// Helper to describe a Blueprint status for JSON output
+static FString BlueprintStatusToString(EBlueprintStatus Status)
+{
+    switch (Status)
+    {
+    case BS_Dirty: return TEXT("dirty");
+    case BS_Error: return TEXT("error");
+    case BS_UpToDate: return TEXT("up_to_date");
+    case BS_BeingCreated: return TEXT("being_created");
+    case BS_UpToDateWithWarnings: return TEXT("up_to_date_with_warnings");
+    default: return TEXT("unknown");
+    }
+}
+
+// After a queued compile the per-Blueprint results log is not handed back to the caller,
+// but the compiler stamps its messages onto the offending nodes. Harvest them from there.
+static void CollectNodeCompilerMessages(UBlueprint* Blueprint, TArray<TSharedPtr<FJsonValue>>& OutErrors, TArray<TSharedPtr<FJsonValue>>& OutWarnings)
+{
+    TArray<UEdGraph*> Graphs;
+    Blueprint->GetAllGraphs(Graphs);
+
+    for (UEdGraph* Graph : Graphs)
+    {
+        if (!Graph)
+        {
+            continue;
+        }
+
+        for (UEdGraphNode* Node : Graph->Nodes)
+        {
+            if (!Node || !Node->bHasCompilerMessage)
+            {
+                continue;
+            }
+
+            TSharedPtr<FJsonObject> MessageObj = MakeShared<FJsonObject>();
+            MessageObj->SetStringField(TEXT("message"), Node->ErrorMsg);
+            MessageObj->SetStringField(TEXT("graph"), Graph->GetName());
+            MessageObj->SetStringField(TEXT("node"), Node->GetNodeTitle(ENodeTitleType::ListView).ToString());
+            MessageObj->SetStringField(TEXT("node_guid"), Node->NodeGuid.ToString());
+
+            if (Node->ErrorType <= EMessageSeverity::Error)
+            {
+                OutErrors.Add(MakeShared<FJsonValueObject>(MessageObj));
+            }
+            else if (Node->ErrorType <= EMessageSeverity::Warning)
+            {
+                OutWarnings.Add(MakeShared<FJsonValueObject>(MessageObj));
+            }
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleCompileBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    const TArray<TSharedPtr<FJsonValue>>* NamesArray = nullptr;
+    Params->TryGetArrayField(TEXT("blueprint_names"), NamesArray);
+
+    FString FolderPath;
+    Params->TryGetStringField(TEXT("folder_path"), FolderPath);
+
+    if ((!NamesArray || NamesArray->Num() == 0) && FolderPath.IsEmpty())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide 'blueprint_names' and/or 'folder_path'"));
+    }
+
+    // Batch mode lets the compilation manager order the whole set by dependency and reinstance once.
+    // Sequential mode compiles one at a time, which is slower but yields exact per-Blueprint timings.
+    bool bBatch = true;
+    Params->TryGetBoolField(TEXT("batch"), bBatch);
+
+    TArray<UBlueprint*> Blueprints;
+    TSet<UBlueprint*> SeenBlueprints;
+    TArray<TSharedPtr<FJsonValue>> NotFound;
+
+    if (NamesArray)
+    {
+        for (const TSharedPtr<FJsonValue>& NameValue : *NamesArray)
+        {
+            const FString Name = NameValue->AsString();
+            UBlueprint* Blueprint = FEpicUnrealMCPCommonUtils::FindBlueprint(Name);
+            if (!Blueprint)
+            {
+                NotFound.Add(MakeShared<FJsonValueString>(Name));
+                continue;
+            }
+
+            if (!SeenBlueprints.Contains(Blueprint))
+            {
+                SeenBlueprints.Add(Blueprint);
+                Blueprints.Add(Blueprint);
+            }
+        }
+    }
+
+    if (!FolderPath.IsEmpty())
+    {
+        if (!FolderPath.StartsWith(TEXT("/")))
+        {
+            FolderPath = TEXT("/") + FolderPath;
+        }
+        FolderPath.RemoveFromEnd(TEXT("/"));
+
+        bool bRecursive = true;
+        Params->TryGetBoolField(TEXT("recursive"), bRecursive);
+
+        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
+
+        FARFilter Filter;
+        Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+        Filter.bRecursiveClasses = true;
+        Filter.PackagePaths.Add(*FolderPath);
+        Filter.bRecursivePaths = bRecursive;
+
+        TArray<FAssetData> AssetDataArray;
+        AssetRegistryModule.Get().GetAssets(Filter, AssetDataArray);
+
+        for (const FAssetData& AssetData : AssetDataArray)
+        {
+            UBlueprint* Blueprint = Cast<UBlueprint>(AssetData.GetAsset());
+            if (Blueprint && !SeenBlueprints.Contains(Blueprint))
+            {
+                SeenBlueprints.Add(Blueprint);
+                Blueprints.Add(Blueprint);
+            }
+        }
+    }
+
+    if (Blueprints.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No Blueprints found to compile"));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("HandleCompileBlueprints: Compiling %d Blueprints (%s)"),
+        Blueprints.Num(), bBatch ? TEXT("batch") : TEXT("sequential"));
+
+    TArray<TSharedPtr<FJsonValue>> ResultsArray;
+    int32 TotalErrors = 0;
+    int32 TotalWarnings = 0;
+    int32 FailedCount = 0;
+    const double StartTime = FPlatformTime::Seconds();
+
+    if (bBatch)
+    {
+        for (UBlueprint* Blueprint : Blueprints)
+        {
+            FBlueprintCompilationManager::QueueForCompilation(Blueprint);
+        }
+        FBlueprintCompilationManager::FlushCompilationQueueAndReinstance();
+    }
+
+    for (UBlueprint* Blueprint : Blueprints)
+    {
+        TArray<TSharedPtr<FJsonValue>> Errors;
+        TArray<TSharedPtr<FJsonValue>> Warnings;
+
+        TSharedPtr<FJsonObject> EntryObj = MakeShared<FJsonObject>();
+        EntryObj->SetStringField(TEXT("name"), Blueprint->GetName());
+        EntryObj->SetStringField(TEXT("path"), Blueprint->GetPathName());
+
+        if (bBatch)
+        {
+            CollectNodeCompilerMessages(Blueprint, Errors, Warnings);
+        }
+        else
+        {
+            FCompilerResultsLog Results;
+            Results.bSilentMode = true;
+
+            const double BlueprintStart = FPlatformTime::Seconds();
+            FKismetEditorUtilities::CompileBlueprint(Blueprint, EBlueprintCompileOptions::None, &Results);
+            EntryObj->SetNumberField(TEXT("compile_time_ms"), (FPlatformTime::Seconds() - BlueprintStart) * 1000.0);
+
+            for (const TSharedRef<FTokenizedMessage>& Message : Results.Messages)
+            {
+                TSharedPtr<FJsonObject> MessageObj = MakeShared<FJsonObject>();
+                MessageObj->SetStringField(TEXT("message"), Message->ToText().ToString());
+
+                if (Message->GetSeverity() <= EMessageSeverity::Error)
+                {
+                    Errors.Add(MakeShared<FJsonValueObject>(MessageObj));
+                }
+                else if (Message->GetSeverity() <= EMessageSeverity::Warning)
+                {
+                    Warnings.Add(MakeShared<FJsonValueObject>(MessageObj));
+                }
+            }
+        }
+
+        const bool bCompiled = Blueprint->Status != BS_Error;
+        if (!bCompiled)
+        {
+            FailedCount++;
+        }
+        TotalErrors += Errors.Num();
+        TotalWarnings += Warnings.Num();
+
+        EntryObj->SetStringField(TEXT("status"), BlueprintStatusToString(Blueprint->Status));
+        EntryObj->SetBoolField(TEXT("compiled"), bCompiled);
+        EntryObj->SetArrayField(TEXT("errors"), Errors);
+        EntryObj->SetArrayField(TEXT("warnings"), Warnings);
+        ResultsArray.Add(MakeShared<FJsonValueObject>(EntryObj));
+    }
+
+    const double TotalTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetBoolField(TEXT("success"), true);
+    ResultObj->SetStringField(TEXT("mode"), bBatch ? TEXT("batch") : TEXT("sequential"));
+    ResultObj->SetArrayField(TEXT("blueprints"), ResultsArray);
+    ResultObj->SetNumberField(TEXT("count"), ResultsArray.Num());
+    ResultObj->SetNumberField(TEXT("failed_count"), FailedCount);
+    ResultObj->SetNumberField(TEXT("total_errors"), TotalErrors);
+    ResultObj->SetNumberField(TEXT("total_warnings"), TotalWarnings);
+    ResultObj->SetNumberField(TEXT("total_compile_time_ms"), TotalTimeMs);
+    if (NotFound.Num() > 0)
+    {
+        ResultObj->SetArrayField(TEXT("not_found"), NotFound);
+    }
+
+    return ResultObj;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSpawnBlueprintActor(const TSharedPtr<FJsonObject>& Params)
 {
     UE_LOG(LogTemp, Warning, TEXT("HandleSpawnBlueprintActor: Starting blueprint actor spawn"));
@@ -660,18 +891,48 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialCo
         }
     }
 
-    // Create a dynamic material instance
-    UMaterialInstanceDynamic* DynMaterial = UMaterialInstanceDynamic::Create(Material, PrimComponent);
-    if (!DynMaterial)
+    // Share one instance per (material, color) instead of a new dynamic instance per call
+    FString VariantModeName;
+    Params->TryGetStringField(TEXT("variant_mode"), VariantModeName);
+    EMaterialVariantMode VariantMode;
+    if (!FMaterialVariantCache::ParseMode(VariantModeName, VariantMode))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown variant_mode '%s' (use constant, dynamic or shared_dynamic)"), *VariantModeName));
+    }
+
+    // parameter_names sets the same color on several parameters (e.g. BaseColor and Color) in one variant
+    TArray<FString> ParameterNames;
+    Params->TryGetStringArrayField(TEXT("parameter_names"), ParameterNames);
+    if (ParameterNames.Num() == 0)
+    {
+        ParameterNames.Add(ParameterName);
+    }
+
+    FMaterialVariantParams VariantParams;
+    for (const FString& Name : ParameterNames)
+    {
+        VariantParams.VectorValues.Add(FName(*Name), Color);
+    }
+
+    // Saving writes a package to disk, so it is opt-in; an unsaved variant is saved along with the blueprint
+    bool bSaveVariant = false;
+    Params->TryGetBoolField(TEXT("save"), bSaveVariant);
+
+    // A dynamic variant is owned by the component template (or shared through the generated class), so it is saved with the blueprint
+    bool bVariantCreated = false;
+    FString VariantError;
+    UMaterialInterface* VariantMaterial = FMaterialVariantCache::GetOrCreate(
+        Material, VariantParams, VariantMode, FMaterialVariantCache::DefaultAssetFolder,
+        FMaterialVariantCache::GetDynamicOuter(PrimComponent, VariantMode), bVariantCreated, VariantError);
+    if (!VariantMaterial)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create dynamic material instance"));
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(VariantError);
     }
 
-    // Set the color parameter
-    DynMaterial->SetVectorParameterValue(*ParameterName, Color);
+    const bool bVariantSaved = bSaveVariant && FMaterialVariantCache::SaveVariant(VariantMaterial);
 
     // Apply the material to the component
-    PrimComponent->SetMaterial(MaterialSlot, DynMaterial);
+    PrimComponent->SetMaterial(MaterialSlot, VariantMaterial);
 
     // Mark the blueprint as modified
     FBlueprintEditorUtils::MarkBlueprintAsModified(Blueprint);
@@ -683,7 +944,7 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialCo
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetStringField(TEXT("component"), ComponentName);
     ResultObj->SetNumberField(TEXT("material_slot"), MaterialSlot);
-    ResultObj->SetStringField(TEXT("parameter_name"), ParameterName);
+    ResultObj->SetStringField(TEXT("parameter_name"), ParameterNames[0]);
     
     TArray<TSharedPtr<FJsonValue>> ColorResultArray;
     ColorResultArray.Add(MakeShared<FJsonValueNumber>(Color.R));
@@ -691,11 +952,39 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleSetMeshMaterialCo
     ColorResultArray.Add(MakeShared<FJsonValueNumber>(Color.B));
     ColorResultArray.Add(MakeShared<FJsonValueNumber>(Color.A));
     ResultObj->SetArrayField(TEXT("color"), ColorResultArray);
+    ResultObj->SetStringField(TEXT("variant_path"), VariantMaterial->GetPathName());
+    ResultObj->SetBoolField(TEXT("variant_created"), bVariantCreated);
+    ResultObj->SetBoolField(TEXT("variant_saved"), bVariantSaved);
     
     ResultObj->SetBoolField(TEXT("success"), true);
     return ResultObj;
 }
 
+// Helper to read a material registry tag. Instances only carry the tags of their own properties,
+// so follow Parent tags up to the material that has it (registry lookups only, nothing is loaded).
+static bool GetInheritedMaterialTag(IAssetRegistry& AssetRegistry, const FAssetData& AssetData, FName TagName, FString& OutValue)
+{
+    FAssetData Current = AssetData;
+    // Depth limit guards against broken parent cycles
+    for (int32 Depth = 0; Depth < 16 && Current.IsValid(); ++Depth)
+    {
+        if (Current.GetTagValue(TagName, OutValue) && !OutValue.IsEmpty())
+        {
+            return true;
+        }
+
+        FString ParentValue;
+        if (!Current.GetTagValue(TEXT("Parent"), ParentValue) || ParentValue.IsEmpty() || ParentValue == TEXT("None"))
+        {
+            break;
+        }
+        Current = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(FPackageName::ExportTextPathToObjectPath(ParentValue)));
+    }
+
+    OutValue.Reset();
+    return false;
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMaterials(const TSharedPtr<FJsonObject>& Params)
 {
     // Get parameters - make search path completely dynamic
@@ -712,16 +1001,37 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMater
         bIncludeEngineMaterials = Params->GetBoolField(TEXT("include_engine_materials"));
     }
 
+    // Optional filters, all answered from registry tags
+    FString NameFilter;
+    Params->TryGetStringField(TEXT("name_filter"), NameFilter);
+    FString ParentFilter;
+    Params->TryGetStringField(TEXT("parent"), ParentFilter);
+    FString BlendModeFilter;
+    Params->TryGetStringField(TEXT("blend_mode"), BlendModeFilter);
+    FString KindFilter = TEXT("all");
+    Params->TryGetStringField(TEXT("kind"), KindFilter);
+
+    // Paging over a stable (path-sorted) order; no limit by default, like the unpaged command
+    int32 Offset = 0;
+    int32 Limit = 0;
+    if (Params->HasField(TEXT("offset")))
+    {
+        Offset = FMath::Max(0, static_cast<int32>(Params->GetNumberField(TEXT("offset"))));
+    }
+    if (Params->HasField(TEXT("limit")))
+    {
+        Limit = FMath::Max(0, static_cast<int32>(Params->GetNumberField(TEXT("limit"))));
+    }
+
     // Get asset registry module
     FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
     IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
 
-    // Create filter for materials
+    // Every UMaterialInterface subclass (materials, constant instances, project subclasses).
+    // Only registry data is read below, so no package is ever loaded.
     FARFilter Filter;
     Filter.ClassPaths.Add(UMaterialInterface::StaticClass()->GetClassPathName());
-    Filter.ClassPaths.Add(UMaterial::StaticClass()->GetClassPathName());
-    Filter.ClassPaths.Add(UMaterialInstanceConstant::StaticClass()->GetClassPathName());
-    Filter.ClassPaths.Add(UMaterialInstanceDynamic::StaticClass()->GetClassPathName());
+    Filter.bRecursiveClasses = true;
     
     // Add search paths dynamically
     if (!SearchPath.IsEmpty())
@@ -731,24 +1041,21 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMater
         {
             SearchPath = TEXT("/") + SearchPath;
         }
-        // Ensure the path ends with / for proper directory search
-        if (!SearchPath.EndsWith(TEXT("/")))
-        {
-            SearchPath += TEXT("/");
-        }
+        // Registry package paths have no trailing slash
+        SearchPath.RemoveFromEnd(TEXT("/"));
         Filter.PackagePaths.Add(*SearchPath);
         UE_LOG(LogTemp, Log, TEXT("Searching for materials in: %s"), *SearchPath);
     }
     else
     {
         // Search in common game content locations
-        Filter.PackagePaths.Add(TEXT("/Game/"));
+        Filter.PackagePaths.Add(TEXT("/Game"));
         UE_LOG(LogTemp, Log, TEXT("Searching for materials in all game content"));
     }
     
     if (bIncludeEngineMaterials)
     {
-        Filter.PackagePaths.Add(TEXT("/Engine/"));
+        Filter.PackagePaths.Add(TEXT("/Engine"));
         UE_LOG(LogTemp, Log, TEXT("Including Engine materials in search"));
     }
     
@@ -760,66 +1067,104 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintCommands::HandleGetAvailableMater
     
     UE_LOG(LogTemp, Log, TEXT("Asset registry found %d materials"), AssetDataArray.Num());
 
-    // Also try manual search using EditorAssetLibrary for more comprehensive results
-    TArray<FString> AllAssetPaths;
-    if (!SearchPath.IsEmpty())
-    {
-        AllAssetPaths = UEditorAssetLibrary::ListAssets(SearchPath, true, false);
-    }
-    else
-    {
-        AllAssetPaths = UEditorAssetLibrary::ListAssets(TEXT("/Game/"), true, false);
-    }
-    
-    // Filter for materials from the manual search
-    for (const FString& AssetPath : AllAssetPaths)
+    const FTopLevelAssetPath MaterialClassPath = UMaterial::StaticClass()->GetClassPathName();
+
+    // Dedupe (overlapping search paths) and filter in one pass
+    TSet<FSoftObjectPath> SeenPaths;
+    SeenPaths.Reserve(AssetDataArray.Num());
+    TArray<const FAssetData*> Matches;
+    Matches.Reserve(AssetDataArray.Num());
+    for (const FAssetData& AssetData : AssetDataArray)
     {
-        if (AssetPath.Contains(TEXT("Material")) && !AssetPath.Contains(TEXT(".uasset")))
+        bool bAlreadySeen = false;
+        SeenPaths.Add(AssetData.GetSoftObjectPath(), &bAlreadySeen);
+        if (bAlreadySeen)
+        {
+            continue;
+        }
+
+        const bool bIsBaseMaterial = AssetData.AssetClassPath == MaterialClassPath;
+        if ((KindFilter == TEXT("material") && !bIsBaseMaterial) || (KindFilter == TEXT("instance") && bIsBaseMaterial))
         {
-            UObject* Asset = UEditorAssetLibrary::LoadAsset(AssetPath);
-            if (Asset && Asset->IsA<UMaterialInterface>())
+            continue;
+        }
+
+        if (!NameFilter.IsEmpty() && !AssetData.AssetName.ToString().Contains(NameFilter))
+        {
+            continue;
+        }
+
+        if (!ParentFilter.IsEmpty())
+        {
+            FString ParentValue;
+            if (!AssetData.GetTagValue(TEXT("Parent"), ParentValue) || !ParentValue.Contains(ParentFilter))
             {
-                // Check if we already have this asset from registry search
-                bool bAlreadyFound = false;
-                for (const FAssetData& ExistingData : AssetDataArray)
-                {
-                    if (ExistingData.GetObjectPathString() == AssetPath)
-                    {
-                        bAlreadyFound = true;
-                        break;
-                    }
-                }
-                
-                if (!bAlreadyFound)
-                {
-                    // Create FAssetData manually for this asset
-                    FAssetData ManualAssetData(Asset);
-                    AssetDataArray.Add(ManualAssetData);
-                }
+                continue;
             }
         }
+
+        if (!BlendModeFilter.IsEmpty())
+        {
+            FString BlendModeValue;
+            if (!GetInheritedMaterialTag(AssetRegistry, AssetData, TEXT("BlendMode"), BlendModeValue) || !BlendModeValue.Contains(BlendModeFilter))
+            {
+                continue;
+            }
+        }
+
+        Matches.Add(&AssetData);
     }
 
-    UE_LOG(LogTemp, Log, TEXT("Total materials found after manual search: %d"), AssetDataArray.Num());
+    Matches.Sort([](const FAssetData& A, const FAssetData& B)
+    {
+        return A.PackageName.LexicalLess(B.PackageName);
+    });
+
+    // Registry tags worth surfacing for choosing a material without loading it; all but Parent
+    // are resolved through the parent chain for instances
+    static const FName ParentTag(TEXT("Parent"));
+    static const FName ReportedTags[] = {
+        ParentTag, TEXT("BlendMode"), TEXT("MaterialDomain"), TEXT("ShadingModel"), TEXT("TwoSided")
+    };
 
     // Convert to JSON
+    const int32 PageEnd = Limit > 0 ? FMath::Min(Matches.Num(), Offset + Limit) : Matches.Num();
     TArray<TSharedPtr<FJsonValue>> MaterialArray;
-    for (const FAssetData& AssetData : AssetDataArray)
+    for (int32 Index = Offset; Index < PageEnd; ++Index)
     {
+        const FAssetData& AssetData = *Matches[Index];
+
         TSharedPtr<FJsonObject> MaterialObj = MakeShared<FJsonObject>();
         MaterialObj->SetStringField(TEXT("name"), AssetData.AssetName.ToString());
         MaterialObj->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
         MaterialObj->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
         MaterialObj->SetStringField(TEXT("class"), AssetData.AssetClassPath.ToString());
+
+        for (const FName& TagName : ReportedTags)
+        {
+            FString TagValue;
+            const bool bFound = TagName == ParentTag
+                ? AssetData.GetTagValue(TagName, TagValue) && !TagValue.IsEmpty()
+                : GetInheritedMaterialTag(AssetRegistry, AssetData, TagName, TagValue);
+            if (bFound)
+            {
+                MaterialObj->SetStringField(TagName.ToString(), TagValue);
+            }
+        }
         
         MaterialArray.Add(MakeShared<FJsonValueObject>(MaterialObj));
-        
-        UE_LOG(LogTemp, Verbose, TEXT("Found material: %s at %s"), *AssetData.AssetName.ToString(), *AssetData.GetObjectPathString());
     }
 
     TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
     ResultObj->SetArrayField(TEXT("materials"), MaterialArray);
     ResultObj->SetNumberField(TEXT("count"), MaterialArray.Num());
+    ResultObj->SetNumberField(TEXT("total"), Matches.Num());
+    ResultObj->SetNumberField(TEXT("offset"), Offset);
+    ResultObj->SetBoolField(TEXT("has_more"), PageEnd < Matches.Num());
+    if (PageEnd < Matches.Num())
+    {
+        ResultObj->SetNumberField(TEXT("next_offset"), PageEnd);
+    }
     ResultObj->SetStringField(TEXT("search_path_used"), SearchPath.IsEmpty() ? TEXT("/Game/") : SearchPath);
     
     return ResultObj;
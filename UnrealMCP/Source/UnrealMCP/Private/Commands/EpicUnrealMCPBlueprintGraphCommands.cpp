@@ -8,6 +8,9 @@
 #include "Commands/BlueprintGraph/NodePropertyManager.h"
 #include "Commands/BlueprintGraph/Function/FunctionManager.h"
 #include "Commands/BlueprintGraph/Function/FunctionIO.h"
+#include "Commands/BlueprintGraph/BlueprintSearchIndex.h"
+#include "Commands/BlueprintGraph/GraphLayout.h"
+#include "Commands/BlueprintGraph/BlueprintScaffolder.h"
 
 FEpicUnrealMCPBlueprintGraphCommands::FEpicUnrealMCPBlueprintGraphCommands()
 {
@@ -67,6 +70,18 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleCommand(cons
     {
         return HandleRenameFunction(Params);
     }
+    else if (CommandType == TEXT("find_in_blueprints"))
+    {
+        return HandleFindInBlueprints(Params);
+    }
+    else if (CommandType == TEXT("layout_blueprint_graph"))
+    {
+        return HandleLayoutBlueprintGraph(Params);
+    }
+    else if (CommandType == TEXT("scaffold_blueprint_interface"))
+    {
+        return HandleScaffoldBlueprintInterface(Params);
+    }
 
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown blueprint graph command: %s"), *CommandType));
 }
@@ -386,3 +401,42 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleRenameFuncti
 
     return FFunctionManager::RenameFunction(Params);
 }
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleFindInBlueprints(const TSharedPtr<FJsonObject>& Params)
+{
+    FString Query;
+    if (!Params->TryGetStringField(TEXT("query"), Query))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'query' parameter"));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPBlueprintGraphCommands::HandleFindInBlueprints: Searching for '%s'"), *Query);
+
+    return FBlueprintSearchIndex::FindInBlueprints(Params);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleLayoutBlueprintGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPBlueprintGraphCommands::HandleLayoutBlueprintGraph: Laying out blueprint '%s'"), *BlueprintName);
+
+    return FBlueprintGraphLayout::LayoutBlueprintGraph(Params);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPBlueprintGraphCommands::HandleScaffoldBlueprintInterface(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BlueprintName;
+    if (!Params->TryGetStringField(TEXT("blueprint_name"), BlueprintName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'blueprint_name' parameter"));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPBlueprintGraphCommands::HandleScaffoldBlueprintInterface: Scaffolding blueprint '%s'"), *BlueprintName);
+
+    return FBlueprintScaffolder::ScaffoldBlueprintInterface(Params);
+}
@@ -757,4 +757,31 @@ bool FEpicUnrealMCPCommonUtils::SetObjectProperty(UObject* Object, const FString
     OutErrorMessage = FString::Printf(TEXT("Unsupported property type: %s for property %s"), 
                                     *Property->GetClass()->GetName(), *PropertyName);
     return false;
-} 
\ No newline at end of file
+} 
+
+// Keep the entries of InOut that also appear in Other; both must be ascending
+void FEpicUnrealMCPCommonUtils::IntersectSortedIndices(TArray<int32>& InOut, const TArray<int32>& Other)
+{
+    TArray<int32> Result;
+    Result.Reserve(FMath::Min(InOut.Num(), Other.Num()));
+    int32 A = 0;
+    int32 B = 0;
+    while (A < InOut.Num() && B < Other.Num())
+    {
+        if (InOut[A] < Other[B])
+        {
+            A++;
+        }
+        else if (Other[B] < InOut[A])
+        {
+            B++;
+        }
+        else
+        {
+            Result.Add(InOut[A]);
+            A++;
+            B++;
+        }
+    }
+    InOut = MoveTemp(Result);
+}
@@ -1,5 +1,9 @@
 #include "Commands/EpicUnrealMCPEditorCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/Screenshot/ScreenshotCapture.h"
+#include "Commands/Screenshot/MultiViewCapture.h"
+#include "Commands/MeshCatalog/MeshCatalogIndex.h"
+#include "Commands/MeshCatalog/ContentMeshListing.h"
 #include "RenderingThread.h"
 #include "Editor.h"
 #include "EditorViewportClient.h"
@@ -75,6 +79,22 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleCommand(const FStrin
     {
         return HandleTakeScreenshot(Params);
     }
+    else if (CommandType == TEXT("get_screenshot_status"))
+    {
+        return FScreenshotCapture::GetJobStatus(Params);
+    }
+    else if (CommandType == TEXT("capture_views"))
+    {
+        return FMultiViewCapture::CaptureViews(Params);
+    }
+    else if (CommandType == TEXT("query_mesh_catalog"))
+    {
+        return FMeshCatalogIndex::QueryCatalog(Params);
+    }
+    else if (CommandType == TEXT("get_mesh_catalog_info"))
+    {
+        return FMeshCatalogIndex::GetCatalogInfo(Params);
+    }
 
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown editor command: %s"), *CommandType));
 }
@@ -336,82 +356,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleSpawnBlueprintActor(
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleListContentBrowserMeshes(const TSharedPtr<FJsonObject>& Params)
 {
-    // Get search parameters
-    FString SearchPath;
-    if (!Params->TryGetStringField(TEXT("search_path"), SearchPath))
-    {
-        SearchPath = TEXT("/Game/");
-    }
-
-    FString NameFilter;
-    Params->TryGetStringField(TEXT("name_filter"), NameFilter);
-
-    int32 MaxResults = 100;
-    if (Params->HasField(TEXT("max_results")))
-    {
-        MaxResults = static_cast<int32>(Params->GetNumberField(TEXT("max_results")));
-    }
-
-    // Ensure path formatting
-    if (!SearchPath.StartsWith(TEXT("/")))
-    {
-        SearchPath = TEXT("/") + SearchPath;
-    }
-    if (!SearchPath.EndsWith(TEXT("/")))
-    {
-        SearchPath += TEXT("/");
-    }
-
-    // Query Asset Registry for StaticMesh assets
-    FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry"));
-    IAssetRegistry& AssetRegistry = AssetRegistryModule.Get();
-
-    FARFilter Filter;
-    Filter.ClassPaths.Add(UStaticMesh::StaticClass()->GetClassPathName());
-    Filter.PackagePaths.Add(*SearchPath);
-    Filter.bRecursivePaths = true;
-
-    TArray<FAssetData> AssetDataArray;
-    AssetRegistry.GetAssets(Filter, AssetDataArray);
-
-    UE_LOG(LogTemp, Log, TEXT("ListContentBrowserMeshes: Found %d meshes in %s"), AssetDataArray.Num(), *SearchPath);
-
-    // Build JSON result, applying name filter and max_results
-    TArray<TSharedPtr<FJsonValue>> MeshArray;
-    for (const FAssetData& AssetData : AssetDataArray)
-    {
-        if (MeshArray.Num() >= MaxResults)
-        {
-            break;
-        }
-
-        FString AssetName = AssetData.AssetName.ToString();
-
-        // Apply name filter if provided
-        if (!NameFilter.IsEmpty() && !AssetName.Contains(NameFilter))
-        {
-            continue;
-        }
-
-        TSharedPtr<FJsonObject> MeshObj = MakeShared<FJsonObject>();
-        MeshObj->SetStringField(TEXT("name"), AssetName);
-        MeshObj->SetStringField(TEXT("path"), AssetData.GetObjectPathString());
-        MeshObj->SetStringField(TEXT("package"), AssetData.PackageName.ToString());
-
-        MeshArray.Add(MakeShared<FJsonValueObject>(MeshObj));
-    }
-
-    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
-    ResultObj->SetArrayField(TEXT("meshes"), MeshArray);
-    ResultObj->SetNumberField(TEXT("count"), MeshArray.Num());
-    ResultObj->SetNumberField(TEXT("total_found"), AssetDataArray.Num());
-    ResultObj->SetStringField(TEXT("search_path"), SearchPath);
-    if (!NameFilter.IsEmpty())
-    {
-        ResultObj->SetStringField(TEXT("name_filter"), NameFilter);
-    }
-
-    return ResultObj;
+    // Listings are cached per path and kept current from asset registry events
+    return FContentMeshListing::ListMeshes(Params);
 }
 
 TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleGetActorDetails(const TSharedPtr<FJsonObject>& Params)
@@ -628,6 +574,29 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleTakeScreenshot(const
     {
         Filename = FPaths::ProjectSavedDir() / TEXT("Screenshots") / TEXT("MCP_Screenshot.png");
     }
+    else if (FPaths::IsRelative(Filename))
+    {
+        // Relative names go under Saved/Screenshots rather than the editor's working directory
+        Filename = FPaths::ProjectSavedDir() / TEXT("Screenshots") / Filename;
+    }
+
+    // Async captures read the render target back without flushing and encode on a worker
+    bool bAsync = false;
+    Params->TryGetBoolField(TEXT("async"), bAsync);
+
+    FScreenshotEncodeOptions EncodeOptions;
+    FString OptionsError;
+    if (!FScreenshotEncodeOptions::FromJson(Params, EncodeOptions, OptionsError))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(OptionsError);
+    }
+
+    // Keep the extension in line with the codec
+    if (FPaths::GetExtension(Filename) != EncodeOptions.GetExtension()
+        && !(EncodeOptions.Codec == EScreenshotCodec::Jpeg && FPaths::GetExtension(Filename).Equals(TEXT("jpeg"), ESearchCase::IgnoreCase)))
+    {
+        Filename = FPaths::ChangeExtension(Filename, EncodeOptions.GetExtension());
+    }
 
     if (!GEditor)
     {
@@ -654,6 +623,21 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleTakeScreenshot(const
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No viewport with valid size found. Ensure the UE5 viewport is visible and not obscured."));
     }
 
+    if (bAsync)
+    {
+        FString AsyncError;
+        const FString JobId = FScreenshotCapture::StartCapture(Viewport, Filename, EncodeOptions, AsyncError);
+        if (!JobId.IsEmpty())
+        {
+            TSharedPtr<FJsonObject> ResultJson = FScreenshotCapture::DescribeJob(JobId);
+            ResultJson->SetBoolField(TEXT("success"), true);
+            ResultJson->SetBoolField(TEXT("async"), true);
+            return ResultJson;
+        }
+
+        UE_LOG(LogTemp, Warning, TEXT("FEpicUnrealMCPEditorCommands::HandleTakeScreenshot: Async capture unavailable (%s), capturing synchronously"), *AsyncError);
+    }
+
     int32 Width = Viewport->GetSizeXY().X;
     int32 Height = Viewport->GetSizeXY().Y;
 
@@ -667,31 +651,25 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPEditorCommands::HandleTakeScreenshot(const
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to read viewport pixels"));
     }
 
-    // Ensure directory exists
-    FString Directory = FPaths::GetPath(Filename);
-    IFileManager::Get().MakeDirectory(*Directory, true);
-
-    // Compress to PNG and save
-    TArray<uint8> CompressedPNG;
-    FImageUtils::CompressImageArray(Width, Height, Bitmap, CompressedPNG);
-
-    if (CompressedPNG.Num() == 0)
+    // Viewport alpha is not coverage; keep screenshots opaque
+    for (FColor& Pixel : Bitmap)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to compress viewport image"));
+        Pixel.A = 255;
     }
 
-    if (!FFileHelper::SaveArrayToFile(CompressedPNG, *Filename))
+    // Downscale, compress and save (or inline)
+    FScreenshotCapture::LoadEncoder();
+    const FScreenshotEncodeResult Encoded = FScreenshotCapture::EncodeFrame(MoveTemp(Bitmap), FIntPoint(Width, Height), EncodeOptions, Filename);
+    if (!Encoded.bSuccess)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Failed to save screenshot to: %s"), *Filename));
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Encoded.Message);
     }
 
     // Return result
     TSharedPtr<FJsonObject> ResultJson = MakeShareable(new FJsonObject);
     ResultJson->SetStringField(TEXT("status"), TEXT("success"));
-    ResultJson->SetStringField(TEXT("file_path"), Filename);
-    ResultJson->SetNumberField(TEXT("width"), Width);
-    ResultJson->SetNumberField(TEXT("height"), Height);
+    FScreenshotCapture::AddEncodeResultFields(Encoded, EncodeOptions, Filename, ResultJson);
+    ResultJson->SetBoolField(TEXT("async"), false);
 
     return ResultJson;
 }
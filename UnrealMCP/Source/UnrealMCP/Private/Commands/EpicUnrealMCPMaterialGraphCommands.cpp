@@ -1,5 +1,7 @@
 #include "Commands/EpicUnrealMCPMaterialGraphCommands.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/MaterialGraph/MaterialCompileTracker.h"
+#include "Commands/MaterialGraph/MaterialVariantCache.h"
 
 // Material editing
 #include "MaterialEditingLibrary.h"
@@ -32,6 +34,7 @@
 #include "UObject/Package.h"
 #include "UObject/SavePackage.h"
 #include "EditorAssetLibrary.h"
+#include "ScopedTransaction.h"
 
 // Landscape
 #include "EngineUtils.h"
@@ -83,6 +86,22 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCommand(const
     {
         return HandleCompileMaterial(Params);
     }
+    else if (CommandType == TEXT("build_material_graph"))
+    {
+        return HandleBuildMaterialGraph(Params);
+    }
+    else if (CommandType == TEXT("get_material_compile_status"))
+    {
+        return FMaterialCompileTracker::GetJobStatus(Params);
+    }
+    else if (CommandType == TEXT("save_materials"))
+    {
+        return HandleSaveMaterials(Params);
+    }
+    else if (CommandType == TEXT("apply_material_variant"))
+    {
+        return FMaterialVariantCache::ApplyMaterialVariant(Params);
+    }
 
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown material graph command: %s"), *CommandType));
 }
@@ -166,6 +185,80 @@ static UMaterialExpression* FindExpressionByName(UMaterial* Material, const FStr
     return nullptr;
 }
 
+// ============================================================================
+// Helper: Deferred recompilation
+// ============================================================================
+// Graph edits only mark the material dirty and record it here. Translation and the shader
+// compile run once, when compile_material is called or the material is used (e.g. assigned
+// to a landscape), instead of after every node and wire.
+static TSet<TWeakObjectPtr<UMaterial>>& GetPendingRecompileMaterials()
+{
+    static TSet<TWeakObjectPtr<UMaterial>> PendingRecompileMaterials;
+    return PendingRecompileMaterials;
+}
+
+static void MarkMaterialEdited(UMaterial* Material)
+{
+    Material->MarkPackageDirty();
+    GetPendingRecompileMaterials().Add(Material);
+}
+
+// Recompile the material if it has edits that were not compiled yet
+static bool FlushPendingRecompile(UMaterial* Material)
+{
+    if (!Material || GetPendingRecompileMaterials().Remove(Material) == 0)
+    {
+        return false;
+    }
+
+    UMaterialEditingLibrary::RecompileMaterial(Material);
+    return true;
+}
+
+// ============================================================================
+// Helper: Save a material's package to disk
+// ============================================================================
+static bool SaveMaterialPackage(UMaterial* Material)
+{
+    UPackage* Package = Material->GetOutermost();
+    FString PackageFilename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+    return UPackage::SavePackage(Package, Material, *PackageFilename, SaveArgs);
+}
+
+// ============================================================================
+// Helper: Create a new material asset and register it (unsaved)
+// ============================================================================
+static UMaterial* CreateMaterialAsset(const FString& FullPath, const FString& MaterialName, FString& OutError)
+{
+    // Create the package
+    UPackage* Package = CreatePackage(*FullPath);
+    if (!Package)
+    {
+        OutError = FString::Printf(TEXT("Failed to create package at '%s'"), *FullPath);
+        return nullptr;
+    }
+
+    // Use MaterialFactoryNew to create the material
+    UMaterialFactoryNew* Factory = NewObject<UMaterialFactoryNew>();
+    UMaterial* NewMaterial = Cast<UMaterial>(Factory->FactoryCreateNew(
+        UMaterial::StaticClass(), Package, FName(*MaterialName),
+        RF_Public | RF_Standalone, nullptr, GWarn));
+
+    if (!NewMaterial)
+    {
+        OutError = TEXT("Failed to create material object");
+        return nullptr;
+    }
+
+    // Register with asset registry
+    FAssetRegistryModule::AssetCreated(NewMaterial);
+    Package->MarkPackageDirty();
+
+    return NewMaterial;
+}
+
 // ============================================================================
 // 1. create_material
 // ============================================================================
@@ -201,24 +294,13 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCreateMateria
         return Result;
     }
 
-    // Create the package
-    UPackage* Package = CreatePackage(*FullPath);
-    if (!Package)
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Failed to create package at '%s'"), *FullPath));
-    }
-
-    // Use MaterialFactoryNew to create the material
-    UMaterialFactoryNew* Factory = NewObject<UMaterialFactoryNew>();
-    UMaterial* NewMaterial = Cast<UMaterial>(Factory->FactoryCreateNew(
-        UMaterial::StaticClass(), Package, FName(*MaterialName),
-        RF_Public | RF_Standalone, nullptr, GWarn));
-
+    FString CreateError;
+    UMaterial* NewMaterial = CreateMaterialAsset(FullPath, MaterialName, CreateError);
     if (!NewMaterial)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to create material object"));
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(CreateError);
     }
+    UPackage* Package = NewMaterial->GetOutermost();
 
     // Set two-sided if requested
     if (bTwoSided)
@@ -226,10 +308,6 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCreateMateria
         NewMaterial->TwoSided = true;
     }
 
-    // Register with asset registry
-    FAssetRegistryModule::AssetCreated(NewMaterial);
-    Package->MarkPackageDirty();
-
     // Save the package
     FString PackageFilename = FPackageName::LongPackageNameToFilename(FullPath, FPackageName::GetAssetPackageExtension());
     FSavePackageArgs SaveArgs;
@@ -248,41 +326,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCreateMateria
 }
 
 // ============================================================================
-// 2. add_material_expression
+// Helper: Resolve a friendly or reflected expression class name
 // ============================================================================
-TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialExpression(const TSharedPtr<FJsonObject>& Params)
+static UClass* ResolveExpressionClass(const FString& ExpressionClass)
 {
-    FString MaterialPath;
-    if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
-    }
-
-    FString ExpressionClass;
-    if (!Params->TryGetStringField(TEXT("expression_class"), ExpressionClass))
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'expression_class' parameter"));
-    }
-
-    FString NodeName;
-    Params->TryGetStringField(TEXT("node_name"), NodeName);
-
-    double PosXD = 0.0, PosYD = 0.0;
-    Params->TryGetNumberField(TEXT("pos_x"), PosXD);
-    Params->TryGetNumberField(TEXT("pos_y"), PosYD);
-    int32 PosX = static_cast<int32>(PosXD);
-    int32 PosY = static_cast<int32>(PosYD);
-
-    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialExpression: Adding '%s' to material '%s'"),
-        *ExpressionClass, *MaterialPath);
-
-    UMaterial* Material = LoadMaterialByPath(MaterialPath);
-    if (!Material)
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not find material at '%s'"), *MaterialPath));
-    }
-
     // Map friendly class names to UClass
     static TMap<FString, UClass*> ExpressionClassMap;
     if (ExpressionClassMap.Num() == 0)
@@ -332,6 +379,47 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialEx
         }
     }
 
+    return TargetClass;
+}
+
+// ============================================================================
+// 2. add_material_expression
+// ============================================================================
+TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialExpression(const TSharedPtr<FJsonObject>& Params)
+{
+    FString MaterialPath;
+    if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
+    }
+
+    FString ExpressionClass;
+    if (!Params->TryGetStringField(TEXT("expression_class"), ExpressionClass))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'expression_class' parameter"));
+    }
+
+    FString NodeName;
+    Params->TryGetStringField(TEXT("node_name"), NodeName);
+
+    double PosXD = 0.0, PosYD = 0.0;
+    Params->TryGetNumberField(TEXT("pos_x"), PosXD);
+    Params->TryGetNumberField(TEXT("pos_y"), PosYD);
+    int32 PosX = static_cast<int32>(PosXD);
+    int32 PosY = static_cast<int32>(PosYD);
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialExpression: Adding '%s' to material '%s'"),
+        *ExpressionClass, *MaterialPath);
+
+    UMaterial* Material = LoadMaterialByPath(MaterialPath);
+    if (!Material)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Could not find material at '%s'"), *MaterialPath));
+    }
+
+    UClass* TargetClass = ResolveExpressionClass(ExpressionClass);
+
     if (!TargetClass)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
@@ -354,14 +442,13 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialEx
         NewExpression->Desc = NodeName;
     }
 
-    // Mark material as dirty
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Mark material dirty; the recompile is deferred to compile_material
+    MarkMaterialEdited(Material);
 
     // Build response
     TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
     Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("pending_recompile"), true);
     Result->SetStringField(TEXT("expression_name"), NewExpression->GetFName().ToString());
     Result->SetStringField(TEXT("expression_class"), TargetClass->GetName());
     if (!NodeName.IsEmpty())
@@ -382,45 +469,10 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleAddMaterialEx
 }
 
 // ============================================================================
-// 3. set_material_expression_param
+// Helper: Set a parameter on an expression from Params' 'param_value'
 // ============================================================================
-TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialExpressionParam(const TSharedPtr<FJsonObject>& Params)
+static bool SetExpressionParam(UMaterialExpression* Expression, const FString& ParamName, const TSharedPtr<FJsonObject>& Params, FString& OutError)
 {
-    FString MaterialPath;
-    if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
-    }
-
-    FString ExpressionName;
-    if (!Params->TryGetStringField(TEXT("expression_name"), ExpressionName))
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'expression_name' parameter"));
-    }
-
-    FString ParamName;
-    if (!Params->TryGetStringField(TEXT("param_name"), ParamName))
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'param_name' parameter"));
-    }
-
-    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialExpressionParam: Setting '%s' on '%s' in material '%s'"),
-        *ParamName, *ExpressionName, *MaterialPath);
-
-    UMaterial* Material = LoadMaterialByPath(MaterialPath);
-    if (!Material)
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not find material at '%s'"), *MaterialPath));
-    }
-
-    UMaterialExpression* Expression = FindExpressionByName(Material, ExpressionName);
-    if (!Expression)
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not find expression '%s' in material"), *ExpressionName));
-    }
-
     // Handle specific parameter types based on expression class and param name
     bool bHandled = false;
 
@@ -453,8 +505,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialEx
             }
             else
             {
-                return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-                    FString::Printf(TEXT("Could not load texture at '%s'"), *TexturePath));
+                OutError = FString::Printf(TEXT("Could not load texture at '%s'"), *TexturePath);
+                return false;
             }
         }
     }
@@ -695,8 +747,8 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialEx
                 }
                 else
                 {
-                    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-                        FString::Printf(TEXT("Failed to set property '%s': %s"), *ParamName, *ErrorMessage));
+                    OutError = FString::Printf(TEXT("Failed to set property '%s': %s"), *ParamName, *ErrorMessage);
+                    return false;
                 }
             }
         }
@@ -704,27 +756,18 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialEx
 
     if (!bHandled)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not set parameter '%s' on expression '%s'. Supported params depend on expression type."), *ParamName, *ExpressionName));
+        OutError = FString::Printf(TEXT("Could not set parameter '%s' on expression '%s'. Supported params depend on expression type."),
+            *ParamName, Expression->Desc.IsEmpty() ? *Expression->GetName() : *Expression->Desc);
+        return false;
     }
 
-    // Mark material dirty
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
-
-    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-    Result->SetBoolField(TEXT("success"), true);
-    Result->SetStringField(TEXT("expression_name"), ExpressionName);
-    Result->SetStringField(TEXT("param_name"), ParamName);
-
-    return Result;
+    return true;
 }
 
 // ============================================================================
-// 4. connect_material_expressions
+// 3. set_material_expression_param
 // ============================================================================
-TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMaterialExpressions(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialExpressionParam(const TSharedPtr<FJsonObject>& Params)
 {
     FString MaterialPath;
     if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
@@ -732,28 +775,20 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMateri
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
     }
 
-    FString FromExpression;
-    if (!Params->TryGetStringField(TEXT("from_expression"), FromExpression))
+    FString ExpressionName;
+    if (!Params->TryGetStringField(TEXT("expression_name"), ExpressionName))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'from_expression' parameter"));
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'expression_name' parameter"));
     }
 
-    FString ToExpression;
-    if (!Params->TryGetStringField(TEXT("to_expression"), ToExpression))
+    FString ParamName;
+    if (!Params->TryGetStringField(TEXT("param_name"), ParamName))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'to_expression' parameter"));
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'param_name' parameter"));
     }
 
-    double FromOutputIndexD = 0.0;
-    Params->TryGetNumberField(TEXT("from_output_index"), FromOutputIndexD);
-    int32 FromOutputIndex = static_cast<int32>(FromOutputIndexD);
-
-    double ToInputIndexD = 0.0;
-    Params->TryGetNumberField(TEXT("to_input_index"), ToInputIndexD);
-    int32 ToInputIndex = static_cast<int32>(ToInputIndexD);
-
-    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleConnectMaterialExpressions: Connecting '%s'[%d] -> '%s'[%d] in '%s'"),
-        *FromExpression, FromOutputIndex, *ToExpression, ToInputIndex, *MaterialPath);
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleSetMaterialExpressionParam: Setting '%s' on '%s' in material '%s'"),
+        *ParamName, *ExpressionName, *MaterialPath);
 
     UMaterial* Material = LoadMaterialByPath(MaterialPath);
     if (!Material)
@@ -762,54 +797,71 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMateri
             FString::Printf(TEXT("Could not find material at '%s'"), *MaterialPath));
     }
 
-    UMaterialExpression* FromExpr = FindExpressionByName(Material, FromExpression);
-    if (!FromExpr)
+    UMaterialExpression* Expression = FindExpressionByName(Material, ExpressionName);
+    if (!Expression)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not find source expression '%s'"), *FromExpression));
+            FString::Printf(TEXT("Could not find expression '%s' in material"), *ExpressionName));
     }
 
-    UMaterialExpression* ToExpr = FindExpressionByName(Material, ToExpression);
-    if (!ToExpr)
+    FString ParamError;
+    if (!SetExpressionParam(Expression, ParamName, Params, ParamError))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not find target expression '%s'"), *ToExpression));
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(ParamError);
     }
 
+    // Mark material dirty; the recompile is deferred to compile_material
+    MarkMaterialEdited(Material);
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("pending_recompile"), true);
+    Result->SetStringField(TEXT("expression_name"), ExpressionName);
+    Result->SetStringField(TEXT("param_name"), ParamName);
+
+    return Result;
+}
+
+// ============================================================================
+// Helper: Connect an expression output to another expression's input by index
+// ============================================================================
+static bool ConnectExpressionPins(UMaterialExpression* FromExpr, int32 FromOutputIndex, UMaterialExpression* ToExpr, int32 ToInputIndex,
+    FString& OutFromOutputName, FString& OutToInputName)
+{
     // Resolve output name with bounds check (NAME_None must become "" for UMaterialEditingLibrary)
-    FString FromOutputName = TEXT("");
+    OutFromOutputName = TEXT("");
     const TArray<FExpressionOutput>& Outputs = FromExpr->GetOutputs();
     if (Outputs.IsValidIndex(FromOutputIndex))
     {
         FName OutName = Outputs[FromOutputIndex].OutputName;
-        FromOutputName = OutName.IsNone() ? TEXT("") : OutName.ToString();
+        OutFromOutputName = OutName.IsNone() ? TEXT("") : OutName.ToString();
     }
 
     // Resolve input name (NAME_None must become "" for UMaterialEditingLibrary)
     FName InName = ToExpr->GetInputName(ToInputIndex);
-    FString ToInputName = InName.IsNone() ? TEXT("") : InName.ToString();
+    OutToInputName = InName.IsNone() ? TEXT("") : InName.ToString();
 
-    UE_LOG(LogTemp, Display, TEXT("ConnectMaterialExpressions: FromOutputName='%s', ToInputName='%s'"), *FromOutputName, *ToInputName);
+    UE_LOG(LogTemp, Display, TEXT("ConnectMaterialExpressions: FromOutputName='%s', ToInputName='%s'"), *OutFromOutputName, *OutToInputName);
 
     // Use UMaterialEditingLibrary to connect — try multiple name combinations
     // because NAME_None.ToString() returns "None" but the API expects ""
     bool bConnected = UMaterialEditingLibrary::ConnectMaterialExpressions(
-        FromExpr, FromOutputName,
-        ToExpr, ToInputName);
+        FromExpr, OutFromOutputName,
+        ToExpr, OutToInputName);
 
     if (!bConnected)
     {
         // Fallback 1: empty output name, keep input name
         bConnected = UMaterialEditingLibrary::ConnectMaterialExpressions(
             FromExpr, TEXT(""),
-            ToExpr, ToInputName);
+            ToExpr, OutToInputName);
     }
 
     if (!bConnected)
     {
         // Fallback 2: keep output name, empty input name
         bConnected = UMaterialEditingLibrary::ConnectMaterialExpressions(
-            FromExpr, FromOutputName,
+            FromExpr, OutFromOutputName,
             ToExpr, TEXT(""));
     }
 
@@ -821,31 +873,13 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMateri
             ToExpr, TEXT(""));
     }
 
-    if (!bConnected)
-    {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Failed to connect '%s'[%d] (out='%s') to '%s'[%d] (in='%s')"),
-                *FromExpression, FromOutputIndex, *FromOutputName, *ToExpression, ToInputIndex, *ToInputName));
-    }
-
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
-
-    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-    Result->SetBoolField(TEXT("success"), true);
-    Result->SetStringField(TEXT("from_expression"), FromExpression);
-    Result->SetStringField(TEXT("to_expression"), ToExpression);
-    Result->SetNumberField(TEXT("from_output_index"), FromOutputIndex);
-    Result->SetNumberField(TEXT("to_input_index"), ToInputIndex);
-
-    return Result;
-}
+    return bConnected;
+}
 
 // ============================================================================
-// 5. connect_material_to_output
+// 4. connect_material_expressions
 // ============================================================================
-TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMaterialToOutput(const TSharedPtr<FJsonObject>& Params)
+TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMaterialExpressions(const TSharedPtr<FJsonObject>& Params)
 {
     FString MaterialPath;
     if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
@@ -853,24 +887,28 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMateri
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
     }
 
-    FString ExpressionName;
-    if (!Params->TryGetStringField(TEXT("expression_name"), ExpressionName))
+    FString FromExpression;
+    if (!Params->TryGetStringField(TEXT("from_expression"), FromExpression))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'expression_name' parameter"));
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'from_expression' parameter"));
     }
 
-    FString MaterialProperty;
-    if (!Params->TryGetStringField(TEXT("material_property"), MaterialProperty))
+    FString ToExpression;
+    if (!Params->TryGetStringField(TEXT("to_expression"), ToExpression))
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_property' parameter"));
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'to_expression' parameter"));
     }
 
-    double OutputIndexD = 0.0;
-    Params->TryGetNumberField(TEXT("output_index"), OutputIndexD);
-    int32 OutputIndex = static_cast<int32>(OutputIndexD);
+    double FromOutputIndexD = 0.0;
+    Params->TryGetNumberField(TEXT("from_output_index"), FromOutputIndexD);
+    int32 FromOutputIndex = static_cast<int32>(FromOutputIndexD);
 
-    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleConnectMaterialToOutput: Connecting '%s' to %s in '%s'"),
-        *ExpressionName, *MaterialProperty, *MaterialPath);
+    double ToInputIndexD = 0.0;
+    Params->TryGetNumberField(TEXT("to_input_index"), ToInputIndexD);
+    int32 ToInputIndex = static_cast<int32>(ToInputIndexD);
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleConnectMaterialExpressions: Connecting '%s'[%d] -> '%s'[%d] in '%s'"),
+        *FromExpression, FromOutputIndex, *ToExpression, ToInputIndex, *MaterialPath);
 
     UMaterial* Material = LoadMaterialByPath(MaterialPath);
     if (!Material)
@@ -879,62 +917,103 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMateri
             FString::Printf(TEXT("Could not find material at '%s'"), *MaterialPath));
     }
 
-    UMaterialExpression* Expression = FindExpressionByName(Material, ExpressionName);
-    if (!Expression)
+    UMaterialExpression* FromExpr = FindExpressionByName(Material, FromExpression);
+    if (!FromExpr)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not find expression '%s' in material"), *ExpressionName));
+            FString::Printf(TEXT("Could not find source expression '%s'"), *FromExpression));
     }
 
-    // Map string property names to EMaterialProperty
-    EMaterialProperty MatProp;
+    UMaterialExpression* ToExpr = FindExpressionByName(Material, ToExpression);
+    if (!ToExpr)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Could not find target expression '%s'"), *ToExpression));
+    }
+
+    FString FromOutputName;
+    FString ToInputName;
+    bool bConnected = ConnectExpressionPins(FromExpr, FromOutputIndex, ToExpr, ToInputIndex, FromOutputName, ToInputName);
+
+    if (!bConnected)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Failed to connect '%s'[%d] (out='%s') to '%s'[%d] (in='%s')"),
+                *FromExpression, FromOutputIndex, *FromOutputName, *ToExpression, ToInputIndex, *ToInputName));
+    }
+
+    // Mark material dirty; the recompile is deferred to compile_material
+    MarkMaterialEdited(Material);
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("pending_recompile"), true);
+    Result->SetStringField(TEXT("from_expression"), FromExpression);
+    Result->SetStringField(TEXT("to_expression"), ToExpression);
+    Result->SetNumberField(TEXT("from_output_index"), FromOutputIndex);
+    Result->SetNumberField(TEXT("to_input_index"), ToInputIndex);
+
+    return Result;
+}
+
+// ============================================================================
+// Helper: Map a material output name to EMaterialProperty
+// ============================================================================
+static bool ParseMaterialProperty(const FString& MaterialProperty, EMaterialProperty& OutProperty)
+{
     if (MaterialProperty == TEXT("BaseColor") || MaterialProperty == TEXT("Diffuse"))
     {
-        MatProp = MP_BaseColor;
+        OutProperty = MP_BaseColor;
     }
     else if (MaterialProperty == TEXT("Normal"))
     {
-        MatProp = MP_Normal;
+        OutProperty = MP_Normal;
     }
     else if (MaterialProperty == TEXT("Roughness"))
     {
-        MatProp = MP_Roughness;
+        OutProperty = MP_Roughness;
     }
     else if (MaterialProperty == TEXT("Metallic"))
     {
-        MatProp = MP_Metallic;
+        OutProperty = MP_Metallic;
     }
     else if (MaterialProperty == TEXT("AmbientOcclusion") || MaterialProperty == TEXT("AO"))
     {
-        MatProp = MP_AmbientOcclusion;
+        OutProperty = MP_AmbientOcclusion;
     }
     else if (MaterialProperty == TEXT("EmissiveColor") || MaterialProperty == TEXT("Emissive"))
     {
-        MatProp = MP_EmissiveColor;
+        OutProperty = MP_EmissiveColor;
     }
     else if (MaterialProperty == TEXT("Specular"))
     {
-        MatProp = MP_Specular;
+        OutProperty = MP_Specular;
     }
     else if (MaterialProperty == TEXT("Opacity"))
     {
-        MatProp = MP_Opacity;
+        OutProperty = MP_Opacity;
     }
     else if (MaterialProperty == TEXT("OpacityMask"))
     {
-        MatProp = MP_OpacityMask;
+        OutProperty = MP_OpacityMask;
     }
     else if (MaterialProperty == TEXT("WorldPositionOffset"))
     {
-        MatProp = MP_WorldPositionOffset;
+        OutProperty = MP_WorldPositionOffset;
     }
     else
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Unknown material property: '%s'. Supported: BaseColor, Normal, Roughness, Metallic, AmbientOcclusion, EmissiveColor, Specular, Opacity, OpacityMask, WorldPositionOffset"), *MaterialProperty));
+        return false;
     }
 
-    // Connect using UMaterialEditingLibrary
+    return true;
+}
+
+// ============================================================================
+// Helper: Connect an expression output to a material output property
+// ============================================================================
+static bool ConnectExpressionToProperty(UMaterialExpression* Expression, int32 OutputIndex, EMaterialProperty MatProp)
+{
     FString OutputName;
     if (OutputIndex < Expression->GetOutputs().Num())
     {
@@ -949,6 +1028,64 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMateri
         bConnected = UMaterialEditingLibrary::ConnectMaterialProperty(Expression, TEXT(""), MatProp);
     }
 
+    return bConnected;
+}
+
+// ============================================================================
+// 5. connect_material_to_output
+// ============================================================================
+TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMaterialToOutput(const TSharedPtr<FJsonObject>& Params)
+{
+    FString MaterialPath;
+    if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
+    }
+
+    FString ExpressionName;
+    if (!Params->TryGetStringField(TEXT("expression_name"), ExpressionName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'expression_name' parameter"));
+    }
+
+    FString MaterialProperty;
+    if (!Params->TryGetStringField(TEXT("material_property"), MaterialProperty))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_property' parameter"));
+    }
+
+    double OutputIndexD = 0.0;
+    Params->TryGetNumberField(TEXT("output_index"), OutputIndexD);
+    int32 OutputIndex = static_cast<int32>(OutputIndexD);
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleConnectMaterialToOutput: Connecting '%s' to %s in '%s'"),
+        *ExpressionName, *MaterialProperty, *MaterialPath);
+
+    UMaterial* Material = LoadMaterialByPath(MaterialPath);
+    if (!Material)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Could not find material at '%s'"), *MaterialPath));
+    }
+
+    UMaterialExpression* Expression = FindExpressionByName(Material, ExpressionName);
+    if (!Expression)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Could not find expression '%s' in material"), *ExpressionName));
+    }
+
+    // Map string property names to EMaterialProperty
+    EMaterialProperty MatProp;
+    if (!ParseMaterialProperty(MaterialProperty, MatProp))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown material property: '%s'. Supported: BaseColor, Normal, Roughness, Metallic, AmbientOcclusion, EmissiveColor, Specular, Opacity, OpacityMask, WorldPositionOffset"), *MaterialProperty));
+    }
+
+    // Connect using UMaterialEditingLibrary
+    bool bConnected = ConnectExpressionToProperty(Expression, OutputIndex, MatProp);
+
     if (!bConnected)
     {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
@@ -956,12 +1093,12 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleConnectMateri
                 *ExpressionName, *MaterialProperty));
     }
 
-    Material->PreEditChange(nullptr);
-    Material->PostEditChange();
-    Material->MarkPackageDirty();
+    // Mark material dirty; the recompile is deferred to compile_material
+    MarkMaterialEdited(Material);
 
     TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
     Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("pending_recompile"), true);
     Result->SetStringField(TEXT("expression_name"), ExpressionName);
     Result->SetStringField(TEXT("material_property"), MaterialProperty);
 
@@ -1027,6 +1164,9 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSetLandscapeM
             FString::Printf(TEXT("Could not load material at '%s'"), *MaterialPath));
     }
 
+    // Apply any uncompiled graph edits before the landscape builds its material instances
+    FlushPendingRecompile(Cast<UMaterial>(MaterialInterface));
+
     // Set the landscape material
     LandscapeProxy->LandscapeMaterial = MaterialInterface;
     LandscapeProxy->UpdateAllComponentMaterialInstances();
@@ -1054,6 +1194,12 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCompileMateri
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
     }
 
+    bool bWait = false;
+    Params->TryGetBoolField(TEXT("wait"), bWait);
+
+    bool bSave = false;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+
     UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleCompileMaterial: Compiling material '%s'"), *MaterialPath);
 
     UMaterial* Material = LoadMaterialByPath(MaterialPath);
@@ -1063,26 +1209,403 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleCompileMateri
             FString::Printf(TEXT("Could not find material at '%s'"), *MaterialPath));
     }
 
-    // Recompile the material
-    UMaterialEditingLibrary::RecompileMaterial(Material);
+    // Recompile the material once for all edits made since the last compile. Shaders finish
+    // on the shader compiling manager; poll get_material_compile_status with the job id.
+    const bool bHadPendingEdits = GetPendingRecompileMaterials().Remove(Material) > 0;
+    const FString JobId = FMaterialCompileTracker::StartCompile(Material, MaterialPath);
+    if (bWait)
+    {
+        FMaterialCompileTracker::FinishCompile(JobId);
+    }
 
-    // Save the material package
-    UPackage* Package = Material->GetOutermost();
-    if (Package)
+    if (bSave)
+    {
+        SaveMaterialPackage(Material);
+    }
+
+    TSharedPtr<FJsonObject> Result = FMaterialCompileTracker::DescribeJob(JobId);
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetBoolField(TEXT("had_pending_edits"), bHadPendingEdits);
+    Result->SetBoolField(TEXT("saved"), bSave);
+
+    return Result;
+}
+
+// ============================================================================
+// 7b. save_materials
+// ============================================================================
+TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleSaveMaterials(const TSharedPtr<FJsonObject>& Params)
+{
+    TArray<FString> MaterialPaths;
+    const TArray<TSharedPtr<FJsonValue>>* PathsArray;
+    if (Params->TryGetArrayField(TEXT("material_paths"), PathsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& PathValue : *PathsArray)
+        {
+            MaterialPaths.AddUnique(PathValue->AsString());
+        }
+    }
+    FString SinglePath;
+    if (Params->TryGetStringField(TEXT("material_path"), SinglePath))
     {
-        FString PackagePath = Package->GetPathName();
-        FString PackageFilename = FPackageName::LongPackageNameToFilename(PackagePath, FPackageName::GetAssetPackageExtension());
-        FSavePackageArgs SaveArgs;
-        SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-        UPackage::SavePackage(Package, Material, *PackageFilename, SaveArgs);
+        MaterialPaths.AddUnique(SinglePath);
     }
+    if (MaterialPaths.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_paths' parameter"));
+    }
+
+    bool bOnlyDirty = true;
+    Params->TryGetBoolField(TEXT("only_dirty"), bOnlyDirty);
 
-    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleCompileMaterial: Material compiled successfully"));
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleSaveMaterials: Saving %d material(s)"), MaterialPaths.Num());
+
+    TArray<TSharedPtr<FJsonValue>> SavedJson;
+    TArray<TSharedPtr<FJsonValue>> SkippedJson;
+    TArray<TSharedPtr<FJsonValue>> FailedJson;
+    for (const FString& Path : MaterialPaths)
+    {
+        UMaterial* Material = LoadMaterialByPath(Path);
+        if (!Material)
+        {
+            FailedJson.Add(MakeShareable(new FJsonValueString(Path)));
+            continue;
+        }
+
+        if (bOnlyDirty && !Material->GetOutermost()->IsDirty())
+        {
+            SkippedJson.Add(MakeShareable(new FJsonValueString(Path)));
+            continue;
+        }
+
+        if (SaveMaterialPackage(Material))
+        {
+            SavedJson.Add(MakeShareable(new FJsonValueString(Path)));
+        }
+        else
+        {
+            FailedJson.Add(MakeShareable(new FJsonValueString(Path)));
+        }
+    }
 
     TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-    Result->SetBoolField(TEXT("success"), true);
-    Result->SetStringField(TEXT("material_path"), MaterialPath);
-    Result->SetStringField(TEXT("message"), TEXT("Material compiled and saved successfully"));
+    Result->SetBoolField(TEXT("success"), FailedJson.Num() == 0);
+    if (FailedJson.Num() > 0)
+    {
+        Result->SetStringField(TEXT("error"), FString::Printf(TEXT("%d material(s) could not be found or saved"), FailedJson.Num()));
+    }
+    Result->SetArrayField(TEXT("saved"), SavedJson);
+    Result->SetArrayField(TEXT("skipped"), SkippedJson);
+    Result->SetArrayField(TEXT("failed"), FailedJson);
+
+    return Result;
+}
+
+// ============================================================================
+// 8. build_material_graph
+// ============================================================================
+TSharedPtr<FJsonObject> FEpicUnrealMCPMaterialGraphCommands::HandleBuildMaterialGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    FString MaterialPath;
+    if (!Params->TryGetStringField(TEXT("material_path"), MaterialPath))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'material_path' parameter"));
+    }
+
+    bool bCreateIfMissing = true;
+    Params->TryGetBoolField(TEXT("create_if_missing"), bCreateIfMissing);
+
+    // Opt-in: wiping an existing material is not something a partial request should do by default
+    bool bClearExisting = false;
+    Params->TryGetBoolField(TEXT("clear_existing"), bClearExisting);
+
+    bool bCompile = true;
+    Params->TryGetBoolField(TEXT("compile"), bCompile);
+
+    bool bSave = true;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+
+    // Blocking on shaders is opt-in; by default the caller polls get_material_compile_status
+    bool bWait = false;
+    Params->TryGetBoolField(TEXT("wait"), bWait);
+
+    const TArray<TSharedPtr<FJsonValue>> EmptyArray;
+    const TArray<TSharedPtr<FJsonValue>>* NodesArray = &EmptyArray;
+    const TArray<TSharedPtr<FJsonValue>>* LinksArray = &EmptyArray;
+    const TArray<TSharedPtr<FJsonValue>>* OutputsArray = &EmptyArray;
+    Params->TryGetArrayField(TEXT("nodes"), NodesArray);
+    Params->TryGetArrayField(TEXT("links"), LinksArray);
+    Params->TryGetArrayField(TEXT("outputs"), OutputsArray);
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleBuildMaterialGraph: Building '%s' (%d nodes, %d links, %d outputs)"),
+        *MaterialPath, NodesArray->Num(), LinksArray->Num(), OutputsArray->Num());
+
+    // Load or create the material
+    bool bCreated = false;
+    UMaterial* Material = LoadMaterialByPath(MaterialPath);
+    if (!Material)
+    {
+        if (!bCreateIfMissing)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Could not find material at '%s'"), *MaterialPath));
+        }
+
+        FString PackagePath = MaterialPath;
+        PackagePath.Split(TEXT("."), &PackagePath, nullptr);
+
+        FString CreateError;
+        Material = CreateMaterialAsset(PackagePath, FPaths::GetCleanFilename(PackagePath), CreateError);
+        if (!Material)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(CreateError);
+        }
+        bCreated = true;
+    }
+
+    // One undo step for the whole graph edit
+    FScopedTransaction Transaction(NSLOCTEXT("UnrealMCP", "BuildMaterialGraph", "Build Material Graph"));
+    Material->Modify();
+
+    bool bTwoSided = false;
+    if (Params->TryGetBoolField(TEXT("two_sided"), bTwoSided))
+    {
+        Material->TwoSided = bTwoSided;
+    }
+
+    if (bClearExisting && !bCreated)
+    {
+        UMaterialEditingLibrary::DeleteAllMaterialExpressions(Material);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    auto AddError = [&Errors](const FString& Message)
+    {
+        Errors.Add(MakeShareable(new FJsonValueString(Message)));
+    };
+
+    // Name -> expression for this build; links fall back to FindExpressionByName for kept nodes
+    TMap<FString, UMaterialExpression*> ExpressionsByName;
+    auto FindExpression = [&ExpressionsByName, Material](const FString& Name) -> UMaterialExpression*
+    {
+        if (UMaterialExpression** Found = ExpressionsByName.Find(Name))
+        {
+            return *Found;
+        }
+        return FindExpressionByName(Material, Name);
+    };
+
+    // Pass 1: create nodes and set their parameters
+    TArray<TSharedPtr<FJsonValue>> NodesJson;
+    for (int32 NodeIndex = 0; NodeIndex < NodesArray->Num(); ++NodeIndex)
+    {
+        const TSharedPtr<FJsonObject>* NodeObj;
+        if (!(*NodesArray)[NodeIndex]->TryGetObject(NodeObj))
+        {
+            AddError(FString::Printf(TEXT("nodes[%d]: expected an object"), NodeIndex));
+            continue;
+        }
+
+        FString NodeName;
+        FString ExpressionClass;
+        (*NodeObj)->TryGetStringField(TEXT("node_name"), NodeName);
+        if (!(*NodeObj)->TryGetStringField(TEXT("expression_class"), ExpressionClass))
+        {
+            AddError(FString::Printf(TEXT("nodes[%d]: missing 'expression_class'"), NodeIndex));
+            continue;
+        }
+
+        if (!NodeName.IsEmpty() && ExpressionsByName.Contains(NodeName))
+        {
+            AddError(FString::Printf(TEXT("nodes[%d]: duplicate node_name '%s'"), NodeIndex, *NodeName));
+            continue;
+        }
+
+        UClass* TargetClass = ResolveExpressionClass(ExpressionClass);
+        if (!TargetClass)
+        {
+            AddError(FString::Printf(TEXT("nodes[%d]: unknown expression class '%s'"), NodeIndex, *ExpressionClass));
+            continue;
+        }
+
+        // Default layout stacks nodes in a column left of the material output
+        double PosXD = -400.0, PosYD = NodeIndex * 150.0;
+        (*NodeObj)->TryGetNumberField(TEXT("pos_x"), PosXD);
+        (*NodeObj)->TryGetNumberField(TEXT("pos_y"), PosYD);
+
+        UMaterialExpression* NewExpression = UMaterialEditingLibrary::CreateMaterialExpression(
+            Material, TargetClass, static_cast<int32>(PosXD), static_cast<int32>(PosYD));
+        if (!NewExpression)
+        {
+            AddError(FString::Printf(TEXT("nodes[%d]: failed to create '%s'"), NodeIndex, *ExpressionClass));
+            continue;
+        }
+
+        if (!NodeName.IsEmpty())
+        {
+            NewExpression->Desc = NodeName;
+            ExpressionsByName.Add(NodeName, NewExpression);
+        }
+        ExpressionsByName.Add(NewExpression->GetFName().ToString(), NewExpression);
+
+        const TSharedPtr<FJsonObject>* NodeParams;
+        if ((*NodeObj)->TryGetObjectField(TEXT("params"), NodeParams))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Param : (*NodeParams)->Values)
+            {
+                TSharedPtr<FJsonObject> ParamArgs = MakeShareable(new FJsonObject);
+                ParamArgs->SetField(TEXT("param_value"), Param.Value);
+
+                FString ParamError;
+                if (!SetExpressionParam(NewExpression, Param.Key, ParamArgs, ParamError))
+                {
+                    AddError(FString::Printf(TEXT("nodes[%d]: %s"), NodeIndex, *ParamError));
+                }
+            }
+        }
+
+        TSharedPtr<FJsonObject> NodeJson = MakeShareable(new FJsonObject);
+        NodeJson->SetStringField(TEXT("node_name"), NodeName);
+        NodeJson->SetStringField(TEXT("expression_name"), NewExpression->GetFName().ToString());
+        NodeJson->SetStringField(TEXT("expression_class"), TargetClass->GetName());
+        NodesJson.Add(MakeShareable(new FJsonValueObject(NodeJson)));
+    }
+
+    // Pass 2: wire expressions together
+    int32 LinkCount = 0;
+    for (int32 LinkIndex = 0; LinkIndex < LinksArray->Num(); ++LinkIndex)
+    {
+        const TSharedPtr<FJsonObject>* LinkObj;
+        if (!(*LinksArray)[LinkIndex]->TryGetObject(LinkObj))
+        {
+            AddError(FString::Printf(TEXT("links[%d]: expected an object"), LinkIndex));
+            continue;
+        }
+
+        FString FromName, ToName;
+        (*LinkObj)->TryGetStringField(TEXT("from_expression"), FromName);
+        (*LinkObj)->TryGetStringField(TEXT("to_expression"), ToName);
+
+        double FromOutputIndexD = 0.0, ToInputIndexD = 0.0;
+        (*LinkObj)->TryGetNumberField(TEXT("from_output_index"), FromOutputIndexD);
+        (*LinkObj)->TryGetNumberField(TEXT("to_input_index"), ToInputIndexD);
+        const int32 FromOutputIndex = static_cast<int32>(FromOutputIndexD);
+        const int32 ToInputIndex = static_cast<int32>(ToInputIndexD);
+
+        UMaterialExpression* FromExpr = FindExpression(FromName);
+        UMaterialExpression* ToExpr = FindExpression(ToName);
+        if (!FromExpr || !ToExpr)
+        {
+            AddError(FString::Printf(TEXT("links[%d]: could not find expression '%s'"), LinkIndex, FromExpr ? *ToName : *FromName));
+            continue;
+        }
+
+        FString FromOutputName;
+        FString ToInputName;
+        if (!ConnectExpressionPins(FromExpr, FromOutputIndex, ToExpr, ToInputIndex, FromOutputName, ToInputName))
+        {
+            AddError(FString::Printf(TEXT("links[%d]: failed to connect '%s'[%d] to '%s'[%d]"),
+                LinkIndex, *FromName, FromOutputIndex, *ToName, ToInputIndex));
+            continue;
+        }
+        LinkCount++;
+    }
+
+    // Pass 3: bind material outputs
+    int32 OutputCount = 0;
+    for (int32 OutputIndex = 0; OutputIndex < OutputsArray->Num(); ++OutputIndex)
+    {
+        const TSharedPtr<FJsonObject>* OutputObj;
+        if (!(*OutputsArray)[OutputIndex]->TryGetObject(OutputObj))
+        {
+            AddError(FString::Printf(TEXT("outputs[%d]: expected an object"), OutputIndex));
+            continue;
+        }
+
+        FString ExpressionName, MaterialProperty;
+        (*OutputObj)->TryGetStringField(TEXT("expression_name"), ExpressionName);
+        (*OutputObj)->TryGetStringField(TEXT("material_property"), MaterialProperty);
+
+        double ExprOutputIndexD = 0.0;
+        (*OutputObj)->TryGetNumberField(TEXT("output_index"), ExprOutputIndexD);
+
+        EMaterialProperty MatProp;
+        if (!ParseMaterialProperty(MaterialProperty, MatProp))
+        {
+            AddError(FString::Printf(TEXT("outputs[%d]: unknown material property '%s'"), OutputIndex, *MaterialProperty));
+            continue;
+        }
+
+        UMaterialExpression* Expression = FindExpression(ExpressionName);
+        if (!Expression)
+        {
+            AddError(FString::Printf(TEXT("outputs[%d]: could not find expression '%s'"), OutputIndex, *ExpressionName));
+            continue;
+        }
+
+        if (!ConnectExpressionToProperty(Expression, static_cast<int32>(ExprOutputIndexD), MatProp))
+        {
+            AddError(FString::Printf(TEXT("outputs[%d]: failed to connect '%s' to '%s'"), OutputIndex, *ExpressionName, *MaterialProperty));
+            continue;
+        }
+        OutputCount++;
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+
+    // One translation and shader compile for the whole graph
+    if (bCompile)
+    {
+        GetPendingRecompileMaterials().Remove(Material);
+
+        const FString JobId = FMaterialCompileTracker::StartCompile(Material, MaterialPath);
+        if (bWait)
+        {
+            // Statistics need finished shaders; otherwise they arrive with the polled job status
+            FMaterialCompileTracker::FinishCompile(JobId);
+        }
+
+        TSharedPtr<FJsonObject> CompileJson = FMaterialCompileTracker::DescribeJob(JobId);
+        Result->SetStringField(TEXT("job_id"), JobId);
+        Result->SetNumberField(TEXT("compile_time_ms"), CompileJson->GetNumberField(TEXT("compile_time_ms")));
+        Result->SetObjectField(TEXT("compile"), CompileJson);
+
+        const TArray<TSharedPtr<FJsonValue>>* PlatformsJson;
+        if (CompileJson->TryGetArrayField(TEXT("platforms"), PlatformsJson) && PlatformsJson->Num() > 0)
+        {
+            Result->SetObjectField(TEXT("stats"), (*PlatformsJson)[0]->AsObject());
+        }
+    }
+    else
+    {
+        MarkMaterialEdited(Material);
+    }
+
+    // A partially built graph stays in memory (undo reverts it) but is not written over the saved asset
+    const bool bSaved = bSave && Errors.Num() == 0;
+    if (bSaved)
+    {
+        SaveMaterialPackage(Material);
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPMaterialGraphCommands::HandleBuildMaterialGraph: Built '%s' with %d nodes, %d links, %d outputs, %d errors"),
+        *MaterialPath, NodesJson.Num(), LinkCount, OutputCount, Errors.Num());
+
+    Result->SetBoolField(TEXT("success"), Errors.Num() == 0);
+    if (Errors.Num() > 0)
+    {
+        Result->SetStringField(TEXT("error"), FString::Printf(TEXT("%d graph element(s) failed; first: %s"),
+            Errors.Num(), *Errors[0]->AsString()));
+    }
+    Result->SetStringField(TEXT("material_path"), Material->GetOutermost()->GetName());
+    Result->SetBoolField(TEXT("created"), bCreated);
+    Result->SetBoolField(TEXT("compiled"), bCompile);
+    Result->SetBoolField(TEXT("saved"), bSaved);
+    Result->SetNumberField(TEXT("node_count"), NodesJson.Num());
+    Result->SetNumberField(TEXT("link_count"), LinkCount);
+    Result->SetNumberField(TEXT("output_count"), OutputCount);
+    Result->SetArrayField(TEXT("nodes"), NodesJson);
+    Result->SetArrayField(TEXT("errors"), Errors);
 
     return Result;
 }
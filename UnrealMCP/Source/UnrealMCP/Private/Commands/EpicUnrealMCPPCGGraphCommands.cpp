@@ -5,6 +5,9 @@
 #include "Commands/PCGGraph/PCGNodeConnector.h"
 #include "Commands/PCGGraph/PCGNodePropertyManager.h"
 #include "Commands/PCGGraph/PCGParameterManager.h"
+#include "Commands/PCGGraph/PCGGenerationTracker.h"
+#include "Commands/PCGGraph/PCGGraphBuilder.h"
+#include "Commands/PCGGraph/PCGOutputExporter.h"
 
 FEpicUnrealMCPPCGGraphCommands::FEpicUnrealMCPPCGGraphCommands()
 {
@@ -64,6 +67,22 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPPCGGraphCommands::HandleCommand(const FStr
     {
         return HandleGetPCGNodeProperty(Params);
     }
+    else if (CommandType == TEXT("generate_pcg_all"))
+    {
+        return HandleGeneratePCGAll(Params);
+    }
+    else if (CommandType == TEXT("get_pcg_job_status"))
+    {
+        return HandleGetPCGJobStatus(Params);
+    }
+    else if (CommandType == TEXT("build_pcg_graph"))
+    {
+        return HandleBuildPCGGraph(Params);
+    }
+    else if (CommandType == TEXT("get_pcg_output"))
+    {
+        return HandleGetPCGOutput(Params);
+    }
 
     return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown PCG graph command: %s"), *CommandType));
 }
@@ -277,6 +296,13 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPPCGGraphCommands::HandleGeneratePCG(const
     return FPCGParameterManager::GeneratePCG(Params);
 }
 
+TSharedPtr<FJsonObject> FEpicUnrealMCPPCGGraphCommands::HandleGeneratePCGAll(const TSharedPtr<FJsonObject>& Params)
+{
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPPCGGraphCommands::HandleGeneratePCGAll: Generating matching PCG components"));
+
+    return FPCGParameterManager::GeneratePCGAll(Params);
+}
+
 TSharedPtr<FJsonObject> FEpicUnrealMCPPCGGraphCommands::HandleGetPCGNodeProperty(const TSharedPtr<FJsonObject>& Params)
 {
     FString GraphPath;
@@ -302,3 +328,41 @@ TSharedPtr<FJsonObject> FEpicUnrealMCPPCGGraphCommands::HandleGetPCGNodeProperty
 
     return FPCGNodePropertyManager::GetNodeProperty(Params);
 }
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPCGGraphCommands::HandleGetPCGJobStatus(const TSharedPtr<FJsonObject>& Params)
+{
+    if (!Params->HasField(TEXT("job_id")) && !Params->HasField(TEXT("batch_id")))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'job_id' or 'batch_id' parameter"));
+    }
+
+    return FPCGGenerationTracker::GetJobStatus(Params);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPCGGraphCommands::HandleBuildPCGGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    FString GraphPath;
+    FString GraphName;
+    if (!Params->TryGetStringField(TEXT("graph_path"), GraphPath) && !Params->TryGetStringField(TEXT("graph_name"), GraphName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'graph_path' or 'graph_name' parameter"));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPPCGGraphCommands::HandleBuildPCGGraph: Building PCG graph '%s'"),
+        GraphPath.IsEmpty() ? *GraphName : *GraphPath);
+
+    return FPCGGraphBuilder::BuildPCGGraph(Params);
+}
+
+TSharedPtr<FJsonObject> FEpicUnrealMCPPCGGraphCommands::HandleGetPCGOutput(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ActorName;
+    if (!Params->TryGetStringField(TEXT("actor_name"), ActorName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("FEpicUnrealMCPPCGGraphCommands::HandleGetPCGOutput: Exporting PCG output of '%s'"), *ActorName);
+
+    return FPCGOutputExporter::GetPCGOutput(Params);
+}
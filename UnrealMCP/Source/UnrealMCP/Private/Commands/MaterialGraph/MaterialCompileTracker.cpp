@@ -0,0 +1,302 @@
+#include "Commands/MaterialGraph/MaterialCompileTracker.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPJobRegistry.h"
+#include "MaterialEditingLibrary.h"
+#include "Materials/Material.h"
+#include "MaterialShared.h"
+#include "ShaderCompiler.h"
+#include "RHI.h"
+#include "Containers/Ticker.h"
+
+#if __has_include("DataDrivenShaderPlatformInfo.h")
+#include "DataDrivenShaderPlatformInfo.h"
+#define MCP_HAS_DATA_DRIVEN_SHADER_PLATFORM_INFO 1
+#else
+#define MCP_HAS_DATA_DRIVEN_SHADER_PLATFORM_INFO 0
+#endif
+
+// Finished jobs kept around for status queries before the oldest are dropped
+static constexpr int32 MaxFinishedMaterialJobs = 256;
+
+// How often running jobs are checked for shader completion
+static constexpr float MaterialCompilePollInterval = 0.05f;
+
+enum class EMaterialCompileJobState : uint8
+{
+    Compiling,
+    Completed,
+    Failed,
+    Cancelled
+};
+
+struct FMaterialCompileJob
+{
+    FString JobId;
+    FString MaterialPath;
+    TWeakObjectPtr<UMaterial> Material;
+    EMaterialCompileJobState State = EMaterialCompileJobState::Compiling;
+    FString Message;
+    double StartTime = 0.0;
+    double TranslateEndTime = 0.0;
+    double EndTime = 0.0;
+
+    // Captured when the job finishes, so later edits do not change the report
+    TSharedPtr<FJsonObject> Stats;
+};
+
+static bool IsMaterialJobDone(const FMaterialCompileJob& Job)
+{
+    return Job.State != EMaterialCompileJobState::Compiling;
+}
+
+// Helper to access the job registry (game thread only)
+static TEpicUnrealMCPJobRegistry<FMaterialCompileJob>& GetMaterialCompileJobs()
+{
+    static TEpicUnrealMCPJobRegistry<FMaterialCompileJob> Jobs(MaxFinishedMaterialJobs, &IsMaterialJobDone);
+    return Jobs;
+}
+
+static FTSTicker::FDelegateHandle& GetMaterialCompileTickerHandle()
+{
+    static FTSTicker::FDelegateHandle Handle;
+    return Handle;
+}
+
+static const TCHAR* MaterialJobStateToString(EMaterialCompileJobState State)
+{
+    switch (State)
+    {
+    case EMaterialCompileJobState::Compiling: return TEXT("compiling");
+    case EMaterialCompileJobState::Completed: return TEXT("completed");
+    case EMaterialCompileJobState::Failed:    return TEXT("failed");
+    case EMaterialCompileJobState::Cancelled: return TEXT("cancelled");
+    }
+    return TEXT("unknown");
+}
+
+// Helper to find the resource the editor renders with
+static FMaterialResource* GetEditorMaterialResource(UMaterial* Material)
+{
+    return Material ? Material->GetMaterialResource(GMaxRHIFeatureLevel) : nullptr;
+}
+
+// Helper to check whether a job's shaders are done (or can never finish)
+static bool IsMaterialJobCompiled(const FMaterialCompileJob& Job)
+{
+    FMaterialResource* Resource = GetEditorMaterialResource(Job.Material.Get());
+    return !Resource || Resource->IsCompilationFinished();
+}
+
+// Helper to describe the shader cost on the editor's shader platform
+static TSharedPtr<FJsonObject> BuildPlatformStats(UMaterial* Material)
+{
+    TSharedPtr<FJsonObject> PlatformJson = MakeShareable(new FJsonObject);
+
+#if MCP_HAS_DATA_DRIVEN_SHADER_PLATFORM_INFO
+    PlatformJson->SetStringField(TEXT("shader_platform"), FDataDrivenShaderPlatformInfo::GetName(GMaxRHIShaderPlatform).ToString());
+#else
+    PlatformJson->SetStringField(TEXT("shader_platform"), FString::Printf(TEXT("SP_%d"), static_cast<int32>(GMaxRHIShaderPlatform)));
+#endif
+    FString FeatureLevelName;
+    GetFeatureLevelName(GMaxRHIFeatureLevel, FeatureLevelName);
+    PlatformJson->SetStringField(TEXT("feature_level"), FeatureLevelName);
+
+    // Only called once compilation finished, so this does not block
+    const FMaterialStatistics Stats = UMaterialEditingLibrary::GetStatistics(Material);
+    PlatformJson->SetNumberField(TEXT("vertex_shader_instructions"), Stats.NumVertexShaderInstructions);
+    PlatformJson->SetNumberField(TEXT("pixel_shader_instructions"), Stats.NumPixelShaderInstructions);
+    PlatformJson->SetNumberField(TEXT("samplers"), Stats.NumSamplers);
+    PlatformJson->SetNumberField(TEXT("vertex_texture_samples"), Stats.NumVertexTextureSamples);
+    PlatformJson->SetNumberField(TEXT("pixel_texture_samples"), Stats.NumPixelTextureSamples);
+    PlatformJson->SetNumberField(TEXT("virtual_texture_samples"), Stats.NumVirtualTextureSamples);
+    PlatformJson->SetNumberField(TEXT("uv_scalars"), Stats.NumUVScalars);
+    PlatformJson->SetNumberField(TEXT("interpolator_scalars"), Stats.NumInterpolatorScalars);
+
+    return PlatformJson;
+}
+
+// Helper to move a job to a terminal state, capturing errors and statistics from its resource
+static void FinishMaterialJob(FMaterialCompileJob& Job, const FString& CancelMessage = FString())
+{
+    if (Job.State != EMaterialCompileJobState::Compiling)
+    {
+        return;
+    }
+
+    Job.EndTime = FPlatformTime::Seconds();
+
+    UMaterial* Material = Job.Material.Get();
+    if (!CancelMessage.IsEmpty() || !Material)
+    {
+        Job.State = EMaterialCompileJobState::Cancelled;
+        Job.Message = CancelMessage.IsEmpty() ? TEXT("Material was unloaded before compilation finished") : CancelMessage;
+        return;
+    }
+
+    Job.Stats = MakeShareable(new FJsonObject);
+
+    TArray<TSharedPtr<FJsonValue>> ErrorsJson;
+    if (FMaterialResource* Resource = GetEditorMaterialResource(Material))
+    {
+        for (const FString& CompileError : Resource->GetCompileErrors())
+        {
+            ErrorsJson.Add(MakeShareable(new FJsonValueString(CompileError)));
+        }
+    }
+    Job.Stats->SetArrayField(TEXT("errors"), ErrorsJson);
+
+    TArray<TSharedPtr<FJsonValue>> PlatformsJson;
+    PlatformsJson.Add(MakeShareable(new FJsonValueObject(BuildPlatformStats(Material))));
+    Job.Stats->SetArrayField(TEXT("platforms"), PlatformsJson);
+
+    Job.State = ErrorsJson.Num() > 0 ? EMaterialCompileJobState::Failed : EMaterialCompileJobState::Completed;
+    Job.Message = ErrorsJson.Num() > 0
+        ? FString::Printf(TEXT("Compilation finished with %d error(s)"), ErrorsJson.Num())
+        : TEXT("Compilation finished");
+
+    UE_LOG(LogTemp, Display, TEXT("FMaterialCompileTracker: '%s' %s in %.1f ms"),
+        *Job.MaterialPath, MaterialJobStateToString(Job.State), (Job.EndTime - Job.StartTime) * 1000.0);
+}
+
+// Core ticker callback: finish jobs whose shaders are done, stop ticking when none are left
+static bool TickMaterialCompileJobs(float DeltaTime)
+{
+    bool bAnyCompiling = false;
+    for (TPair<FString, FMaterialCompileJob>& Pair : GetMaterialCompileJobs().GetJobs())
+    {
+        FMaterialCompileJob& Job = Pair.Value;
+        if (Job.State != EMaterialCompileJobState::Compiling)
+        {
+            continue;
+        }
+
+        if (IsMaterialJobCompiled(Job))
+        {
+            FinishMaterialJob(Job);
+        }
+        else
+        {
+            bAnyCompiling = true;
+        }
+    }
+
+    if (!bAnyCompiling)
+    {
+        GetMaterialCompileTickerHandle().Reset();
+        GetMaterialCompileJobs().PruneFinished();
+    }
+    return bAnyCompiling;
+}
+
+FString FMaterialCompileTracker::StartCompile(UMaterial* Material, const FString& MaterialPath)
+{
+    // A newer compile of the same material makes earlier running jobs meaningless
+    for (TPair<FString, FMaterialCompileJob>& Pair : GetMaterialCompileJobs().GetJobs())
+    {
+        if (Pair.Value.State == EMaterialCompileJobState::Compiling && Pair.Value.Material.Get() == Material)
+        {
+            FinishMaterialJob(Pair.Value, TEXT("Superseded by a newer compile request"));
+        }
+    }
+
+    FString JobId;
+    FMaterialCompileJob& Job = GetMaterialCompileJobs().Add(JobId);
+    Job.JobId = JobId;
+    Job.MaterialPath = MaterialPath;
+    Job.Material = Material;
+    Job.StartTime = FPlatformTime::Seconds();
+
+    // Translation runs here; shader compilation is queued on the shader compiling manager
+    UMaterialEditingLibrary::RecompileMaterial(Material);
+
+    FMaterialCompileJob& Started = GetMaterialCompileJobs().FindChecked(JobId);
+    Started.TranslateEndTime = FPlatformTime::Seconds();
+
+    // Shader maps served from the DDC can be complete already
+    if (IsMaterialJobCompiled(Started))
+    {
+        FinishMaterialJob(Started);
+        GetMaterialCompileJobs().PruneFinished();
+    }
+    else if (!GetMaterialCompileTickerHandle().IsValid())
+    {
+        GetMaterialCompileTickerHandle() = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateStatic(&TickMaterialCompileJobs), MaterialCompilePollInterval);
+    }
+
+    return JobId;
+}
+
+void FMaterialCompileTracker::FinishCompile(const FString& JobId)
+{
+    FMaterialCompileJob* Job = GetMaterialCompileJobs().Find(JobId);
+    if (!Job || Job->State != EMaterialCompileJobState::Compiling)
+    {
+        return;
+    }
+
+    if (FMaterialResource* Resource = GetEditorMaterialResource(Job->Material.Get()))
+    {
+        Resource->FinishCompilation();
+    }
+    FinishMaterialJob(*Job);
+}
+
+TSharedPtr<FJsonObject> FMaterialCompileTracker::DescribeJob(const FString& JobId)
+{
+    const FMaterialCompileJob* Job = GetMaterialCompileJobs().Find(JobId);
+    if (!Job)
+    {
+        return nullptr;
+    }
+
+    const bool bCompiling = Job->State == EMaterialCompileJobState::Compiling;
+    const double Now = FPlatformTime::Seconds();
+
+    TSharedPtr<FJsonObject> Status = MakeShareable(new FJsonObject);
+    Status->SetStringField(TEXT("job_id"), Job->JobId);
+    Status->SetStringField(TEXT("material_path"), Job->MaterialPath);
+    Status->SetStringField(TEXT("state"), MaterialJobStateToString(Job->State));
+    Status->SetBoolField(TEXT("done"), !bCompiling);
+    Status->SetNumberField(TEXT("compile_time_ms"), ((bCompiling ? Now : Job->EndTime) - Job->StartTime) * 1000.0);
+    if (Job->TranslateEndTime > 0.0)
+    {
+        Status->SetNumberField(TEXT("translate_ms"), (Job->TranslateEndTime - Job->StartTime) * 1000.0);
+    }
+    if (bCompiling && GShaderCompilingManager)
+    {
+        Status->SetNumberField(TEXT("shader_jobs_remaining"), GShaderCompilingManager->GetNumRemainingJobs());
+    }
+    if (!Job->Message.IsEmpty())
+    {
+        Status->SetStringField(TEXT("message"), Job->Message);
+    }
+    if (Job->Stats.IsValid())
+    {
+        for (const auto& Field : Job->Stats->Values)
+        {
+            Status->SetField(Field.Key, Field.Value);
+        }
+    }
+
+    return Status;
+}
+
+TSharedPtr<FJsonObject> FMaterialCompileTracker::GetJobStatus(const TSharedPtr<FJsonObject>& Params)
+{
+    FString JobId;
+    if (!Params->TryGetStringField(TEXT("job_id"), JobId))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+    }
+
+    TSharedPtr<FJsonObject> Result = DescribeJob(JobId);
+    if (!Result.IsValid())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown material compile job '%s'"), *JobId));
+    }
+
+    Result->SetBoolField(TEXT("success"), true);
+    return Result;
+}
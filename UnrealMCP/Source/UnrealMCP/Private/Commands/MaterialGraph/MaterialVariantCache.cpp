@@ -0,0 +1,611 @@
+#include "Commands/MaterialGraph/MaterialVariantCache.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "MaterialEditingLibrary.h"
+#include "Materials/MaterialInterface.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Materials/MaterialInstanceDynamic.h"
+#include "Factories/MaterialInstanceConstantFactoryNew.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Components/MeshComponent.h"
+#include "Engine/Level.h"
+#include "Engine/Texture.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Editor.h"
+#include "Misc/PackageName.h"
+#include "Misc/SecureHash.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+const TCHAR* FMaterialVariantCache::DefaultAssetFolder = TEXT("/Game/MCP/MaterialVariants");
+
+// Values are rounded to this many decimals in the key, so float noise from JSON does not split variants
+static constexpr float VariantKeyQuantization = 10000.0f;
+
+// Helper to access the session cache: mode-prefixed key -> variant
+static TMap<FString, TWeakObjectPtr<UMaterialInterface>>& GetMaterialVariants()
+{
+    static TMap<FString, TWeakObjectPtr<UMaterialInterface>> Variants;
+    return Variants;
+}
+
+// Helper to remember which instances the cache produced, so they are never used as a parent
+static TSet<TWeakObjectPtr<UMaterialInterface>>& GetCreatedVariants()
+{
+    static TSet<TWeakObjectPtr<UMaterialInterface>> Created;
+    return Created;
+}
+
+static FString QuantizeVariantValue(float Value)
+{
+    return FString::Printf(TEXT("%d"), FMath::RoundToInt(Value * VariantKeyQuantization));
+}
+
+// ============================================================================
+// FMaterialVariantParams
+// ============================================================================
+bool FMaterialVariantParams::FromJson(const TSharedPtr<FJsonObject>& Json, FMaterialVariantParams& Out, FString& OutError)
+{
+    if (!Json.IsValid())
+    {
+        return true;
+    }
+
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Json->Values)
+    {
+        const FName ParamName(*Pair.Key);
+
+        if (Pair.Value->Type == EJson::Array)
+        {
+            const TArray<TSharedPtr<FJsonValue>>& Components = Pair.Value->AsArray();
+            if (Components.Num() < 3 || Components.Num() > 4)
+            {
+                OutError = FString::Printf(TEXT("Vector parameter '%s' needs 3 or 4 components"), *Pair.Key);
+                return false;
+            }
+
+            FLinearColor Color(
+                Components[0]->AsNumber(),
+                Components[1]->AsNumber(),
+                Components[2]->AsNumber(),
+                Components.Num() == 4 ? Components[3]->AsNumber() : 1.0f);
+            Out.VectorValues.Add(ParamName, Color);
+        }
+        else if (Pair.Value->Type == EJson::Number)
+        {
+            Out.ScalarValues.Add(ParamName, Pair.Value->AsNumber());
+        }
+        else if (Pair.Value->Type == EJson::String)
+        {
+            Out.TextureValues.Add(ParamName, FSoftObjectPath(Pair.Value->AsString()));
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Parameter '%s' must be an array (vector), number (scalar) or string (texture)"), *Pair.Key);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+FString FMaterialVariantParams::GetCanonicalKey() const
+{
+    TArray<FString> Entries;
+
+    for (const TPair<FName, FLinearColor>& Pair : VectorValues)
+    {
+        Entries.Add(FString::Printf(TEXT("v:%s=%s,%s,%s,%s"), *Pair.Key.ToString(),
+            *QuantizeVariantValue(Pair.Value.R), *QuantizeVariantValue(Pair.Value.G),
+            *QuantizeVariantValue(Pair.Value.B), *QuantizeVariantValue(Pair.Value.A)));
+    }
+    for (const TPair<FName, float>& Pair : ScalarValues)
+    {
+        Entries.Add(FString::Printf(TEXT("s:%s=%s"), *Pair.Key.ToString(), *QuantizeVariantValue(Pair.Value)));
+    }
+    for (const TPair<FName, FSoftObjectPath>& Pair : TextureValues)
+    {
+        Entries.Add(FString::Printf(TEXT("t:%s=%s"), *Pair.Key.ToString(), *Pair.Value.ToString()));
+    }
+
+    // Parameter names are case-insensitive, so sort that way too
+    Entries.Sort([](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::IgnoreCase) < 0; });
+    return FString::Join(Entries, TEXT(";"));
+}
+
+// ============================================================================
+// Helper: Apply overrides to a new instance
+// ============================================================================
+static bool LoadVariantTextures(const FMaterialVariantParams& Params, TMap<FName, UTexture*>& OutTextures, FString& OutError)
+{
+    for (const TPair<FName, FSoftObjectPath>& Pair : Params.TextureValues)
+    {
+        UTexture* Texture = Cast<UTexture>(Pair.Value.TryLoad());
+        if (!Texture)
+        {
+            OutError = FString::Printf(TEXT("Texture not found for parameter '%s': %s"), *Pair.Key.ToString(), *Pair.Value.ToString());
+            return false;
+        }
+        OutTextures.Add(Pair.Key, Texture);
+    }
+    return true;
+}
+
+static void ApplyVariantToConstant(UMaterialInstanceConstant* Instance, const FMaterialVariantParams& Params, const TMap<FName, UTexture*>& Textures)
+{
+    for (const TPair<FName, FLinearColor>& Pair : Params.VectorValues)
+    {
+        UMaterialEditingLibrary::SetMaterialInstanceVectorParameterValue(Instance, Pair.Key, Pair.Value);
+    }
+    for (const TPair<FName, float>& Pair : Params.ScalarValues)
+    {
+        UMaterialEditingLibrary::SetMaterialInstanceScalarParameterValue(Instance, Pair.Key, Pair.Value);
+    }
+    for (const TPair<FName, UTexture*>& Pair : Textures)
+    {
+        UMaterialEditingLibrary::SetMaterialInstanceTextureParameterValue(Instance, Pair.Key, Pair.Value);
+    }
+    UMaterialEditingLibrary::UpdateMaterialInstance(Instance);
+}
+
+static void ApplyVariantToDynamic(UMaterialInstanceDynamic* Instance, const FMaterialVariantParams& Params, const TMap<FName, UTexture*>& Textures)
+{
+    for (const TPair<FName, FLinearColor>& Pair : Params.VectorValues)
+    {
+        Instance->SetVectorParameterValue(Pair.Key, Pair.Value);
+    }
+    for (const TPair<FName, float>& Pair : Params.ScalarValues)
+    {
+        Instance->SetScalarParameterValue(Pair.Key, Pair.Value);
+    }
+    for (const TPair<FName, UTexture*>& Pair : Textures)
+    {
+        Instance->SetTextureParameterValue(Pair.Key, Pair.Value);
+    }
+}
+
+// True if an existing constant instance has exactly this parent and these overrides
+static bool ConstantMatchesVariant(UMaterialInstanceConstant* Instance, UMaterialInterface* Parent, const FMaterialVariantParams& Params,
+    const TMap<FName, UTexture*>& Textures)
+{
+    if (Instance->Parent != Parent
+        || Instance->VectorParameterValues.Num() != Params.VectorValues.Num()
+        || Instance->ScalarParameterValues.Num() != Params.ScalarValues.Num()
+        || Instance->TextureParameterValues.Num() != Textures.Num())
+    {
+        return false;
+    }
+
+    for (const FVectorParameterValue& Value : Instance->VectorParameterValues)
+    {
+        const FLinearColor* Wanted = Params.VectorValues.Find(Value.ParameterInfo.Name);
+        if (!Wanted
+            || QuantizeVariantValue(Wanted->R) != QuantizeVariantValue(Value.ParameterValue.R)
+            || QuantizeVariantValue(Wanted->G) != QuantizeVariantValue(Value.ParameterValue.G)
+            || QuantizeVariantValue(Wanted->B) != QuantizeVariantValue(Value.ParameterValue.B)
+            || QuantizeVariantValue(Wanted->A) != QuantizeVariantValue(Value.ParameterValue.A))
+        {
+            return false;
+        }
+    }
+    for (const FScalarParameterValue& Value : Instance->ScalarParameterValues)
+    {
+        const float* Wanted = Params.ScalarValues.Find(Value.ParameterInfo.Name);
+        if (!Wanted || QuantizeVariantValue(*Wanted) != QuantizeVariantValue(Value.ParameterValue))
+        {
+            return false;
+        }
+    }
+    for (const FTextureParameterValue& Value : Instance->TextureParameterValues)
+    {
+        UTexture* const* Wanted = Textures.Find(Value.ParameterInfo.Name);
+        if (!Wanted || *Wanted != Value.ParameterValue)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// ============================================================================
+// Helper: Strip a previous variant so variants never chain
+// ============================================================================
+static UMaterialInterface* ResolveVariantParent(UMaterialInterface* Material, const FString& AssetFolder)
+{
+    UMaterialInstance* Instance = Cast<UMaterialInstance>(Material);
+    if (!Instance || !Instance->Parent)
+    {
+        return Material;
+    }
+
+    const bool bCreatedByCache = GetCreatedVariants().Contains(Material);
+    const bool bInVariantFolder = Instance->GetOutermost()->GetName().StartsWith(AssetFolder + TEXT("/"));
+    const bool bTransientDynamic = Instance->IsA<UMaterialInstanceDynamic>();
+
+    return (bCreatedByCache || bInVariantFolder || bTransientDynamic) ? Instance->Parent.Get() : Material;
+}
+
+// ============================================================================
+// GetOrCreate
+// ============================================================================
+UMaterialInterface* FMaterialVariantCache::GetOrCreate(UMaterialInterface* Parent, const FMaterialVariantParams& Params, EMaterialVariantMode Mode,
+    const FString& AssetFolder, UObject* DynamicOuter, bool& bOutCreated, FString& OutError)
+{
+    bOutCreated = false;
+
+    if (!Parent)
+    {
+        OutError = TEXT("No parent material");
+        return nullptr;
+    }
+
+    // A dynamic instance in the transient package would be lost when the level or blueprint is saved
+    if (Mode != EMaterialVariantMode::Constant && !DynamicOuter)
+    {
+        OutError = TEXT("Dynamic variants need the object that owns them");
+        return nullptr;
+    }
+
+    FString Folder = AssetFolder.IsEmpty() ? FString(DefaultAssetFolder) : AssetFolder;
+    Folder.RemoveFromEnd(TEXT("/"));
+
+    Parent = ResolveVariantParent(Parent, Folder);
+
+    const FString Key = Parent->GetPathName() + TEXT("|") + Params.GetCanonicalKey();
+    const FString CacheKey = (Mode == EMaterialVariantMode::Constant
+        ? TEXT("constant|") + Folder + TEXT("|")
+        : TEXT("dynamic|") + DynamicOuter->GetPathName() + TEXT("|")) + Key;
+
+    if (const TWeakObjectPtr<UMaterialInterface>* Cached = GetMaterialVariants().Find(CacheKey))
+    {
+        if (UMaterialInterface* Variant = Cached->Get())
+        {
+            return Variant;
+        }
+    }
+
+    TMap<FName, UTexture*> Textures;
+    if (!LoadVariantTextures(Params, Textures, OutError))
+    {
+        return nullptr;
+    }
+
+    UMaterialInterface* Variant = nullptr;
+
+    if (Mode != EMaterialVariantMode::Constant)
+    {
+        UMaterialInstanceDynamic* Instance = UMaterialInstanceDynamic::Create(Parent, DynamicOuter);
+        ApplyVariantToDynamic(Instance, Params, Textures);
+        Variant = Instance;
+        bOutCreated = true;
+    }
+    else
+    {
+        // Deterministic name, so the same variant is found again after an editor restart
+        const FString AssetName = FString::Printf(TEXT("MI_%s_%s"), *Parent->GetName(), *FMD5::HashAnsiString(*Key).Left(12));
+        const FString PackageName = Folder / AssetName;
+
+        UMaterialInstanceConstant* Instance = FindObject<UMaterialInstanceConstant>(nullptr, *(PackageName + TEXT(".") + AssetName));
+        if (!Instance && FPackageName::DoesPackageExist(PackageName))
+        {
+            Instance = LoadObject<UMaterialInstanceConstant>(nullptr, *(PackageName + TEXT(".") + AssetName));
+        }
+
+        // A same-named asset may have been edited by hand (or be a hash collision): repair it before reuse
+        if (Instance && !ConstantMatchesVariant(Instance, Parent, Params, Textures))
+        {
+            UE_LOG(LogTemp, Display, TEXT("FMaterialVariantCache::GetOrCreate: Repairing %s, its parent or overrides differ"), *Instance->GetPathName());
+            Instance->Modify();
+            UMaterialEditingLibrary::ClearAllMaterialInstanceParameters(Instance);
+            UMaterialEditingLibrary::SetMaterialInstanceParent(Instance, Parent);
+            ApplyVariantToConstant(Instance, Params, Textures);
+            Instance->MarkPackageDirty();
+        }
+
+        if (!Instance)
+        {
+            UPackage* Package = CreatePackage(*PackageName);
+            UMaterialInstanceConstantFactoryNew* Factory = NewObject<UMaterialInstanceConstantFactoryNew>();
+            Factory->InitialParent = Parent;
+
+            Instance = Cast<UMaterialInstanceConstant>(Factory->FactoryCreateNew(
+                UMaterialInstanceConstant::StaticClass(), Package, *AssetName, RF_Public | RF_Standalone, nullptr, GWarn));
+            if (!Instance)
+            {
+                OutError = FString::Printf(TEXT("Failed to create material instance: %s"), *PackageName);
+                return nullptr;
+            }
+
+            ApplyVariantToConstant(Instance, Params, Textures);
+            FAssetRegistryModule::AssetCreated(Instance);
+            Package->MarkPackageDirty();
+            bOutCreated = true;
+        }
+
+        Variant = Instance;
+    }
+
+    GetMaterialVariants().Add(CacheKey, Variant);
+    GetCreatedVariants().Add(Variant);
+
+    UE_LOG(LogTemp, Display, TEXT("FMaterialVariantCache::GetOrCreate: %s variant %s of %s"),
+        bOutCreated ? TEXT("Created") : TEXT("Reused"), *Variant->GetPathName(), *Parent->GetPathName());
+
+    return Variant;
+}
+
+bool FMaterialVariantCache::SaveVariant(UMaterialInterface* Variant)
+{
+    UMaterialInstanceConstant* Instance = Cast<UMaterialInstanceConstant>(Variant);
+    if (!Instance || !Instance->GetOutermost()->IsDirty())
+    {
+        return false;
+    }
+
+    UPackage* Package = Instance->GetOutermost();
+    FString PackageFilename = FPackageName::LongPackageNameToFilename(Package->GetName(), FPackageName::GetAssetPackageExtension());
+    FSavePackageArgs SaveArgs;
+    SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+    return UPackage::SavePackage(Package, Instance, *PackageFilename, SaveArgs);
+}
+
+bool FMaterialVariantCache::ParseMode(const FString& ModeName, EMaterialVariantMode& OutMode)
+{
+    if (ModeName.IsEmpty() || ModeName.Equals(TEXT("constant"), ESearchCase::IgnoreCase))
+    {
+        OutMode = EMaterialVariantMode::Constant;
+        return true;
+    }
+    if (ModeName.Equals(TEXT("dynamic"), ESearchCase::IgnoreCase))
+    {
+        OutMode = EMaterialVariantMode::Dynamic;
+        return true;
+    }
+    if (ModeName.Equals(TEXT("shared_dynamic"), ESearchCase::IgnoreCase))
+    {
+        OutMode = EMaterialVariantMode::SharedDynamic;
+        return true;
+    }
+    return false;
+}
+
+static const TCHAR* MaterialVariantModeToString(EMaterialVariantMode Mode)
+{
+    switch (Mode)
+    {
+    case EMaterialVariantMode::Constant:      return TEXT("constant");
+    case EMaterialVariantMode::Dynamic:       return TEXT("dynamic");
+    case EMaterialVariantMode::SharedDynamic: return TEXT("shared_dynamic");
+    }
+    return TEXT("unknown");
+}
+
+UObject* FMaterialVariantCache::GetDynamicOuter(UActorComponent* Component, EMaterialVariantMode Mode)
+{
+    if (!Component || Mode == EMaterialVariantMode::Constant)
+    {
+        return nullptr;
+    }
+    if (Mode == EMaterialVariantMode::Dynamic)
+    {
+        return Component;
+    }
+
+    // A shared instance has to live in the package the components are saved to, or the references would not save
+    if (AActor* Owner = Component->GetOwner())
+    {
+        if (Owner->IsPackageExternal() || !Owner->GetLevel())
+        {
+            return Owner;
+        }
+        return Owner->GetLevel();
+    }
+
+    // Blueprint component templates are outered to the generated class
+    return Component->GetOuter();
+}
+
+// ============================================================================
+// apply_material_variant
+// ============================================================================
+struct FMaterialVariantTarget
+{
+    FString ActorName;
+    FString ComponentName;
+    int32 MaterialSlot = 0;
+};
+
+TSharedPtr<FJsonObject> FMaterialVariantCache::ApplyMaterialVariant(const TSharedPtr<FJsonObject>& Params)
+{
+    FString ParentPath;
+    if (!Params->TryGetStringField(TEXT("parent_material"), ParentPath))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'parent_material' parameter"));
+    }
+
+    UMaterialInterface* Parent = Cast<UMaterialInterface>(StaticLoadObject(UMaterialInterface::StaticClass(), nullptr, *ParentPath));
+    if (!Parent)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Parent material not found: %s"), *ParentPath));
+    }
+
+    FMaterialVariantParams VariantParams;
+    const TSharedPtr<FJsonObject>* ParamsObject = nullptr;
+    FString ParseError;
+    if (Params->TryGetObjectField(TEXT("parameters"), ParamsObject)
+        && !FMaterialVariantParams::FromJson(*ParamsObject, VariantParams, ParseError))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(ParseError);
+    }
+
+    FString ModeName;
+    Params->TryGetStringField(TEXT("mode"), ModeName);
+    EMaterialVariantMode Mode;
+    if (!ParseMode(ModeName, Mode))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(TEXT("Unknown mode '%s' (use constant, dynamic or shared_dynamic)"), *ModeName));
+    }
+
+    FString AssetFolder = DefaultAssetFolder;
+    Params->TryGetStringField(TEXT("asset_folder"), AssetFolder);
+
+    bool bSave = true;
+    Params->TryGetBoolField(TEXT("save"), bSave);
+
+    int32 DefaultSlot = 0;
+    Params->TryGetNumberField(TEXT("material_slot"), DefaultSlot);
+
+    // Parse targets
+    TArray<FMaterialVariantTarget> Targets;
+    const TArray<TSharedPtr<FJsonValue>>* TargetsArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("targets"), TargetsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *TargetsArray)
+        {
+            FMaterialVariantTarget Target;
+            Target.MaterialSlot = DefaultSlot;
+
+            const TSharedPtr<FJsonObject>* TargetObject = nullptr;
+            if (Value->TryGetObject(TargetObject))
+            {
+                (*TargetObject)->TryGetStringField(TEXT("actor_name"), Target.ActorName);
+                (*TargetObject)->TryGetStringField(TEXT("component_name"), Target.ComponentName);
+                (*TargetObject)->TryGetNumberField(TEXT("material_slot"), Target.MaterialSlot);
+            }
+            else
+            {
+                Value->TryGetString(Target.ActorName);
+            }
+
+            if (!Target.ActorName.IsEmpty())
+            {
+                Targets.Add(MoveTemp(Target));
+            }
+        }
+    }
+
+    // Constant mode resolves one shared variant up front; the dynamic modes resolve one per owner below
+    int32 CreatedCount = 0;
+    FString Error;
+    UMaterialInterface* Variant = nullptr;
+    bool bSaved = false;
+    if (Mode == EMaterialVariantMode::Constant)
+    {
+        bool bCreated = false;
+        Variant = GetOrCreate(Parent, VariantParams, Mode, AssetFolder, nullptr, bCreated, Error);
+        if (!Variant)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+        }
+        CreatedCount += bCreated ? 1 : 0;
+        bSaved = bSave && SaveVariant(Variant);
+    }
+
+    // Resolve all target actors in one pass over the level, by label or name
+    TMap<FString, AActor*> ActorsByName;
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (World && Targets.Num() > 0)
+    {
+        TSet<FString> Wanted;
+        for (const FMaterialVariantTarget& Target : Targets)
+        {
+            Wanted.Add(Target.ActorName);
+        }
+
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            AActor* Actor = *It;
+            if (Wanted.Contains(Actor->GetActorLabel()))
+            {
+                ActorsByName.Add(Actor->GetActorLabel(), Actor);
+            }
+            if (Wanted.Contains(Actor->GetName()))
+            {
+                ActorsByName.Add(Actor->GetName(), Actor);
+            }
+        }
+    }
+
+    struct FPendingAssignment
+    {
+        AActor* Actor = nullptr;
+        UMeshComponent* Component = nullptr;
+        int32 MaterialSlot = 0;
+        UMaterialInterface* Variant = nullptr;
+    };
+
+    // Collect every slot and resolve its variant first, so a failure leaves no component changed
+    TArray<FPendingAssignment> Assignments;
+    TArray<TSharedPtr<FJsonValue>> MissingActors;
+
+    for (const FMaterialVariantTarget& Target : Targets)
+    {
+        AActor** FoundActor = ActorsByName.Find(Target.ActorName);
+        if (!FoundActor)
+        {
+            MissingActors.Add(MakeShareable(new FJsonValueString(Target.ActorName)));
+            continue;
+        }
+
+        TArray<UMeshComponent*> MeshComponents;
+        (*FoundActor)->GetComponents<UMeshComponent>(MeshComponents);
+
+        for (UMeshComponent* MeshComponent : MeshComponents)
+        {
+            if (!Target.ComponentName.IsEmpty() && MeshComponent->GetName() != Target.ComponentName)
+            {
+                continue;
+            }
+            if (Target.MaterialSlot < 0 || Target.MaterialSlot >= FMath::Max(MeshComponent->GetNumMaterials(), 1))
+            {
+                continue;
+            }
+
+            if (Mode != EMaterialVariantMode::Constant)
+            {
+                bool bCreated = false;
+                Variant = GetOrCreate(Parent, VariantParams, Mode, AssetFolder, GetDynamicOuter(MeshComponent, Mode), bCreated, Error);
+                if (!Variant)
+                {
+                    return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+                }
+                CreatedCount += bCreated ? 1 : 0;
+            }
+
+            Assignments.Add({*FoundActor, MeshComponent, Target.MaterialSlot, Variant});
+        }
+    }
+
+    TSet<AActor*> TouchedActors;
+    for (const FPendingAssignment& Assignment : Assignments)
+    {
+        Assignment.Component->Modify();
+        Assignment.Component->SetMaterial(Assignment.MaterialSlot, Assignment.Variant);
+        TouchedActors.Add(Assignment.Actor);
+    }
+    const int32 AppliedComponents = Assignments.Num();
+
+    for (AActor* Actor : TouchedActors)
+    {
+        Actor->MarkPackageDirty();
+    }
+
+    const FString VariantPath = Variant ? Variant->GetPathName() : FString();
+    UE_LOG(LogTemp, Display, TEXT("FMaterialVariantCache::ApplyMaterialVariant: Applied %s to %d components on %d actors"),
+        *VariantPath, AppliedComponents, TouchedActors.Num());
+
+    const UMaterialInstance* VariantInstance = Cast<UMaterialInstance>(Variant);
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("variant_path"), VariantPath);
+    Result->SetStringField(TEXT("parent_material"), VariantInstance && VariantInstance->Parent ? VariantInstance->Parent->GetPathName() : ParentPath);
+    Result->SetStringField(TEXT("mode"), MaterialVariantModeToString(Mode));
+    Result->SetBoolField(TEXT("created"), CreatedCount > 0);
+    Result->SetNumberField(TEXT("created_count"), CreatedCount);
+    Result->SetBoolField(TEXT("saved"), bSaved);
+    Result->SetNumberField(TEXT("applied_components"), AppliedComponents);
+    Result->SetNumberField(TEXT("applied_actors"), TouchedActors.Num());
+    Result->SetArrayField(TEXT("missing_actors"), MissingActors);
+
+    return Result;
+}
@@ -0,0 +1,471 @@
+#include "Commands/MeshCatalog/ContentMeshListing.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/StaticMesh.h"
+#include "Algo/BinarySearch.h"
+
+// Listings kept before the least recently used one is dropped
+static constexpr int32 MaxCachedMeshListings = 16;
+
+// Compact a listing once this fraction of its slots are dead (removed or renamed away)
+static constexpr float MeshListingCompactRatio = 0.25f;
+
+struct FContentMeshListingData
+{
+    // Registry package path, without a trailing slash
+    FString RootPath;
+
+    // Slot columns; removed slots are tombstoned until the listing is compacted or rebuilt
+    TArray<FString> ObjectPaths;
+    TArray<FString> Names;
+    TArray<FString> NameLower;
+    TArray<FString> Packages;
+    TBitArray<> Live;
+    int32 LiveCount = 0;
+
+    TMap<FString, int32> PathToSlot;
+
+    // Ascending slot lists per lowercase name trigram
+    TMap<uint64, TArray<int32>> TrigramSlots;
+
+    // Live slots ordered by object path, and each slot's position in that order (rebuilt lazily)
+    TArray<int32> Order;
+    TArray<int32> Rank;
+    bool bRankDirty = true;
+
+    // Slots were appended to Order during the registry's initial scan; sorted before the next query
+    bool bOrderDirty = false;
+
+    double LastUsed = 0.0;
+};
+
+struct FContentMeshListingState
+{
+    TMap<FString, FContentMeshListingData> Listings;
+    bool bDelegatesRegistered = false;
+    FDelegateHandle AddedHandle;
+    FDelegateHandle RemovedHandle;
+    FDelegateHandle RenamedHandle;
+};
+
+static FContentMeshListingState& GetMeshListingState()
+{
+    static FContentMeshListingState State;
+    return State;
+}
+
+static IAssetRegistry& GetMeshListingAssetRegistry()
+{
+    return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+}
+
+static bool IsListedMeshAsset(const FAssetData& AssetData, const FString& RootPath)
+{
+    if (AssetData.AssetClassPath != UStaticMesh::StaticClass()->GetClassPathName())
+    {
+        return false;
+    }
+    const FString PackagePath = AssetData.PackagePath.ToString();
+    return PackagePath == RootPath || PackagePath.StartsWith(RootPath + TEXT("/"));
+}
+
+static uint64 MakeNameTrigram(const TCHAR* Chars)
+{
+    return (static_cast<uint64>(static_cast<uint32>(Chars[0]) & 0x1FFFFF) << 42)
+        | (static_cast<uint64>(static_cast<uint32>(Chars[1]) & 0x1FFFFF) << 21)
+        | static_cast<uint64>(static_cast<uint32>(Chars[2]) & 0x1FFFFF);
+}
+
+static void GetNameTrigrams(const FString& Lower, TArray<uint64>& OutTrigrams)
+{
+    for (int32 Index = 0; Index + 3 <= Lower.Len(); ++Index)
+    {
+        OutTrigrams.AddUnique(MakeNameTrigram(*Lower + Index));
+    }
+}
+
+static auto MeshListingPathOf(const FContentMeshListingData& Data)
+{
+    return [&Data](int32 Slot) -> const FString& { return Data.ObjectPaths[Slot]; };
+}
+
+// Append a live slot; slots only grow, so trigram lists stay sorted
+static int32 AddListedSlot(FContentMeshListingData& Data, FString ObjectPath, FString Name, FString Package)
+{
+    const int32 Slot = Data.ObjectPaths.Add(ObjectPath);
+    Data.NameLower.Add(Name.ToLower());
+    Data.Names.Add(MoveTemp(Name));
+    Data.Packages.Add(MoveTemp(Package));
+    Data.Live.Add(true);
+    Data.LiveCount++;
+    Data.PathToSlot.Add(MoveTemp(ObjectPath), Slot);
+
+    TArray<uint64> Trigrams;
+    GetNameTrigrams(Data.NameLower[Slot], Trigrams);
+    for (uint64 Trigram : Trigrams)
+    {
+        Data.TrigramSlots.FindOrAdd(Trigram).Add(Slot);
+    }
+    return Slot;
+}
+
+static void AddListedMesh(FContentMeshListingData& Data, const FAssetData& AssetData, bool bInsertOrder)
+{
+    FString ObjectPath = AssetData.GetObjectPathString();
+    if (Data.PathToSlot.Contains(ObjectPath))
+    {
+        return;
+    }
+
+    const int32 Slot = AddListedSlot(Data, MoveTemp(ObjectPath), AssetData.AssetName.ToString(), AssetData.PackageName.ToString());
+    if (!bInsertOrder)
+    {
+        return;
+    }
+
+    // The initial registry scan reports assets one by one; an ordered insert each would be quadratic
+    if (Data.bOrderDirty || GetMeshListingAssetRegistry().IsLoadingAssets())
+    {
+        Data.Order.Add(Slot);
+        Data.bOrderDirty = true;
+    }
+    else
+    {
+        Data.Order.Insert(Slot, Algo::UpperBoundBy(Data.Order, Data.ObjectPaths[Slot], MeshListingPathOf(Data)));
+    }
+    Data.bRankDirty = true;
+}
+
+// Sort slots appended during the registry scan into Order
+static void FlushMeshListingOrder(FContentMeshListingData& Data)
+{
+    if (!Data.bOrderDirty)
+    {
+        return;
+    }
+    Data.Order.Sort([&Data](int32 A, int32 B) { return Data.ObjectPaths[A] < Data.ObjectPaths[B]; });
+    Data.bOrderDirty = false;
+    Data.bRankDirty = true;
+}
+
+// Rebuild the columns from the live slots, renumbered in path order, dropping dead slots from the trigram lists
+static void CompactMeshListing(FContentMeshListingData& Data)
+{
+    FlushMeshListingOrder(Data);
+
+    FContentMeshListingData Compacted;
+    Compacted.RootPath = Data.RootPath;
+    Compacted.LastUsed = Data.LastUsed;
+    Compacted.ObjectPaths.Reserve(Data.LiveCount);
+    Compacted.Names.Reserve(Data.LiveCount);
+    Compacted.NameLower.Reserve(Data.LiveCount);
+    Compacted.Packages.Reserve(Data.LiveCount);
+    Compacted.Order.Reserve(Data.LiveCount);
+
+    for (int32 Slot : Data.Order)
+    {
+        Compacted.Order.Add(AddListedSlot(Compacted, MoveTemp(Data.ObjectPaths[Slot]), MoveTemp(Data.Names[Slot]), MoveTemp(Data.Packages[Slot])));
+    }
+
+    Data = MoveTemp(Compacted);
+}
+
+static void RemoveListedMesh(FContentMeshListingData& Data, const FString& ObjectPath)
+{
+    int32 Slot = INDEX_NONE;
+    if (!Data.PathToSlot.RemoveAndCopyValue(ObjectPath, Slot))
+    {
+        return;
+    }
+
+    // Trigram lists keep the slot; queries skip dead slots until there are enough to compact
+    Data.Live[Slot] = false;
+    Data.LiveCount--;
+    Data.Order.RemoveSingle(Slot);
+    Data.bRankDirty = true;
+
+    if (Data.ObjectPaths.Num() - Data.LiveCount > Data.ObjectPaths.Num() * MeshListingCompactRatio)
+    {
+        CompactMeshListing(Data);
+    }
+}
+
+static void BuildMeshListing(FContentMeshListingData& Data)
+{
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UStaticMesh::StaticClass()->GetClassPathName());
+    Filter.PackagePaths.Add(*Data.RootPath);
+    Filter.bRecursivePaths = true;
+
+    TArray<FAssetData> AssetDataArray;
+    GetMeshListingAssetRegistry().GetAssets(Filter, AssetDataArray);
+
+    const FString RootPath = Data.RootPath;
+    Data = FContentMeshListingData();
+    Data.RootPath = RootPath;
+    Data.ObjectPaths.Reserve(AssetDataArray.Num());
+    Data.Names.Reserve(AssetDataArray.Num());
+    Data.NameLower.Reserve(AssetDataArray.Num());
+    Data.Packages.Reserve(AssetDataArray.Num());
+
+    for (const FAssetData& AssetData : AssetDataArray)
+    {
+        AddListedMesh(Data, AssetData, false);
+    }
+
+    Data.Order.Reserve(Data.ObjectPaths.Num());
+    for (int32 Slot = 0; Slot < Data.ObjectPaths.Num(); ++Slot)
+    {
+        Data.Order.Add(Slot);
+    }
+    Data.Order.Sort([&Data](int32 A, int32 B) { return Data.ObjectPaths[A] < Data.ObjectPaths[B]; });
+    Data.bRankDirty = true;
+
+    UE_LOG(LogTemp, Display, TEXT("FContentMeshListing::BuildMeshListing: Cached %d meshes under %s"), Data.LiveCount, *Data.RootPath);
+}
+
+static void UpdateMeshListingRanks(FContentMeshListingData& Data)
+{
+    if (!Data.bRankDirty)
+    {
+        return;
+    }
+    Data.Rank.SetNumUninitialized(Data.ObjectPaths.Num());
+    for (int32 Position = 0; Position < Data.Order.Num(); ++Position)
+    {
+        Data.Rank[Data.Order[Position]] = Position;
+    }
+    Data.bRankDirty = false;
+}
+
+// Slots whose name contains the lowercase filter, in listing order
+static void FindFilteredSlots(FContentMeshListingData& Data, const FString& FilterLower, TArray<int32>& OutSlots)
+{
+    if (FilterLower.Len() < 3)
+    {
+        // Too short for a trigram; scan the precomputed lowercase names in order
+        for (int32 Slot : Data.Order)
+        {
+            if (Data.NameLower[Slot].Contains(FilterLower, ESearchCase::CaseSensitive))
+            {
+                OutSlots.Add(Slot);
+            }
+        }
+        return;
+    }
+
+    TArray<uint64> Trigrams;
+    GetNameTrigrams(FilterLower, Trigrams);
+
+    TArray<const TArray<int32>*> Postings;
+    for (uint64 Trigram : Trigrams)
+    {
+        const TArray<int32>* Slots = Data.TrigramSlots.Find(Trigram);
+        if (!Slots)
+        {
+            return;
+        }
+        Postings.Add(Slots);
+    }
+
+    // Start from the rarest trigram so the intersection stays small
+    Postings.Sort([](const TArray<int32>& A, const TArray<int32>& B) { return A.Num() < B.Num(); });
+    OutSlots = *Postings[0];
+    for (int32 Index = 1; Index < Postings.Num() && OutSlots.Num() > 0; ++Index)
+    {
+        FEpicUnrealMCPCommonUtils::IntersectSortedIndices(OutSlots, *Postings[Index]);
+    }
+
+    // Trigrams can match out of sequence; confirm the substring and drop removed slots
+    OutSlots.RemoveAll([&Data, &FilterLower](int32 Slot)
+    {
+        return !Data.Live[Slot] || !Data.NameLower[Slot].Contains(FilterLower, ESearchCase::CaseSensitive);
+    });
+
+    UpdateMeshListingRanks(Data);
+    OutSlots.Sort([&Data](int32 A, int32 B) { return Data.Rank[A] < Data.Rank[B]; });
+}
+
+TSharedPtr<FJsonObject> FContentMeshListing::ListMeshes(const TSharedPtr<FJsonObject>& Params)
+{
+    FString SearchPath;
+    if (!Params->TryGetStringField(TEXT("search_path"), SearchPath))
+    {
+        SearchPath = TEXT("/Game/");
+    }
+
+    FString NameFilter;
+    Params->TryGetStringField(TEXT("name_filter"), NameFilter);
+
+    int32 MaxResults = 100;
+    if (Params->HasField(TEXT("max_results")))
+    {
+        MaxResults = FMath::Max(0, static_cast<int32>(Params->GetNumberField(TEXT("max_results"))));
+    }
+
+    int32 Offset = 0;
+    if (Params->HasField(TEXT("offset")))
+    {
+        Offset = FMath::Max(0, static_cast<int32>(Params->GetNumberField(TEXT("offset"))));
+    }
+
+    bool bRefresh = false;
+    Params->TryGetBoolField(TEXT("refresh"), bRefresh);
+
+    // Ensure path formatting
+    if (!SearchPath.StartsWith(TEXT("/")))
+    {
+        SearchPath = TEXT("/") + SearchPath;
+    }
+    if (!SearchPath.EndsWith(TEXT("/")))
+    {
+        SearchPath += TEXT("/");
+    }
+    FString RootPath = SearchPath;
+    RootPath.RemoveFromEnd(TEXT("/"));
+
+    EnsureDelegatesRegistered();
+
+    const double StartTime = FPlatformTime::Seconds();
+    FContentMeshListingState& State = GetMeshListingState();
+
+    FContentMeshListingData* Data = State.Listings.Find(RootPath);
+    const bool bCached = Data && !bRefresh;
+    if (!Data)
+    {
+        if (State.Listings.Num() >= MaxCachedMeshListings)
+        {
+            FString Oldest;
+            double OldestTime = TNumericLimits<double>::Max();
+            for (const TPair<FString, FContentMeshListingData>& Pair : State.Listings)
+            {
+                if (Pair.Value.LastUsed < OldestTime)
+                {
+                    OldestTime = Pair.Value.LastUsed;
+                    Oldest = Pair.Key;
+                }
+            }
+            State.Listings.Remove(Oldest);
+        }
+
+        Data = &State.Listings.Add(RootPath);
+        Data->RootPath = RootPath;
+    }
+    if (!bCached)
+    {
+        BuildMeshListing(*Data);
+    }
+    FlushMeshListingOrder(*Data);
+    Data->LastUsed = StartTime;
+
+    TArray<int32> FilteredSlots;
+    const bool bFiltered = !NameFilter.IsEmpty();
+    if (bFiltered)
+    {
+        FindFilteredSlots(*Data, NameFilter.ToLower(), FilteredSlots);
+    }
+    const TArray<int32>& Matches = bFiltered ? FilteredSlots : Data->Order;
+
+    TArray<TSharedPtr<FJsonValue>> MeshArray;
+    const int32 End = FMath::Min(Matches.Num(), Offset + MaxResults);
+    for (int32 Index = Offset; Index < End; ++Index)
+    {
+        const int32 Slot = Matches[Index];
+
+        TSharedPtr<FJsonObject> MeshObj = MakeShared<FJsonObject>();
+        MeshObj->SetStringField(TEXT("name"), Data->Names[Slot]);
+        MeshObj->SetStringField(TEXT("path"), Data->ObjectPaths[Slot]);
+        MeshObj->SetStringField(TEXT("package"), Data->Packages[Slot]);
+
+        MeshArray.Add(MakeShared<FJsonValueObject>(MeshObj));
+    }
+
+    const double QueryMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    TSharedPtr<FJsonObject> ResultObj = MakeShared<FJsonObject>();
+    ResultObj->SetArrayField(TEXT("meshes"), MeshArray);
+    ResultObj->SetNumberField(TEXT("count"), MeshArray.Num());
+    ResultObj->SetNumberField(TEXT("total_found"), Data->LiveCount);
+    ResultObj->SetNumberField(TEXT("total_matches"), Matches.Num());
+    ResultObj->SetNumberField(TEXT("offset"), Offset);
+    ResultObj->SetNumberField(TEXT("next_offset"), End < Matches.Num() ? End : -1);
+    ResultObj->SetStringField(TEXT("search_path"), SearchPath);
+    if (bFiltered)
+    {
+        ResultObj->SetStringField(TEXT("name_filter"), NameFilter);
+    }
+    ResultObj->SetBoolField(TEXT("cached"), bCached);
+    ResultObj->SetNumberField(TEXT("query_ms"), QueryMs);
+
+    return ResultObj;
+}
+
+void FContentMeshListing::EnsureDelegatesRegistered()
+{
+    FContentMeshListingState& State = GetMeshListingState();
+    if (State.bDelegatesRegistered)
+    {
+        return;
+    }
+    State.bDelegatesRegistered = true;
+
+    IAssetRegistry& AssetRegistry = GetMeshListingAssetRegistry();
+    State.AddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&FContentMeshListing::OnAssetAdded);
+    State.RemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&FContentMeshListing::OnAssetRemoved);
+    State.RenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FContentMeshListing::OnAssetRenamed);
+}
+
+void FContentMeshListing::UnregisterDelegates()
+{
+    FContentMeshListingState& State = GetMeshListingState();
+    if (!State.bDelegatesRegistered)
+    {
+        return;
+    }
+    State.bDelegatesRegistered = false;
+
+    // The asset registry may already be gone during editor shutdown
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(State.AddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(State.RemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(State.RenamedHandle);
+    }
+    State.AddedHandle.Reset();
+    State.RemovedHandle.Reset();
+    State.RenamedHandle.Reset();
+}
+
+void FContentMeshListing::OnAssetAdded(const FAssetData& AssetData)
+{
+    for (TPair<FString, FContentMeshListingData>& Pair : GetMeshListingState().Listings)
+    {
+        if (IsListedMeshAsset(AssetData, Pair.Value.RootPath))
+        {
+            AddListedMesh(Pair.Value, AssetData, true);
+        }
+    }
+}
+
+void FContentMeshListing::OnAssetRemoved(const FAssetData& AssetData)
+{
+    const FString ObjectPath = AssetData.GetObjectPathString();
+    for (TPair<FString, FContentMeshListingData>& Pair : GetMeshListingState().Listings)
+    {
+        RemoveListedMesh(Pair.Value, ObjectPath);
+    }
+}
+
+void FContentMeshListing::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    for (TPair<FString, FContentMeshListingData>& Pair : GetMeshListingState().Listings)
+    {
+        RemoveListedMesh(Pair.Value, OldObjectPath);
+        if (IsListedMeshAsset(AssetData, Pair.Value.RootPath))
+        {
+            AddListedMesh(Pair.Value, AssetData, true);
+        }
+    }
+}
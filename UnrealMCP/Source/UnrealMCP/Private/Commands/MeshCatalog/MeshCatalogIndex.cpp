@@ -0,0 +1,1413 @@
+#include "Commands/MeshCatalog/MeshCatalogIndex.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "AssetRegistry/AssetData.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/BufferArchive.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Unique.h"
+
+// Sidecar header; bump the version whenever the persisted columns change
+static constexpr uint32 MeshCatalogSidecarMagic = 0x4D434958; // "MCIX"
+static constexpr int32 MeshCatalogSidecarVersion = 1;
+
+// Compact before saving once this fraction of rows are tombstones left by removals and renames
+static constexpr float MeshCatalogCompactRatio = 0.25f;
+
+// Category given to registry meshes the overlay does not describe (matches build_catalog.py)
+static const TCHAR* MeshCatalogDefaultCategory = TEXT("uncategorized");
+
+// Row flags
+static constexpr uint8 MeshCatalogRowHasBounds = 1 << 0;
+static constexpr uint8 MeshCatalogRowMeasuredSize = 1 << 1;   // Size from the overlay, not ApproxSize
+static constexpr uint8 MeshCatalogRowInRegistry = 1 << 2;
+static constexpr uint8 MeshCatalogRowHasIndoorPair = 1 << 3;
+static constexpr uint8 MeshCatalogRowIndoorVariant = 1 << 4;
+static constexpr uint8 MeshCatalogRowRemoved = 1 << 5;
+
+// One mesh before it is split into columns
+struct FMeshCatalogRowInput
+{
+    FString ObjectPath;
+    FString Name;
+    FString Category;
+    FString DisplayName;
+    FString Description;
+    FString Function;
+    TArray<FString> Tags;
+    TArray<FString> StyleTags;
+    TArray<FString> SocketTypes;
+    FVector3f Size = FVector3f::ZeroVector;
+    uint8 Flags = 0;
+};
+
+struct FMeshCatalogData
+{
+    // Persisted
+    FString RootPath;
+    FString OverlayFile;
+    FDateTime OverlayTimestamp;
+    FString AssetPack;
+    TMap<FString, FString> CategoryDescriptions;
+
+    // Lowercase categories, tags and socket types; rows refer to them by index
+    TArray<FString> Strings;
+
+    // Row columns
+    TArray<FString> ObjectPaths;
+    TArray<FString> Names;
+    TArray<FString> NameLower;
+    TArray<FString> TextLower;          // Name, display name, description and function
+    TArray<int32> Categories;
+    TArray<FVector3f> Sizes;
+    TArray<uint8> Flags;
+    TArray<FString> DisplayNames;
+    TArray<FString> Descriptions;
+    TArray<FString> Functions;
+
+    // Variable-length columns: row i owns Ids[Start[i] .. Start[i + 1])
+    TArray<int32> TagStart;
+    TArray<int32> TagIds;
+    TArray<int32> StyleTagStart;
+    TArray<int32> StyleTagIds;
+    TArray<int32> SocketStart;
+    TArray<int32> SocketIds;
+
+    // Derived when loaded; posting lists hold ascending row indices
+    TMap<FString, int32> StringIds;
+    TMap<FString, int32> PathToRow;
+    TMap<FString, TArray<int32>> NameTokenRows;
+    TMap<FString, TArray<int32>> TextTokenRows;
+    TArray<FString> NameTokens;                 // Keys of the token maps, ascending, for prefix ranges
+    TArray<FString> TextTokens;
+    TMap<int32, TArray<int32>> CategoryRows;
+    TMap<int32, TArray<int32>> TagRows;         // Catalog tags and style tags
+    TMap<int32, TArray<int32>> SocketRows;
+    TArray<int32> SizeOrder[3];                 // Rows with bounds, ascending by size on each axis
+    TArray<int32> UnboundedRows;
+    int32 RemovedRows = 0;
+
+    FString Source;
+    bool bDirty = false;
+};
+
+struct FMeshCatalogIndexState
+{
+    TMap<FString, FMeshCatalogData> Catalogs;
+    bool bDelegatesRegistered = false;
+    FDelegateHandle AddedHandle;
+    FDelegateHandle RemovedHandle;
+    FDelegateHandle RenamedHandle;
+    FDelegateHandle UpdatedHandle;
+};
+
+static FMeshCatalogIndexState& GetCatalogIndexState()
+{
+    static FMeshCatalogIndexState State;
+    return State;
+}
+
+static IAssetRegistry& GetCatalogAssetRegistry()
+{
+    return FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+}
+
+static FString GetCatalogSidecarPath(const FString& CatalogName)
+{
+    return FPaths::ConvertRelativePathToFull(
+        FPaths::ProjectSavedDir() / TEXT("MCP") / TEXT("MeshCatalog") / (FPaths::MakeValidFileName(CatalogName, TEXT('_')) + TEXT(".bin")));
+}
+
+static bool IsCatalogMeshAsset(const FAssetData& AssetData, const FString& RootPath)
+{
+    if (AssetData.AssetClassPath != UStaticMesh::StaticClass()->GetClassPathName())
+    {
+        return false;
+    }
+    const FString PackagePath = AssetData.PackagePath.ToString();
+    return PackagePath == RootPath || PackagePath.StartsWith(RootPath + TEXT("/"));
+}
+
+// Full bounds size from the StaticMesh "ApproxSize" tag ("XxYxZ"), available without loading the mesh
+static bool GetApproxMeshSize(const FAssetData& AssetData, FVector3f& OutSize)
+{
+    FString ApproxSize;
+    if (!AssetData.GetTagValue(TEXT("ApproxSize"), ApproxSize))
+    {
+        return false;
+    }
+
+    TArray<FString> Parts;
+    if (ApproxSize.ParseIntoArray(Parts, TEXT("x")) != 3)
+    {
+        return false;
+    }
+    OutSize = FVector3f(FCString::Atof(*Parts[0]), FCString::Atof(*Parts[1]), FCString::Atof(*Parts[2]));
+    return true;
+}
+
+// Split lowercase text into alphanumeric runs, also breaking between letters and digits.
+// Breaks depend only on neighbouring characters, so any token of a substring query lies
+// inside a single token of every text that contains the query.
+static void TokenizeCatalogText(const FString& Text, TArray<FString>& OutTokens)
+{
+    int32 Start = INDEX_NONE;
+    for (int32 Index = 0; Index <= Text.Len(); ++Index)
+    {
+        const bool bAlnum = Index < Text.Len() && FChar::IsAlnum(Text[Index]);
+        if (Start != INDEX_NONE && (!bAlnum || FChar::IsDigit(Text[Index]) != FChar::IsDigit(Text[Index - 1])))
+        {
+            OutTokens.AddUnique(Text.Mid(Start, Index - Start));
+            Start = INDEX_NONE;
+        }
+        if (bAlnum && Start == INDEX_NONE)
+        {
+            Start = Index;
+        }
+    }
+}
+
+static int32 InternCatalogString(FMeshCatalogData& Data, const FString& Value)
+{
+    const FString Lower = Value.ToLower();
+    if (const int32* Existing = Data.StringIds.Find(Lower))
+    {
+        return *Existing;
+    }
+    const int32 Id = Data.Strings.Add(Lower);
+    Data.StringIds.Add(Lower, Id);
+    return Id;
+}
+
+static void AppendCatalogIds(FMeshCatalogData& Data, const TArray<FString>& Values, TArray<int32>& Start, TArray<int32>& Ids)
+{
+    if (Start.Num() == 0)
+    {
+        Start.Add(0);
+    }
+    const int32 RowStart = Start.Last();
+    for (const FString& Value : Values)
+    {
+        const int32 Id = InternCatalogString(Data, Value);
+        if (TArrayView<const int32>(Ids.GetData() + RowStart, Ids.Num() - RowStart).Find(Id) == INDEX_NONE)
+        {
+            Ids.Add(Id);
+        }
+    }
+    Start.Add(Ids.Num());
+}
+
+static TArray<FString> GetCatalogRowStrings(const FMeshCatalogData& Data, const TArray<int32>& Start, const TArray<int32>& Ids, int32 Row)
+{
+    TArray<FString> Values;
+    for (int32 Index = Start[Row]; Index < Start[Row + 1]; ++Index)
+    {
+        Values.Add(Data.Strings[Ids[Index]]);
+    }
+    return Values;
+}
+
+static void AddCatalogTokenRow(TMap<FString, TArray<int32>>& TokenRows, TArray<FString>& SortedTokens, const FString& Token, int32 Row,
+    bool bIncremental)
+{
+    TArray<int32>* Rows = TokenRows.Find(Token);
+    if (!Rows)
+    {
+        Rows = &TokenRows.Add(Token);
+        SortedTokens.Insert(Token, bIncremental ? Algo::LowerBound(SortedTokens, Token) : SortedTokens.Num());
+    }
+    Rows->Add(Row);
+}
+
+// Add a row to the posting lists; rows are indexed in ascending order, so the lists stay sorted.
+// Incremental updates insert into the ordered indices; a full rebuild sorts them once at the end.
+static void IndexCatalogRow(FMeshCatalogData& Data, int32 Row, bool bIncremental)
+{
+    Data.PathToRow.Add(Data.ObjectPaths[Row], Row);
+
+    TArray<FString> Tokens;
+    TokenizeCatalogText(Data.NameLower[Row], Tokens);
+    for (const FString& Token : Tokens)
+    {
+        AddCatalogTokenRow(Data.NameTokenRows, Data.NameTokens, Token, Row, bIncremental);
+    }
+    Tokens.Reset();
+    TokenizeCatalogText(Data.TextLower[Row], Tokens);
+    for (const FString& Token : Tokens)
+    {
+        AddCatalogTokenRow(Data.TextTokenRows, Data.TextTokens, Token, Row, bIncremental);
+    }
+
+    Data.CategoryRows.FindOrAdd(Data.Categories[Row]).Add(Row);
+
+    TArray<int32> RowTags;
+    for (int32 Index = Data.TagStart[Row]; Index < Data.TagStart[Row + 1]; ++Index)
+    {
+        RowTags.AddUnique(Data.TagIds[Index]);
+    }
+    for (int32 Index = Data.StyleTagStart[Row]; Index < Data.StyleTagStart[Row + 1]; ++Index)
+    {
+        RowTags.AddUnique(Data.StyleTagIds[Index]);
+    }
+    for (int32 TagId : RowTags)
+    {
+        Data.TagRows.FindOrAdd(TagId).Add(Row);
+    }
+    for (int32 Index = Data.SocketStart[Row]; Index < Data.SocketStart[Row + 1]; ++Index)
+    {
+        Data.SocketRows.FindOrAdd(Data.SocketIds[Index]).Add(Row);
+    }
+
+    if (!(Data.Flags[Row] & MeshCatalogRowHasBounds))
+    {
+        Data.UnboundedRows.Add(Row);
+    }
+    else if (bIncremental)
+    {
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            const float Value = Data.Sizes[Row][Axis];
+            const int32 Position = Algo::UpperBoundBy(Data.SizeOrder[Axis], Value,
+                [&Data, Axis](int32 Other) { return Data.Sizes[Other][Axis]; });
+            Data.SizeOrder[Axis].Insert(Row, Position);
+        }
+    }
+}
+
+static void RebuildCatalogIndices(FMeshCatalogData& Data)
+{
+    Data.StringIds.Reset();
+    for (int32 Id = 0; Id < Data.Strings.Num(); ++Id)
+    {
+        Data.StringIds.Add(Data.Strings[Id], Id);
+    }
+
+    Data.PathToRow.Reset();
+    Data.NameTokenRows.Reset();
+    Data.TextTokenRows.Reset();
+    Data.NameTokens.Reset();
+    Data.TextTokens.Reset();
+    Data.CategoryRows.Reset();
+    Data.TagRows.Reset();
+    Data.SocketRows.Reset();
+    Data.UnboundedRows.Reset();
+    Data.RemovedRows = 0;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Data.SizeOrder[Axis].Reset();
+    }
+
+    for (int32 Row = 0; Row < Data.ObjectPaths.Num(); ++Row)
+    {
+        if (Data.Flags[Row] & MeshCatalogRowRemoved)
+        {
+            Data.RemovedRows++;
+            continue;
+        }
+        IndexCatalogRow(Data, Row, false);
+        if (Data.Flags[Row] & MeshCatalogRowHasBounds)
+        {
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                Data.SizeOrder[Axis].Add(Row);
+            }
+        }
+    }
+
+    Data.NameTokens.Sort();
+    Data.TextTokens.Sort();
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Data.SizeOrder[Axis].StableSort([&Data, Axis](int32 A, int32 B) { return Data.Sizes[A][Axis] < Data.Sizes[B][Axis]; });
+    }
+}
+
+static int32 AppendCatalogRow(FMeshCatalogData& Data, const FMeshCatalogRowInput& Input, bool bIndex)
+{
+    if (Data.PathToRow.Contains(Input.ObjectPath))
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Row = Data.ObjectPaths.Add(Input.ObjectPath);
+    Data.Names.Add(Input.Name);
+    Data.NameLower.Add(Input.Name.ToLower());
+    Data.TextLower.Add(FString::Printf(TEXT("%s %s %s %s"), *Input.Name, *Input.DisplayName, *Input.Description, *Input.Function).ToLower());
+    Data.Categories.Add(InternCatalogString(Data, Input.Category.IsEmpty() ? MeshCatalogDefaultCategory : Input.Category));
+    Data.Sizes.Add(Input.Size);
+    Data.Flags.Add(Input.Flags);
+    Data.DisplayNames.Add(Input.DisplayName);
+    Data.Descriptions.Add(Input.Description);
+    Data.Functions.Add(Input.Function);
+    AppendCatalogIds(Data, Input.Tags, Data.TagStart, Data.TagIds);
+    AppendCatalogIds(Data, Input.StyleTags, Data.StyleTagStart, Data.StyleTagIds);
+    AppendCatalogIds(Data, Input.SocketTypes, Data.SocketStart, Data.SocketIds);
+
+    if (bIndex)
+    {
+        IndexCatalogRow(Data, Row, true);
+    }
+    else
+    {
+        Data.PathToRow.Add(Input.ObjectPath, Row);
+    }
+    return Row;
+}
+
+static FMeshCatalogRowInput GetCatalogRowInput(const FMeshCatalogData& Data, int32 Row)
+{
+    FMeshCatalogRowInput Input;
+    Input.ObjectPath = Data.ObjectPaths[Row];
+    Input.Name = Data.Names[Row];
+    Input.Category = Data.Strings[Data.Categories[Row]];
+    Input.DisplayName = Data.DisplayNames[Row];
+    Input.Description = Data.Descriptions[Row];
+    Input.Function = Data.Functions[Row];
+    Input.Tags = GetCatalogRowStrings(Data, Data.TagStart, Data.TagIds, Row);
+    Input.StyleTags = GetCatalogRowStrings(Data, Data.StyleTagStart, Data.StyleTagIds, Row);
+    Input.SocketTypes = GetCatalogRowStrings(Data, Data.SocketStart, Data.SocketIds, Row);
+    Input.Size = Data.Sizes[Row];
+    Input.Flags = static_cast<uint8>(Data.Flags[Row] & ~MeshCatalogRowRemoved);
+    return Input;
+}
+
+static FMeshCatalogRowInput MakeRegistryRowInput(const FAssetData& AssetData)
+{
+    FMeshCatalogRowInput Input;
+    Input.ObjectPath = AssetData.GetObjectPathString();
+    Input.Name = AssetData.AssetName.ToString();
+    Input.Flags = MeshCatalogRowInRegistry;
+    if (GetApproxMeshSize(AssetData, Input.Size))
+    {
+        Input.Flags |= MeshCatalogRowHasBounds;
+    }
+    return Input;
+}
+
+static void RemoveCatalogRow(FMeshCatalogData& Data, int32 Row)
+{
+    // Tombstone only; posting lists skip removed rows and compaction drops them
+    Data.Flags[Row] |= MeshCatalogRowRemoved;
+    Data.PathToRow.Remove(Data.ObjectPaths[Row]);
+    Data.RemovedRows++;
+    Data.bDirty = true;
+}
+
+// Replace a registry-derived size (measured overlay sizes are kept)
+static void UpdateCatalogRowSize(FMeshCatalogData& Data, int32 Row, const FAssetData& AssetData)
+{
+    if (Data.Flags[Row] & MeshCatalogRowMeasuredSize)
+    {
+        return;
+    }
+
+    FVector3f Size;
+    if (!GetApproxMeshSize(AssetData, Size) || ((Data.Flags[Row] & MeshCatalogRowHasBounds) && Size.Equals(Data.Sizes[Row])))
+    {
+        return;
+    }
+
+    if (Data.Flags[Row] & MeshCatalogRowHasBounds)
+    {
+        for (int32 Axis = 0; Axis < 3; ++Axis)
+        {
+            Data.SizeOrder[Axis].RemoveSingle(Row);
+        }
+    }
+    else
+    {
+        Data.UnboundedRows.RemoveSingle(Row);
+    }
+
+    Data.Sizes[Row] = Size;
+    Data.Flags[Row] |= MeshCatalogRowHasBounds;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        const int32 Position = Algo::UpperBoundBy(Data.SizeOrder[Axis], Size[Axis],
+            [&Data, Axis](int32 Other) { return Data.Sizes[Other][Axis]; });
+        Data.SizeOrder[Axis].Insert(Row, Position);
+    }
+    Data.bDirty = true;
+}
+
+static void ResetCatalogRows(FMeshCatalogData& Data)
+{
+    Data.Strings.Reset();
+    Data.StringIds.Reset();
+    Data.ObjectPaths.Reset();
+    Data.Names.Reset();
+    Data.NameLower.Reset();
+    Data.TextLower.Reset();
+    Data.Categories.Reset();
+    Data.Sizes.Reset();
+    Data.Flags.Reset();
+    Data.DisplayNames.Reset();
+    Data.Descriptions.Reset();
+    Data.Functions.Reset();
+    Data.TagStart.Reset();
+    Data.TagIds.Reset();
+    Data.StyleTagStart.Reset();
+    Data.StyleTagIds.Reset();
+    Data.SocketStart.Reset();
+    Data.SocketIds.Reset();
+    Data.PathToRow.Reset();
+}
+
+static void CompactCatalog(FMeshCatalogData& Data)
+{
+    TArray<FMeshCatalogRowInput> Inputs;
+    Inputs.Reserve(Data.ObjectPaths.Num() - Data.RemovedRows);
+    for (int32 Row = 0; Row < Data.ObjectPaths.Num(); ++Row)
+    {
+        if (!(Data.Flags[Row] & MeshCatalogRowRemoved))
+        {
+            Inputs.Add(GetCatalogRowInput(Data, Row));
+        }
+    }
+
+    ResetCatalogRows(Data);
+    for (const FMeshCatalogRowInput& Input : Inputs)
+    {
+        AppendCatalogRow(Data, Input, false);
+    }
+    RebuildCatalogIndices(Data);
+}
+
+static void SerializeCatalogColumns(FArchive& Ar, FMeshCatalogData& Data)
+{
+    Ar << Data.RootPath;
+    Ar << Data.OverlayFile;
+    Ar << Data.OverlayTimestamp;
+    Ar << Data.AssetPack;
+    Ar << Data.CategoryDescriptions;
+    Ar << Data.Strings;
+    Ar << Data.ObjectPaths;
+    Ar << Data.Names;
+    Ar << Data.TextLower;
+    Ar << Data.Categories;
+    Ar << Data.Sizes;
+    Ar << Data.Flags;
+    Ar << Data.DisplayNames;
+    Ar << Data.Descriptions;
+    Ar << Data.Functions;
+    Ar << Data.TagStart;
+    Ar << Data.TagIds;
+    Ar << Data.StyleTagStart;
+    Ar << Data.StyleTagIds;
+    Ar << Data.SocketStart;
+    Ar << Data.SocketIds;
+}
+
+static bool SaveCatalogSidecar(const FString& CatalogName, FMeshCatalogData& Data)
+{
+    if (Data.RemovedRows > Data.ObjectPaths.Num() * MeshCatalogCompactRatio)
+    {
+        CompactCatalog(Data);
+    }
+
+    FBufferArchive Writer;
+    uint32 Magic = MeshCatalogSidecarMagic;
+    int32 Version = MeshCatalogSidecarVersion;
+    Writer << Magic;
+    Writer << Version;
+    SerializeCatalogColumns(Writer, Data);
+
+    const FString SidecarPath = GetCatalogSidecarPath(CatalogName);
+    if (!FFileHelper::SaveArrayToFile(Writer, *SidecarPath))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("FMeshCatalogIndex: Failed to write sidecar '%s'"), *SidecarPath);
+        return false;
+    }
+
+    Data.bDirty = false;
+    return true;
+}
+
+// Helper to check one variable-length column: Start has RowCount + 1 ascending offsets into Ids,
+// and every id names an interned string
+static bool IsValidCatalogRangeColumn(const TArray<int32>& Start, const TArray<int32>& Ids, int32 RowCount, int32 StringCount)
+{
+    // AppendCatalogIds writes the leading 0 with the first row, so an empty catalog has no offsets
+    if (RowCount == 0 && Start.Num() == 0)
+    {
+        return Ids.Num() == 0;
+    }
+    if (Start.Num() != RowCount + 1 || Start[0] != 0 || Start.Last() != Ids.Num())
+    {
+        return false;
+    }
+    for (int32 Row = 0; Row < RowCount; ++Row)
+    {
+        if (Start[Row] > Start[Row + 1])
+        {
+            return false;
+        }
+    }
+    for (const int32 Id : Ids)
+    {
+        if (Id < 0 || Id >= StringCount)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Helper to reject a sidecar whose columns disagree (truncated write, or an older layout under the
+// same version); every column is indexed by row without bounds checks afterwards
+static bool IsValidCatalogColumns(const FMeshCatalogData& Data)
+{
+    const int32 RowCount = Data.ObjectPaths.Num();
+    if (Data.Names.Num() != RowCount || Data.TextLower.Num() != RowCount || Data.Categories.Num() != RowCount
+        || Data.Sizes.Num() != RowCount || Data.Flags.Num() != RowCount || Data.DisplayNames.Num() != RowCount
+        || Data.Descriptions.Num() != RowCount || Data.Functions.Num() != RowCount)
+    {
+        return false;
+    }
+
+    const int32 StringCount = Data.Strings.Num();
+    for (const int32 Category : Data.Categories)
+    {
+        if (Category < 0 || Category >= StringCount)
+        {
+            return false;
+        }
+    }
+
+    return IsValidCatalogRangeColumn(Data.TagStart, Data.TagIds, RowCount, StringCount)
+        && IsValidCatalogRangeColumn(Data.StyleTagStart, Data.StyleTagIds, RowCount, StringCount)
+        && IsValidCatalogRangeColumn(Data.SocketStart, Data.SocketIds, RowCount, StringCount);
+}
+
+static bool LoadCatalogSidecar(const FString& CatalogName, const FString& RootPath, const FString& OverlayFile,
+    const FDateTime& OverlayTimestamp, FMeshCatalogData& OutData)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *GetCatalogSidecarPath(CatalogName), FILEREAD_Silent))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(Bytes);
+    uint32 Magic = 0;
+    int32 Version = 0;
+    Reader << Magic;
+    Reader << Version;
+    if (Magic != MeshCatalogSidecarMagic || Version != MeshCatalogSidecarVersion)
+    {
+        return false;
+    }
+
+    SerializeCatalogColumns(Reader, OutData);
+    if (Reader.IsError() || !IsValidCatalogColumns(OutData))
+    {
+        return false;
+    }
+
+    // The sidecar is only valid for the same root and an unchanged overlay file
+    if (OutData.OverlayFile != OverlayFile || OutData.OverlayTimestamp != OverlayTimestamp
+        || (!RootPath.IsEmpty() && OutData.RootPath != RootPath))
+    {
+        return false;
+    }
+
+    OutData.NameLower.Reset(OutData.Names.Num());
+    for (const FString& Name : OutData.Names)
+    {
+        OutData.NameLower.Add(Name.ToLower());
+    }
+    RebuildCatalogIndices(OutData);
+    return true;
+}
+
+static void GetJsonStringArray(const TSharedPtr<FJsonObject>& Object, const TCHAR* Field, TArray<FString>& OutValues)
+{
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (Object->TryGetArrayField(Field, Values))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *Values)
+        {
+            FString String;
+            if (Value.IsValid() && Value->TryGetString(String))
+            {
+                OutValues.Add(String);
+            }
+        }
+    }
+}
+
+// Read the curated catalog JSON into rows, in file order
+static bool ReadCatalogOverlay(FMeshCatalogData& Data, TArray<FMeshCatalogRowInput>& OutRows, FString& OutError)
+{
+    FString JsonText;
+    if (!FFileHelper::LoadFileToString(JsonText, *Data.OverlayFile))
+    {
+        OutError = FString::Printf(TEXT("Could not read catalog overlay '%s'"), *Data.OverlayFile);
+        return false;
+    }
+
+    TSharedPtr<FJsonObject> Root;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonText);
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
+    {
+        OutError = FString::Printf(TEXT("Catalog overlay '%s' is not valid JSON"), *Data.OverlayFile);
+        return false;
+    }
+
+    Root->TryGetStringField(TEXT("asset_pack"), Data.AssetPack);
+    if (Data.RootPath.IsEmpty())
+    {
+        Root->TryGetStringField(TEXT("base_path"), Data.RootPath);
+        Data.RootPath.RemoveFromEnd(TEXT("/"));
+    }
+
+    const TSharedPtr<FJsonObject>* Descriptions = nullptr;
+    if (Root->TryGetObjectField(TEXT("category_descriptions"), Descriptions))
+    {
+        for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : (*Descriptions)->Values)
+        {
+            Data.CategoryDescriptions.Add(Pair.Key.ToLower(), Pair.Value->AsString());
+        }
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Meshes = nullptr;
+    if (!Root->TryGetArrayField(TEXT("meshes"), Meshes))
+    {
+        return true;
+    }
+
+    for (const TSharedPtr<FJsonValue>& MeshValue : *Meshes)
+    {
+        const TSharedPtr<FJsonObject>* MeshObj = nullptr;
+        if (!MeshValue.IsValid() || !MeshValue->TryGetObject(MeshObj))
+        {
+            continue;
+        }
+
+        FMeshCatalogRowInput& Input = OutRows.AddDefaulted_GetRef();
+        (*MeshObj)->TryGetStringField(TEXT("path"), Input.ObjectPath);
+        (*MeshObj)->TryGetStringField(TEXT("name"), Input.Name);
+        (*MeshObj)->TryGetStringField(TEXT("category"), Input.Category);
+        GetJsonStringArray(*MeshObj, TEXT("tags"), Input.Tags);
+
+        const TArray<TSharedPtr<FJsonValue>>* SizeArray = nullptr;
+        if ((*MeshObj)->TryGetArrayField(TEXT("size_cm"), SizeArray) && SizeArray->Num() == 3)
+        {
+            Input.Size = FVector3f(static_cast<float>((*SizeArray)[0]->AsNumber()), static_cast<float>((*SizeArray)[1]->AsNumber()),
+                static_cast<float>((*SizeArray)[2]->AsNumber()));
+            Input.Flags |= MeshCatalogRowHasBounds | MeshCatalogRowMeasuredSize;
+        }
+
+        bool bFlag = false;
+        if ((*MeshObj)->TryGetBoolField(TEXT("has_indoor_pair"), bFlag) && bFlag)
+        {
+            Input.Flags |= MeshCatalogRowHasIndoorPair;
+        }
+        if ((*MeshObj)->TryGetBoolField(TEXT("is_indoor_variant"), bFlag) && bFlag)
+        {
+            Input.Flags |= MeshCatalogRowIndoorVariant;
+        }
+
+        const TSharedPtr<FJsonObject>* Semantics = nullptr;
+        if ((*MeshObj)->TryGetObjectField(TEXT("semantics"), Semantics))
+        {
+            (*Semantics)->TryGetStringField(TEXT("display_name"), Input.DisplayName);
+            (*Semantics)->TryGetStringField(TEXT("description"), Input.Description);
+            (*Semantics)->TryGetStringField(TEXT("function"), Input.Function);
+            GetJsonStringArray(*Semantics, TEXT("style_tags"), Input.StyleTags);
+        }
+
+        const TArray<TSharedPtr<FJsonValue>>* Sockets = nullptr;
+        if ((*MeshObj)->TryGetArrayField(TEXT("sockets"), Sockets))
+        {
+            for (const TSharedPtr<FJsonValue>& SocketValue : *Sockets)
+            {
+                const TSharedPtr<FJsonObject>* SocketObj = nullptr;
+                FString SocketType;
+                if (SocketValue.IsValid() && SocketValue->TryGetObject(SocketObj) && (*SocketObj)->TryGetStringField(TEXT("socket_type"), SocketType))
+                {
+                    Input.SocketTypes.AddUnique(SocketType);
+                }
+            }
+        }
+
+        if (Input.ObjectPath.IsEmpty())
+        {
+            OutRows.Pop();
+        }
+    }
+    return true;
+}
+
+// Build from the overlay (in file order) followed by registry meshes it does not list (by path)
+static bool BuildCatalog(FMeshCatalogData& Data, FString& OutError)
+{
+    TArray<FMeshCatalogRowInput> OverlayRows;
+    if (!Data.OverlayFile.IsEmpty() && !ReadCatalogOverlay(Data, OverlayRows, OutError))
+    {
+        return false;
+    }
+    if (Data.RootPath.IsEmpty())
+    {
+        OutError = TEXT("Provide root_path, or an overlay_file with a base_path");
+        return false;
+    }
+
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UStaticMesh::StaticClass()->GetClassPathName());
+    Filter.PackagePaths.Add(*Data.RootPath);
+    Filter.bRecursivePaths = true;
+
+    TArray<FAssetData> AssetDataArray;
+    GetCatalogAssetRegistry().GetAssets(Filter, AssetDataArray);
+
+    TMap<FString, const FAssetData*> RegistryAssets;
+    RegistryAssets.Reserve(AssetDataArray.Num());
+    for (const FAssetData& AssetData : AssetDataArray)
+    {
+        RegistryAssets.Add(AssetData.GetObjectPathString(), &AssetData);
+    }
+
+    ResetCatalogRows(Data);
+    for (FMeshCatalogRowInput& Input : OverlayRows)
+    {
+        if (const FAssetData** AssetData = RegistryAssets.Find(Input.ObjectPath))
+        {
+            Input.Flags |= MeshCatalogRowInRegistry;
+            if (!(Input.Flags & MeshCatalogRowHasBounds) && GetApproxMeshSize(**AssetData, Input.Size))
+            {
+                Input.Flags |= MeshCatalogRowHasBounds;
+            }
+            RegistryAssets.Remove(Input.ObjectPath);
+        }
+        AppendCatalogRow(Data, Input, false);
+    }
+
+    RegistryAssets.KeySort(TLess<FString>());
+    for (const TPair<FString, const FAssetData*>& Pair : RegistryAssets)
+    {
+        AppendCatalogRow(Data, MakeRegistryRowInput(*Pair.Value), false);
+    }
+
+    RebuildCatalogIndices(Data);
+    Data.Source = TEXT("built");
+    Data.bDirty = true;
+    return true;
+}
+
+// Bring a sidecar-loaded catalog up to date with assets added or removed while the editor was closed
+static void ReconcileCatalog(FMeshCatalogData& Data, int32& OutAdded, int32& OutRemoved)
+{
+    FARFilter Filter;
+    Filter.ClassPaths.Add(UStaticMesh::StaticClass()->GetClassPathName());
+    Filter.PackagePaths.Add(*Data.RootPath);
+    Filter.bRecursivePaths = true;
+
+    TArray<FAssetData> AssetDataArray;
+    GetCatalogAssetRegistry().GetAssets(Filter, AssetDataArray);
+
+    TSet<FString> Present;
+    Present.Reserve(AssetDataArray.Num());
+    for (const FAssetData& AssetData : AssetDataArray)
+    {
+        const FString ObjectPath = AssetData.GetObjectPathString();
+        Present.Add(ObjectPath);
+
+        if (const int32* Row = Data.PathToRow.Find(ObjectPath))
+        {
+            if (!(Data.Flags[*Row] & MeshCatalogRowInRegistry))
+            {
+                Data.Flags[*Row] |= MeshCatalogRowInRegistry;
+                Data.bDirty = true;
+            }
+            UpdateCatalogRowSize(Data, *Row, AssetData);
+        }
+        else
+        {
+            AppendCatalogRow(Data, MakeRegistryRowInput(AssetData), true);
+            Data.bDirty = true;
+            OutAdded++;
+        }
+    }
+
+    for (int32 Row = 0; Row < Data.ObjectPaths.Num(); ++Row)
+    {
+        const uint8 RowFlags = Data.Flags[Row];
+        if ((RowFlags & MeshCatalogRowInRegistry) && !(RowFlags & MeshCatalogRowRemoved) && !Present.Contains(Data.ObjectPaths[Row]))
+        {
+            RemoveCatalogRow(Data, Row);
+            OutRemoved++;
+        }
+    }
+}
+
+static FDateTime GetCatalogOverlayTimestamp(const FString& OverlayFile)
+{
+    return OverlayFile.IsEmpty() ? FDateTime::MinValue() : IFileManager::Get().GetTimeStamp(*OverlayFile);
+}
+
+// Find, load or build the catalog named in Params
+static FMeshCatalogData* ResolveCatalog(const TSharedPtr<FJsonObject>& Params, FString& OutCatalogName, double& OutLoadMs, FString& OutError)
+{
+    if (!Params->TryGetStringField(TEXT("catalog"), OutCatalogName) || OutCatalogName.IsEmpty())
+    {
+        OutError = TEXT("Missing 'catalog' parameter");
+        return nullptr;
+    }
+
+    FString RootPath;
+    if (Params->TryGetStringField(TEXT("root_path"), RootPath) && !RootPath.IsEmpty())
+    {
+        if (!RootPath.StartsWith(TEXT("/")))
+        {
+            RootPath = TEXT("/") + RootPath;
+        }
+        RootPath.RemoveFromEnd(TEXT("/"));
+    }
+
+    FString OverlayFile;
+    Params->TryGetStringField(TEXT("overlay_file"), OverlayFile);
+    if (!OverlayFile.IsEmpty())
+    {
+        FPaths::NormalizeFilename(OverlayFile);
+        if (!FPaths::FileExists(OverlayFile))
+        {
+            OutError = FString::Printf(TEXT("Catalog overlay not found: %s"), *OverlayFile);
+            return nullptr;
+        }
+    }
+
+    bool bRebuild = false;
+    Params->TryGetBoolField(TEXT("rebuild"), bRebuild);
+
+    const FDateTime OverlayTimestamp = GetCatalogOverlayTimestamp(OverlayFile);
+    const double StartTime = FPlatformTime::Seconds();
+    FMeshCatalogIndexState& State = GetCatalogIndexState();
+
+    FMeshCatalogData* Data = State.Catalogs.Find(OutCatalogName);
+    if (Data && !bRebuild && Data->OverlayFile == OverlayFile && Data->OverlayTimestamp == OverlayTimestamp
+        && (RootPath.IsEmpty() || Data->RootPath == RootPath))
+    {
+        // Loaded and kept current by asset registry events
+        Data->Source = TEXT("memory");
+    }
+    else
+    {
+        FMeshCatalogData Loaded;
+        if (!bRebuild && LoadCatalogSidecar(OutCatalogName, RootPath, OverlayFile, OverlayTimestamp, Loaded))
+        {
+            int32 Added = 0;
+            int32 Removed = 0;
+            ReconcileCatalog(Loaded, Added, Removed);
+            Loaded.Source = TEXT("sidecar");
+            UE_LOG(LogTemp, Display, TEXT("FMeshCatalogIndex::ResolveCatalog: Loaded '%s' from sidecar (%d rows, %d added, %d removed since saved)"),
+                *OutCatalogName, Loaded.ObjectPaths.Num() - Loaded.RemovedRows, Added, Removed);
+        }
+        else
+        {
+            Loaded = FMeshCatalogData();
+            Loaded.RootPath = RootPath;
+            Loaded.OverlayFile = OverlayFile;
+            Loaded.OverlayTimestamp = OverlayTimestamp;
+            if (!BuildCatalog(Loaded, OutError))
+            {
+                return nullptr;
+            }
+            UE_LOG(LogTemp, Display, TEXT("FMeshCatalogIndex::ResolveCatalog: Built '%s' with %d rows under %s"),
+                *OutCatalogName, Loaded.ObjectPaths.Num(), *Loaded.RootPath);
+        }
+        Data = &State.Catalogs.Add(OutCatalogName, MoveTemp(Loaded));
+    }
+
+    // Persist builds and event-driven changes; compaction happens here, so indices are rebuilt first if needed
+    if (Data->bDirty)
+    {
+        SaveCatalogSidecar(OutCatalogName, *Data);
+    }
+
+    OutLoadMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    return Data;
+}
+
+// Narrow the candidate set (unset means every row)
+static void ApplyCatalogFilter(TOptional<TArray<int32>>& Candidates, const TArray<int32>& Rows)
+{
+    if (!Candidates.IsSet())
+    {
+        Candidates = Rows;
+    }
+    else
+    {
+        FEpicUnrealMCPCommonUtils::IntersectSortedIndices(Candidates.GetValue(), Rows);
+    }
+}
+
+// Rows of every indexed token that starts with Prefix: one binary search, then a contiguous run of tokens
+static void AppendCatalogPrefixRows(const TMap<FString, TArray<int32>>& TokenRows, const TArray<FString>& SortedTokens, const FString& Prefix,
+    TArray<int32>& OutRows)
+{
+    for (int32 Index = Algo::LowerBound(SortedTokens, Prefix);
+        Index < SortedTokens.Num() && SortedTokens[Index].StartsWith(Prefix, ESearchCase::CaseSensitive); ++Index)
+    {
+        OutRows.Append(TokenRows.FindChecked(SortedTokens[Index]));
+    }
+}
+
+static TSharedPtr<FJsonValue> MakeCatalogSizeValue(const FMeshCatalogData& Data, int32 Row)
+{
+    if (!(Data.Flags[Row] & MeshCatalogRowHasBounds))
+    {
+        return MakeShareable(new FJsonValueNull());
+    }
+    TArray<TSharedPtr<FJsonValue>> Size;
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        Size.Add(MakeShareable(new FJsonValueNumber(Data.Sizes[Row][Axis])));
+    }
+    return MakeShareable(new FJsonValueArray(Size));
+}
+
+static TArray<TSharedPtr<FJsonValue>> MakeCatalogStringValues(const TArray<FString>& Values)
+{
+    TArray<TSharedPtr<FJsonValue>> JsonValues;
+    for (const FString& Value : Values)
+    {
+        JsonValues.Add(MakeShareable(new FJsonValueString(Value)));
+    }
+    return JsonValues;
+}
+
+static TSharedPtr<FJsonObject> CatalogRowToJson(const FMeshCatalogData& Data, int32 Row)
+{
+    const uint8 RowFlags = Data.Flags[Row];
+
+    TSharedPtr<FJsonObject> MeshObj = MakeShareable(new FJsonObject);
+    MeshObj->SetStringField(TEXT("name"), Data.Names[Row]);
+    MeshObj->SetStringField(TEXT("path"), Data.ObjectPaths[Row]);
+    MeshObj->SetStringField(TEXT("category"), Data.Strings[Data.Categories[Row]]);
+    MeshObj->SetArrayField(TEXT("tags"), MakeCatalogStringValues(GetCatalogRowStrings(Data, Data.TagStart, Data.TagIds, Row)));
+    MeshObj->SetField(TEXT("size_cm"), MakeCatalogSizeValue(Data, Row));
+    if (RowFlags & MeshCatalogRowHasBounds)
+    {
+        MeshObj->SetStringField(TEXT("size_source"), (RowFlags & MeshCatalogRowMeasuredSize) ? TEXT("measured") : TEXT("asset_registry"));
+    }
+    MeshObj->SetBoolField(TEXT("has_indoor_pair"), (RowFlags & MeshCatalogRowHasIndoorPair) != 0);
+    MeshObj->SetBoolField(TEXT("is_indoor_variant"), (RowFlags & MeshCatalogRowIndoorVariant) != 0);
+    MeshObj->SetBoolField(TEXT("in_asset_registry"), (RowFlags & MeshCatalogRowInRegistry) != 0);
+    MeshObj->SetStringField(TEXT("display_name"), Data.DisplayNames[Row]);
+    MeshObj->SetStringField(TEXT("description"), Data.Descriptions[Row]);
+    MeshObj->SetStringField(TEXT("function"), Data.Functions[Row]);
+    MeshObj->SetArrayField(TEXT("style_tags"), MakeCatalogStringValues(GetCatalogRowStrings(Data, Data.StyleTagStart, Data.StyleTagIds, Row)));
+    MeshObj->SetArrayField(TEXT("socket_types"), MakeCatalogStringValues(GetCatalogRowStrings(Data, Data.SocketStart, Data.SocketIds, Row)));
+    return MeshObj;
+}
+
+// Read [x, y, z] where null components are unconstrained
+static void GetCatalogSizeBound(const TSharedPtr<FJsonObject>& Params, const TCHAR* Field, TOptional<double> (&OutBound)[3])
+{
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (!Params->TryGetArrayField(Field, Values))
+    {
+        return;
+    }
+    for (int32 Axis = 0; Axis < 3 && Axis < Values->Num(); ++Axis)
+    {
+        double Number = 0.0;
+        if ((*Values)[Axis].IsValid() && (*Values)[Axis]->TryGetNumber(Number))
+        {
+            OutBound[Axis] = Number;
+        }
+    }
+}
+
+TSharedPtr<FJsonObject> FMeshCatalogIndex::QueryCatalog(const TSharedPtr<FJsonObject>& Params)
+{
+    EnsureDelegatesRegistered();
+
+    FString CatalogName;
+    FString Error;
+    double LoadMs = 0.0;
+    FMeshCatalogData* Data = ResolveCatalog(Params, CatalogName, LoadMs, Error);
+    if (!Data)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    FString Query;
+    Params->TryGetStringField(TEXT("query"), Query);
+    const FString QueryLower = Query.ToLower();
+
+    FString TextFields = TEXT("name");
+    Params->TryGetStringField(TEXT("text_fields"), TextFields);
+    const bool bAllText = TextFields.Equals(TEXT("all"), ESearchCase::IgnoreCase);
+
+    FString Category;
+    Params->TryGetStringField(TEXT("category"), Category);
+
+    TArray<FString> Tags;
+    GetJsonStringArray(Params, TEXT("tags"), Tags);
+    TArray<FString> SocketTypes;
+    GetJsonStringArray(Params, TEXT("socket_types"), SocketTypes);
+
+    TOptional<double> MinSize[3];
+    TOptional<double> MaxSize[3];
+    GetCatalogSizeBound(Params, TEXT("min_size_cm"), MinSize);
+    GetCatalogSizeBound(Params, TEXT("max_size_cm"), MaxSize);
+
+    bool bHasBounds = false;
+    Params->TryGetBoolField(TEXT("has_bounds"), bHasBounds);
+
+    int32 Offset = 0;
+    int32 Limit = 0;
+    if (Params->HasField(TEXT("offset")))
+    {
+        Offset = FMath::Max(0, static_cast<int32>(Params->GetNumberField(TEXT("offset"))));
+    }
+    if (Params->HasField(TEXT("limit")))
+    {
+        Limit = FMath::Max(0, static_cast<int32>(Params->GetNumberField(TEXT("limit"))));
+    }
+
+    const double QueryStart = FPlatformTime::Seconds();
+    static const TArray<int32> NoRows;
+    TOptional<TArray<int32>> Candidates;
+
+    auto FindStringRows = [Data](const TMap<int32, TArray<int32>>& Postings, const FString& Value) -> const TArray<int32>&
+    {
+        const int32* Id = Data->StringIds.Find(Value.ToLower());
+        const TArray<int32>* Rows = Id ? Postings.Find(*Id) : nullptr;
+        return Rows ? *Rows : NoRows;
+    };
+
+    if (!Category.IsEmpty())
+    {
+        ApplyCatalogFilter(Candidates, FindStringRows(Data->CategoryRows, Category));
+    }
+    for (const FString& Tag : Tags)
+    {
+        ApplyCatalogFilter(Candidates, FindStringRows(Data->TagRows, Tag));
+    }
+    for (const FString& SocketType : SocketTypes)
+    {
+        ApplyCatalogFilter(Candidates, FindStringRows(Data->SocketRows, SocketType));
+    }
+
+    // Each query token falls inside some indexed token of a matching row. A token with query characters on
+    // both sides has the same boundaries in the row, so it is a whole token; the last one may run on (a prefix)
+    // and the first may start earlier (a suffix). Suffixes are left to the full check in VisitRow, unless the
+    // query has no other token: only then are all tokens scanned for it as an infix.
+    if (!QueryLower.IsEmpty())
+    {
+        const TMap<FString, TArray<int32>>& TokenRows = bAllText ? Data->TextTokenRows : Data->NameTokenRows;
+        const TArray<FString>& SortedTokens = bAllText ? Data->TextTokens : Data->NameTokens;
+        TArray<FString> QueryTokens;
+        TokenizeCatalogText(QueryLower, QueryTokens);
+        const bool bOpenStart = FChar::IsAlnum(QueryLower[0]);
+        const bool bOpenEnd = FChar::IsAlnum(QueryLower[QueryLower.Len() - 1]);
+
+        bool bFiltered = false;
+        for (int32 Index = 0; Index < QueryTokens.Num(); ++Index)
+        {
+            const FString& QueryToken = QueryTokens[Index];
+            if (Index == 0 && bOpenStart)
+            {
+                continue;
+            }
+
+            if (bOpenEnd && QueryLower.EndsWith(QueryToken, ESearchCase::CaseSensitive))
+            {
+                TArray<int32> Rows;
+                AppendCatalogPrefixRows(TokenRows, SortedTokens, QueryToken, Rows);
+                Rows.Sort();
+                Rows.SetNum(Algo::Unique(Rows));
+                ApplyCatalogFilter(Candidates, Rows);
+            }
+            else
+            {
+                const TArray<int32>* Rows = TokenRows.Find(QueryToken);
+                ApplyCatalogFilter(Candidates, Rows ? *Rows : NoRows);
+            }
+            bFiltered = true;
+        }
+
+        if (!bFiltered && QueryTokens.Num() > 0)
+        {
+            TArray<int32> Rows;
+            for (const FString& Token : SortedTokens)
+            {
+                if (Token.Contains(QueryTokens[0], ESearchCase::CaseSensitive))
+                {
+                    Rows.Append(TokenRows.FindChecked(Token));
+                }
+            }
+            Rows.Sort();
+            Rows.SetNum(Algo::Unique(Rows));
+            ApplyCatalogFilter(Candidates, Rows);
+        }
+    }
+
+    // Size ranges come from the sorted axis orders; rows without bounds pass unless has_bounds
+    for (int32 Axis = 0; Axis < 3; ++Axis)
+    {
+        if (!MinSize[Axis].IsSet() && !MaxSize[Axis].IsSet())
+        {
+            continue;
+        }
+
+        const TArray<int32>& Order = Data->SizeOrder[Axis];
+        auto AxisSize = [Data, Axis](int32 Row) { return static_cast<double>(Data->Sizes[Row][Axis]); };
+        const int32 Begin = MinSize[Axis].IsSet() ? Algo::LowerBoundBy(Order, MinSize[Axis].GetValue(), AxisSize) : 0;
+        const int32 End = MaxSize[Axis].IsSet() ? Algo::UpperBoundBy(Order, MaxSize[Axis].GetValue(), AxisSize) : Order.Num();
+
+        TArray<int32> Rows;
+        if (End > Begin)
+        {
+            Rows.Append(Order.GetData() + Begin, End - Begin);
+        }
+        if (!bHasBounds)
+        {
+            Rows.Append(Data->UnboundedRows);
+        }
+        Rows.Sort();
+        ApplyCatalogFilter(Candidates, Rows);
+    }
+
+    TArray<TSharedPtr<FJsonValue>> MeshArray;
+    int32 TotalMatches = 0;
+
+    auto VisitRow = [&](int32 Row)
+    {
+        const uint8 RowFlags = Data->Flags[Row];
+        if ((RowFlags & MeshCatalogRowRemoved) || (bHasBounds && !(RowFlags & MeshCatalogRowHasBounds)))
+        {
+            return;
+        }
+        if (!QueryLower.IsEmpty()
+            && !(bAllText ? Data->TextLower[Row] : Data->NameLower[Row]).Contains(QueryLower, ESearchCase::CaseSensitive))
+        {
+            return;
+        }
+
+        const int32 MatchIndex = TotalMatches++;
+        if (MatchIndex >= Offset && (Limit == 0 || MeshArray.Num() < Limit))
+        {
+            MeshArray.Add(MakeShareable(new FJsonValueObject(CatalogRowToJson(*Data, Row))));
+        }
+    };
+
+    if (Candidates.IsSet())
+    {
+        for (int32 Row : Candidates.GetValue())
+        {
+            VisitRow(Row);
+        }
+    }
+    else
+    {
+        for (int32 Row = 0; Row < Data->ObjectPaths.Num(); ++Row)
+        {
+            VisitRow(Row);
+        }
+    }
+
+    const double QueryMs = (FPlatformTime::Seconds() - QueryStart) * 1000.0;
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("catalog"), CatalogName);
+    Result->SetStringField(TEXT("query"), Query);
+    Result->SetStringField(TEXT("category_filter"), Category);
+    Result->SetNumberField(TEXT("result_count"), MeshArray.Num());
+    Result->SetNumberField(TEXT("total_matches"), TotalMatches);
+    Result->SetNumberField(TEXT("offset"), Offset);
+    Result->SetArrayField(TEXT("meshes"), MeshArray);
+    Result->SetNumberField(TEXT("row_count"), Data->ObjectPaths.Num() - Data->RemovedRows);
+    Result->SetNumberField(TEXT("candidate_count"), Candidates.IsSet() ? Candidates.GetValue().Num() : Data->ObjectPaths.Num());
+    Result->SetStringField(TEXT("index_source"), Data->Source);
+    Result->SetNumberField(TEXT("load_ms"), LoadMs);
+    Result->SetNumberField(TEXT("query_ms"), QueryMs);
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FMeshCatalogIndex::GetCatalogInfo(const TSharedPtr<FJsonObject>& Params)
+{
+    EnsureDelegatesRegistered();
+
+    FString CatalogName;
+    FString Error;
+    double LoadMs = 0.0;
+    FMeshCatalogData* Data = ResolveCatalog(Params, CatalogName, LoadMs, Error);
+    if (!Data)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    TArray<TPair<FString, int32>> Counts;
+    int32 TotalMeshes = 0;
+    int32 RegistryMeshes = 0;
+    int32 BoundedMeshes = 0;
+    for (const TPair<int32, TArray<int32>>& Pair : Data->CategoryRows)
+    {
+        int32 Count = 0;
+        for (int32 Row : Pair.Value)
+        {
+            const uint8 RowFlags = Data->Flags[Row];
+            if (RowFlags & MeshCatalogRowRemoved)
+            {
+                continue;
+            }
+            Count++;
+            RegistryMeshes += (RowFlags & MeshCatalogRowInRegistry) ? 1 : 0;
+            BoundedMeshes += (RowFlags & MeshCatalogRowHasBounds) ? 1 : 0;
+        }
+        if (Count > 0)
+        {
+            Counts.Add(TPair<FString, int32>(Data->Strings[Pair.Key], Count));
+            TotalMeshes += Count;
+        }
+    }
+    Counts.Sort([](const TPair<FString, int32>& A, const TPair<FString, int32>& B)
+    {
+        return A.Value != B.Value ? A.Value > B.Value : A.Key < B.Key;
+    });
+
+    TSharedPtr<FJsonObject> CategoriesObj = MakeShareable(new FJsonObject);
+    for (const TPair<FString, int32>& Count : Counts)
+    {
+        CategoriesObj->SetNumberField(Count.Key, Count.Value);
+    }
+    TSharedPtr<FJsonObject> DescriptionsObj = MakeShareable(new FJsonObject);
+    for (const TPair<FString, FString>& Description : Data->CategoryDescriptions)
+    {
+        DescriptionsObj->SetStringField(Description.Key, Description.Value);
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("catalog"), CatalogName);
+    Result->SetStringField(TEXT("asset_pack"), Data->AssetPack.IsEmpty() ? TEXT("unknown") : *Data->AssetPack);
+    Result->SetStringField(TEXT("root_path"), Data->RootPath);
+    Result->SetNumberField(TEXT("total_meshes"), TotalMeshes);
+    Result->SetNumberField(TEXT("asset_registry_meshes"), RegistryMeshes);
+    Result->SetNumberField(TEXT("meshes_with_bounds"), BoundedMeshes);
+    Result->SetObjectField(TEXT("categories"), CategoriesObj);
+    Result->SetObjectField(TEXT("descriptions"), DescriptionsObj);
+    Result->SetNumberField(TEXT("name_tokens"), Data->NameTokenRows.Num());
+    Result->SetNumberField(TEXT("tags"), Data->TagRows.Num());
+    Result->SetNumberField(TEXT("socket_types"), Data->SocketRows.Num());
+    Result->SetStringField(TEXT("index_source"), Data->Source);
+    Result->SetStringField(TEXT("sidecar_path"), GetCatalogSidecarPath(CatalogName));
+    Result->SetNumberField(TEXT("load_ms"), LoadMs);
+    return Result;
+}
+
+void FMeshCatalogIndex::EnsureDelegatesRegistered()
+{
+    FMeshCatalogIndexState& State = GetCatalogIndexState();
+    if (State.bDelegatesRegistered)
+    {
+        return;
+    }
+    State.bDelegatesRegistered = true;
+
+    IAssetRegistry& AssetRegistry = GetCatalogAssetRegistry();
+    State.AddedHandle = AssetRegistry.OnAssetAdded().AddStatic(&FMeshCatalogIndex::OnAssetAdded);
+    State.RemovedHandle = AssetRegistry.OnAssetRemoved().AddStatic(&FMeshCatalogIndex::OnAssetRemoved);
+    State.RenamedHandle = AssetRegistry.OnAssetRenamed().AddStatic(&FMeshCatalogIndex::OnAssetRenamed);
+    State.UpdatedHandle = AssetRegistry.OnAssetUpdated().AddStatic(&FMeshCatalogIndex::OnAssetUpdated);
+}
+
+void FMeshCatalogIndex::UnregisterDelegates()
+{
+    FMeshCatalogIndexState& State = GetCatalogIndexState();
+    if (!State.bDelegatesRegistered)
+    {
+        return;
+    }
+    State.bDelegatesRegistered = false;
+
+    // The asset registry may already be gone during editor shutdown
+    if (FAssetRegistryModule* AssetRegistryModule = FModuleManager::GetModulePtr<FAssetRegistryModule>(TEXT("AssetRegistry")))
+    {
+        IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+        AssetRegistry.OnAssetAdded().Remove(State.AddedHandle);
+        AssetRegistry.OnAssetRemoved().Remove(State.RemovedHandle);
+        AssetRegistry.OnAssetRenamed().Remove(State.RenamedHandle);
+        AssetRegistry.OnAssetUpdated().Remove(State.UpdatedHandle);
+    }
+    State.AddedHandle.Reset();
+    State.RemovedHandle.Reset();
+    State.RenamedHandle.Reset();
+    State.UpdatedHandle.Reset();
+}
+
+void FMeshCatalogIndex::OnAssetAdded(const FAssetData& AssetData)
+{
+    for (TPair<FString, FMeshCatalogData>& Pair : GetCatalogIndexState().Catalogs)
+    {
+        FMeshCatalogData& Data = Pair.Value;
+        if (IsCatalogMeshAsset(AssetData, Data.RootPath) && AppendCatalogRow(Data, MakeRegistryRowInput(AssetData), true) != INDEX_NONE)
+        {
+            Data.bDirty = true;
+        }
+    }
+}
+
+void FMeshCatalogIndex::OnAssetRemoved(const FAssetData& AssetData)
+{
+    const FString ObjectPath = AssetData.GetObjectPathString();
+    for (TPair<FString, FMeshCatalogData>& Pair : GetCatalogIndexState().Catalogs)
+    {
+        if (const int32* Row = Pair.Value.PathToRow.Find(ObjectPath))
+        {
+            RemoveCatalogRow(Pair.Value, *Row);
+        }
+    }
+}
+
+void FMeshCatalogIndex::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+{
+    for (TPair<FString, FMeshCatalogData>& Pair : GetCatalogIndexState().Catalogs)
+    {
+        FMeshCatalogData& Data = Pair.Value;
+        const bool bUnderRoot = IsCatalogMeshAsset(AssetData, Data.RootPath);
+
+        // Keep curated metadata with the mesh when it moves within the catalog
+        FMeshCatalogRowInput Input = MakeRegistryRowInput(AssetData);
+        if (const int32* OldRow = Data.PathToRow.Find(OldObjectPath))
+        {
+            const int32 Row = *OldRow;
+            if (bUnderRoot)
+            {
+                Input = GetCatalogRowInput(Data, Row);
+                Input.ObjectPath = AssetData.GetObjectPathString();
+                Input.Name = AssetData.AssetName.ToString();
+                Input.Flags |= MeshCatalogRowInRegistry;
+            }
+            RemoveCatalogRow(Data, Row);
+        }
+
+        if (bUnderRoot && AppendCatalogRow(Data, Input, true) != INDEX_NONE)
+        {
+            Data.bDirty = true;
+        }
+    }
+}
+
+void FMeshCatalogIndex::OnAssetUpdated(const FAssetData& AssetData)
+{
+    const FString ObjectPath = AssetData.GetObjectPathString();
+    for (TPair<FString, FMeshCatalogData>& Pair : GetCatalogIndexState().Catalogs)
+    {
+        if (const int32* Row = Pair.Value.PathToRow.Find(ObjectPath))
+        {
+            UpdateCatalogRowSize(Pair.Value, *Row, AssetData);
+        }
+    }
+}
@@ -0,0 +1,650 @@
+#include "Commands/PCGGraph/PCGGenerationTracker.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPJobRegistry.h"
+#include "PCGComponent.h"
+#include "PCGGraph.h"
+#include "PCGNode.h"
+#include "PCGPin.h"
+#include "PCGEdge.h"
+#include "PCGSettings.h"
+#include "StructUtils/PropertyBag.h"
+#include "PCGData.h"
+#include "Data/PCGPointData.h"
+#include "Helpers/PCGHelpers.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Actor.h"
+
+#if __has_include("Data/PCGBasePointData.h")
+#include "Data/PCGBasePointData.h"
+#define MCP_PCG_HAS_BASE_POINT_DATA 1
+#else
+#define MCP_PCG_HAS_BASE_POINT_DATA 0
+#endif
+
+#if __has_include("Utils/PCGExtraCapture.h")
+#include "Utils/PCGExtraCapture.h"
+#define MCP_PCG_HAS_EXTRA_CAPTURE 1
+#else
+#define MCP_PCG_HAS_EXTRA_CAPTURE 0
+#endif
+
+// Finished jobs kept around for status queries before the oldest are dropped
+static constexpr int32 MaxFinishedPCGJobs = 1024;
+
+enum class EPCGGenerationJobState : uint8
+{
+    Running,
+    Completed,
+    Cancelled,
+    Failed
+};
+
+struct FPCGGenerationJob
+{
+    FString JobId;
+    FString ActorName;
+    TWeakObjectPtr<UPCGComponent> Component;
+    EPCGGenerationJobState State = EPCGGenerationJobState::Running;
+    FString Message;
+    EPCGGenerationRequestMode Mode = EPCGGenerationRequestMode::Full;
+    bool bSkipped = false;
+    // Inputs this job generated from; only set for generations the tracker started itself
+    bool bHasSignature = false;
+    uint32 Signature = 0;
+    double StartTime = 0.0;
+    double CleanupEndTime = 0.0;
+    double EndTime = 0.0;
+    FDelegateHandle GeneratedHandle;
+    FDelegateHandle CleanedHandle;
+    FDelegateHandle CancelledHandle;
+
+    // Captured when the job finishes, so later regenerations do not change the report
+    TSharedPtr<FJsonObject> Stats;
+};
+
+static bool IsPCGJobDone(const FPCGGenerationJob& Job)
+{
+    return Job.State != EPCGGenerationJobState::Running;
+}
+
+// Helper to access the job registry (game thread only)
+static TEpicUnrealMCPJobRegistry<FPCGGenerationJob>& GetPCGJobs()
+{
+    static TEpicUnrealMCPJobRegistry<FPCGGenerationJob> Jobs(MaxFinishedPCGJobs, &IsPCGJobDone);
+    return Jobs;
+}
+
+// A group of jobs started together by one request
+struct FPCGGenerationBatch
+{
+    TArray<FString> JobIds;
+    double StartTime = 0.0;
+};
+
+// Batches kept around for status queries before the oldest are dropped
+static constexpr int32 MaxPCGBatches = 32;
+
+// A batch only aggregates its jobs' states, so any batch may be dropped once it is among the oldest
+static bool IsPCGBatchPrunable(const FPCGGenerationBatch&)
+{
+    return true;
+}
+
+// Helper to access the batch registry (game thread only)
+static TEpicUnrealMCPJobRegistry<FPCGGenerationBatch>& GetPCGBatches()
+{
+    static TEpicUnrealMCPJobRegistry<FPCGGenerationBatch> Batches(MaxPCGBatches, &IsPCGBatchPrunable);
+    return Batches;
+}
+
+// Helper to access the input signature of each component's last completed generation
+static TMap<TObjectKey<UPCGComponent>, uint32>& GetLastGeneratedSignatures()
+{
+    static TMap<TObjectKey<UPCGComponent>, uint32> Signatures;
+    return Signatures;
+}
+
+// Helper to hash an object's editable property values
+static uint32 HashObjectProperties(const UObject* Object, uint32 Hash)
+{
+    FString ValueText;
+    for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+    {
+        if (It->HasAnyPropertyFlags(CPF_Transient | CPF_DuplicateTransient))
+        {
+            continue;
+        }
+
+        ValueText.Reset();
+        It->ExportTextItem_InContainer(ValueText, Object, nullptr, nullptr, PPF_None);
+        Hash = HashCombine(Hash, GetTypeHash(ValueText));
+    }
+    return Hash;
+}
+
+// Helper to summarize everything a component's generation depends on that MCP commands can change:
+// graph topology, node settings, user parameters, seed and the owner's transform.
+// Changes to tracked input actors are picked up by PCG's own tracking, which schedules a refresh.
+static uint32 ComputeGenerationSignature(UPCGComponent* Component)
+{
+    uint32 Hash = GetTypeHash(Component->Seed);
+
+    if (const AActor* Owner = Component->GetOwner())
+    {
+        const FTransform Transform = Owner->GetActorTransform();
+        Hash = HashCombine(Hash, GetTypeHash(Transform.GetLocation()));
+        Hash = HashCombine(Hash, GetTypeHash(Transform.GetRotation().Euler()));
+        Hash = HashCombine(Hash, GetTypeHash(Transform.GetScale3D()));
+    }
+
+    UPCGGraph* Graph = Component->GetGraph();
+    if (!Graph)
+    {
+        return Hash;
+    }
+
+    Hash = HashCombine(Hash, GetTypeHash(Graph->GetPathName()));
+
+    if (UPCGGraphInstance* GraphInstance = Component->GetGraphInstance())
+    {
+        if (const FInstancedPropertyBag* UserParams = GraphInstance->GetUserParametersStruct())
+        {
+            FString ParamsText;
+            FInstancedPropertyBag::StaticStruct()->ExportText(ParamsText, UserParams, nullptr, nullptr, PPF_None, nullptr);
+            Hash = HashCombine(Hash, GetTypeHash(ParamsText));
+        }
+    }
+
+    TArray<UPCGNode*> Nodes = Graph->GetNodes();
+    Nodes.Add(Graph->GetInputNode());
+    for (const UPCGNode* Node : Nodes)
+    {
+        if (!Node)
+        {
+            continue;
+        }
+
+        Hash = HashCombine(Hash, GetTypeHash(Node->GetFName()));
+        if (const UPCGSettings* Settings = Node->GetSettings())
+        {
+            Hash = HashObjectProperties(Settings, Hash);
+        }
+
+        for (const UPCGPin* OutputPin : Node->GetOutputPins())
+        {
+            if (!OutputPin)
+            {
+                continue;
+            }
+            for (const UPCGEdge* Edge : OutputPin->Edges)
+            {
+                const UPCGPin* OtherPin = Edge ? Edge->GetOtherPin(OutputPin) : nullptr;
+                if (OtherPin && OtherPin->Node)
+                {
+                    Hash = HashCombine(Hash, GetTypeHash(OutputPin->Properties.Label));
+                    Hash = HashCombine(Hash, GetTypeHash(OtherPin->Node->GetFName()));
+                    Hash = HashCombine(Hash, GetTypeHash(OtherPin->Properties.Label));
+                }
+            }
+        }
+    }
+
+    return Hash;
+}
+
+static const TCHAR* PCGJobStateToString(EPCGGenerationJobState State)
+{
+    switch (State)
+    {
+        case EPCGGenerationJobState::Running:   return TEXT("running");
+        case EPCGGenerationJobState::Completed: return TEXT("completed");
+        case EPCGGenerationJobState::Cancelled: return TEXT("cancelled");
+        case EPCGGenerationJobState::Failed:    return TEXT("failed");
+    }
+    return TEXT("unknown");
+}
+
+// Helper to count points in a generated data collection
+static int32 CountOutputPoints(const FPCGDataCollection& Collection, int32& OutPointDataCount)
+{
+    int32 PointCount = 0;
+    OutPointDataCount = 0;
+
+    for (const FPCGTaggedData& Tagged : Collection.TaggedData)
+    {
+#if MCP_PCG_HAS_BASE_POINT_DATA
+        if (const UPCGBasePointData* PointData = Cast<UPCGBasePointData>(Tagged.Data))
+        {
+            PointCount += PointData->GetNumPoints();
+            ++OutPointDataCount;
+        }
+#else
+        if (const UPCGPointData* PointData = Cast<UPCGPointData>(Tagged.Data))
+        {
+            PointCount += PointData->GetPoints().Num();
+            ++OutPointDataCount;
+        }
+#endif
+    }
+
+    return PointCount;
+}
+
+// Helper to collect statistics once a component has finished generating
+static TSharedPtr<FJsonObject> CaptureGenerationStats(UPCGComponent* Component)
+{
+    TSharedPtr<FJsonObject> Stats = MakeShareable(new FJsonObject);
+
+    int32 PointDataCount = 0;
+    const int32 PointCount = CountOutputPoints(Component->GetGeneratedGraphOutput(), PointDataCount);
+    Stats->SetNumberField(TEXT("point_count"), PointCount);
+    Stats->SetNumberField(TEXT("output_point_data_count"), PointDataCount);
+
+    // Spawners write instances into PCG-tagged ISM components on the owning actor.
+    // Partitioned graphs spawn onto partition actors instead and are not counted here.
+    int32 InstanceCount = 0;
+    int32 ISMCount = 0;
+    TArray<TSharedPtr<FJsonValue>> MeshArray;
+    if (AActor* Owner = Component->GetOwner())
+    {
+        TInlineComponentArray<UInstancedStaticMeshComponent*> ISMComponents(Owner);
+        for (UInstancedStaticMeshComponent* ISMC : ISMComponents)
+        {
+            if (!ISMC || !ISMC->ComponentHasTag(PCGHelpers::DefaultPCGTag))
+            {
+                continue;
+            }
+
+            const int32 Instances = ISMC->GetInstanceCount();
+            InstanceCount += Instances;
+            ++ISMCount;
+
+            TSharedPtr<FJsonObject> MeshObj = MakeShareable(new FJsonObject);
+            MeshObj->SetStringField(TEXT("mesh"), ISMC->GetStaticMesh() ? ISMC->GetStaticMesh()->GetPathName() : FString());
+            MeshObj->SetNumberField(TEXT("instances"), Instances);
+            MeshArray.Add(MakeShareable(new FJsonValueObject(MeshObj)));
+        }
+    }
+    Stats->SetNumberField(TEXT("instance_count"), InstanceCount);
+    Stats->SetNumberField(TEXT("ism_component_count"), ISMCount);
+    Stats->SetArrayField(TEXT("instances_by_mesh"), MeshArray);
+
+    // Per-node timings come from the component's editor profiling capture when available
+    TArray<TSharedPtr<FJsonValue>> NodeTimings;
+#if MCP_PCG_HAS_EXTRA_CAPTURE
+    for (const auto& TimerPair : Component->GetExtraCapture().GetTimers())
+    {
+        const UPCGNode* Node = TimerPair.Key.ResolveObjectPtr();
+        if (!Node)
+        {
+            continue;
+        }
+
+        double ExecutionSeconds = 0.0;
+        for (const PCGUtils::FCallTime& CallTime : TimerPair.Value)
+        {
+            ExecutionSeconds += CallTime.ExecutionTime;
+        }
+
+        TSharedPtr<FJsonObject> TimingObj = MakeShareable(new FJsonObject);
+        TimingObj->SetStringField(TEXT("node_id"), Node->GetName());
+        TimingObj->SetStringField(TEXT("node_title"), Node->GetNodeTitle(EPCGNodeTitleType::ListView).ToString());
+        TimingObj->SetNumberField(TEXT("calls"), TimerPair.Value.Num());
+        TimingObj->SetNumberField(TEXT("execution_ms"), ExecutionSeconds * 1000.0);
+        NodeTimings.Add(MakeShareable(new FJsonValueObject(TimingObj)));
+    }
+
+    NodeTimings.Sort([](const TSharedPtr<FJsonValue>& A, const TSharedPtr<FJsonValue>& B)
+    {
+        return A->AsObject()->GetNumberField(TEXT("execution_ms")) > B->AsObject()->GetNumberField(TEXT("execution_ms"));
+    });
+#endif
+    Stats->SetArrayField(TEXT("node_timings"), NodeTimings);
+
+    return Stats;
+}
+
+// Helper to unbind a job's delegates and move it to a terminal state
+static void FinishPCGJob(const FString& JobId, EPCGGenerationJobState FinalState, const FString& Message)
+{
+    FPCGGenerationJob* Job = GetPCGJobs().Find(JobId);
+    if (!Job || Job->State != EPCGGenerationJobState::Running)
+    {
+        return;
+    }
+
+    Job->State = FinalState;
+    Job->Message = Message;
+    Job->EndTime = FPlatformTime::Seconds();
+
+    if (UPCGComponent* Component = Job->Component.Get())
+    {
+        Component->OnPCGGraphGeneratedDelegate.Remove(Job->GeneratedHandle);
+        Component->OnPCGGraphCleanedDelegate.Remove(Job->CleanedHandle);
+        Component->OnPCGGraphCancelledDelegate.Remove(Job->CancelledHandle);
+
+        if (FinalState == EPCGGenerationJobState::Completed)
+        {
+            Job->Stats = CaptureGenerationStats(Component);
+            if (Job->bHasSignature)
+            {
+                GetLastGeneratedSignatures().Add(Component, Job->Signature);
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("FPCGGenerationTracker: Job %s on '%s' %s in %.1f ms"),
+        *JobId, *Job->ActorName, PCGJobStateToString(FinalState), (Job->EndTime - Job->StartTime) * 1000.0);
+
+    GetPCGJobs().PruneFinished();
+}
+
+// Helper to fail a running job whose component was destroyed; its delegates will never fire
+static void ReapDestroyedComponentJob(const FString& JobId)
+{
+    const FPCGGenerationJob* Job = GetPCGJobs().Find(JobId);
+    if (Job && Job->State == EPCGGenerationJobState::Running && !Job->Component.IsValid())
+    {
+        FinishPCGJob(JobId, EPCGGenerationJobState::Failed, TEXT("PCG component was destroyed"));
+    }
+}
+
+bool FPCGGenerationTracker::ParseMode(const TSharedPtr<FJsonObject>& Params, EPCGGenerationRequestMode& OutMode, FString& OutError)
+{
+    OutMode = EPCGGenerationRequestMode::Full;
+
+    FString ModeString;
+    if (!Params->TryGetStringField(TEXT("mode"), ModeString) || ModeString.Equals(TEXT("full"), ESearchCase::IgnoreCase))
+    {
+        return true;
+    }
+    if (ModeString.Equals(TEXT("incremental"), ESearchCase::IgnoreCase))
+    {
+        OutMode = EPCGGenerationRequestMode::Incremental;
+        return true;
+    }
+
+    OutError = FString::Printf(TEXT("Unknown generation mode '%s' (expected 'full' or 'incremental')"), *ModeString);
+    return false;
+}
+
+FString FPCGGenerationTracker::StartGeneration(UPCGComponent* Component, const FString& ActorName, EPCGGenerationRequestMode Mode)
+{
+    check(Component);
+
+    const bool bIncremental = Mode == EPCGGenerationRequestMode::Incremental;
+
+    // An incremental request joins a generation PCG already scheduled itself (e.g. the editor
+    // refresh after a parameter change) instead of restarting it
+    const bool bAttachToRunning = bIncremental && Component->IsGenerating();
+
+    // Otherwise a new request on the same component replaces any job still running on it
+    if (!bAttachToRunning)
+    {
+        TArray<FString> SupersededJobs;
+        for (const TPair<FString, FPCGGenerationJob>& Pair : GetPCGJobs().GetJobs())
+        {
+            if (Pair.Value.State == EPCGGenerationJobState::Running && Pair.Value.Component.Get() == Component)
+            {
+                SupersededJobs.Add(Pair.Key);
+            }
+        }
+        for (const FString& SupersededId : SupersededJobs)
+        {
+            FinishPCGJob(SupersededId, EPCGGenerationJobState::Cancelled, TEXT("Superseded by a newer generation request"));
+        }
+    }
+
+    FString JobId;
+    FPCGGenerationJob& Job = GetPCGJobs().Add(JobId);
+    Job.JobId = JobId;
+    Job.ActorName = ActorName;
+    Job.Component = Component;
+    Job.Mode = Mode;
+    Job.StartTime = FPlatformTime::Seconds();
+
+    // A joined generation was scheduled from inputs we never saw, so its result matches no signature
+    if (bAttachToRunning)
+    {
+        GetLastGeneratedSignatures().Remove(Component);
+    }
+    else
+    {
+        Job.bHasSignature = true;
+        Job.Signature = ComputeGenerationSignature(Component);
+    }
+
+    // Nothing that feeds the graph changed since our last completed generation: keep the current result
+    if (bIncremental && !bAttachToRunning && Component->bGenerated)
+    {
+        const uint32* LastSignature = GetLastGeneratedSignatures().Find(Component);
+        if (LastSignature && *LastSignature == Job.Signature)
+        {
+            Job.bSkipped = true;
+            FinishPCGJob(JobId, EPCGGenerationJobState::Completed, TEXT("Up to date; generation skipped"));
+            return JobId;
+        }
+    }
+
+    // Bind before cleanup so the cleaned delegate is observed
+    Job.GeneratedHandle = Component->OnPCGGraphGeneratedDelegate.AddLambda([JobId](UPCGComponent*)
+    {
+        FinishPCGJob(JobId, EPCGGenerationJobState::Completed, TEXT("Generation finished"));
+    });
+    Job.CleanedHandle = Component->OnPCGGraphCleanedDelegate.AddLambda([JobId](UPCGComponent*)
+    {
+        if (FPCGGenerationJob* CleanedJob = GetPCGJobs().Find(JobId))
+        {
+            CleanedJob->CleanupEndTime = FPlatformTime::Seconds();
+        }
+    });
+    Job.CancelledHandle = Component->OnPCGGraphCancelledDelegate.AddLambda([JobId](UPCGComponent*)
+    {
+        FinishPCGJob(JobId, EPCGGenerationJobState::Cancelled, TEXT("Generation was cancelled"));
+    });
+
+    if (bAttachToRunning)
+    {
+        return JobId;
+    }
+
+    // Full mode throws away every managed resource first. Incremental mode regenerates in place, so
+    // PCG reuses its managed ISM components and serves unchanged elements from the graph cache.
+    if (!bIncremental)
+    {
+        Component->CleanupLocal(/*bRemoveComponents=*/true, /*bSave=*/false);
+    }
+    Component->Generate(/*bForce=*/true);
+
+    // Generate() schedules a task; if none exists and the job did not finish inline, nothing will run
+    const FPCGGenerationJob* Scheduled = GetPCGJobs().Find(JobId);
+    if (Scheduled && Scheduled->State == EPCGGenerationJobState::Running && !Component->IsGenerating())
+    {
+        FinishPCGJob(JobId, EPCGGenerationJobState::Failed,
+            TEXT("Generation was not scheduled (component inactive or no graph assigned)"));
+    }
+
+    return JobId;
+}
+
+TSharedPtr<FJsonObject> FPCGGenerationTracker::DescribeJob(const FString& JobId)
+{
+    const FPCGGenerationJob* Job = GetPCGJobs().Find(JobId);
+    if (!Job)
+    {
+        return nullptr;
+    }
+
+    const bool bRunning = Job->State == EPCGGenerationJobState::Running;
+    const double Now = FPlatformTime::Seconds();
+
+    TSharedPtr<FJsonObject> Status = MakeShareable(new FJsonObject);
+    Status->SetStringField(TEXT("job_id"), Job->JobId);
+    Status->SetStringField(TEXT("actor_name"), Job->ActorName);
+    Status->SetStringField(TEXT("state"), PCGJobStateToString(Job->State));
+    Status->SetBoolField(TEXT("done"), !bRunning);
+    Status->SetStringField(TEXT("mode"), Job->Mode == EPCGGenerationRequestMode::Incremental ? TEXT("incremental") : TEXT("full"));
+    Status->SetBoolField(TEXT("skipped"), Job->bSkipped);
+    Status->SetNumberField(TEXT("wall_time_ms"), ((bRunning ? Now : Job->EndTime) - Job->StartTime) * 1000.0);
+    if (Job->CleanupEndTime > 0.0)
+    {
+        Status->SetNumberField(TEXT("cleanup_ms"), (Job->CleanupEndTime - Job->StartTime) * 1000.0);
+    }
+    if (!Job->Message.IsEmpty())
+    {
+        Status->SetStringField(TEXT("message"), Job->Message);
+    }
+    if (!Job->Component.IsValid())
+    {
+        Status->SetBoolField(TEXT("component_destroyed"), true);
+    }
+    if (Job->Stats.IsValid())
+    {
+        for (const auto& Field : Job->Stats->Values)
+        {
+            Status->SetField(Field.Key, Field.Value);
+        }
+    }
+
+    return Status;
+}
+
+TSharedPtr<FJsonObject> FPCGGenerationTracker::GetJobStatus(const TSharedPtr<FJsonObject>& Params)
+{
+    FString BatchId;
+    if (Params->TryGetStringField(TEXT("batch_id"), BatchId))
+    {
+        bool bIncludeJobs = true;
+        Params->TryGetBoolField(TEXT("include_jobs"), bIncludeJobs);
+
+        TSharedPtr<FJsonObject> BatchResult = DescribeBatch(BatchId, bIncludeJobs);
+        if (!BatchResult.IsValid())
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Unknown PCG batch '%s'"), *BatchId));
+        }
+
+        BatchResult->SetBoolField(TEXT("success"), true);
+        return BatchResult;
+    }
+
+    FString JobId;
+    if (!Params->TryGetStringField(TEXT("job_id"), JobId))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'job_id' or 'batch_id' parameter"));
+    }
+
+    ReapDestroyedComponentJob(JobId);
+
+    TSharedPtr<FJsonObject> Result = DescribeJob(JobId);
+    if (!Result.IsValid())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown PCG job '%s'"), *JobId));
+    }
+
+    Result->SetBoolField(TEXT("success"), true);
+    return Result;
+}
+
+FString FPCGGenerationTracker::RegisterBatch(const TArray<FString>& JobIds)
+{
+    FString BatchId;
+    FPCGGenerationBatch& Batch = GetPCGBatches().Add(BatchId);
+    Batch.JobIds = JobIds;
+    Batch.StartTime = FPlatformTime::Seconds();
+
+    GetPCGBatches().PruneFinished();
+
+    return BatchId;
+}
+
+TSharedPtr<FJsonObject> FPCGGenerationTracker::DescribeBatch(const FString& BatchId, bool bIncludeJobs)
+{
+    const FPCGGenerationBatch* Batch = GetPCGBatches().Find(BatchId);
+    if (!Batch)
+    {
+        return nullptr;
+    }
+
+    int32 Running = 0;
+    int32 Completed = 0;
+    int32 Skipped = 0;
+    int32 Cancelled = 0;
+    int32 Failed = 0;
+    int32 Pruned = 0;
+    int32 TotalPoints = 0;
+    int32 TotalInstances = 0;
+    double LastEndTime = Batch->StartTime;
+    TArray<TSharedPtr<FJsonValue>> JobsArray;
+
+    for (const FString& JobId : Batch->JobIds)
+    {
+        ReapDestroyedComponentJob(JobId);
+
+        const FPCGGenerationJob* Job = GetPCGJobs().Find(JobId);
+        if (!Job)
+        {
+            // Pruned from the job history: it finished, but its outcome is no longer known
+            ++Pruned;
+            continue;
+        }
+
+        switch (Job->State)
+        {
+            case EPCGGenerationJobState::Running:   ++Running; break;
+            case EPCGGenerationJobState::Completed: ++Completed; Skipped += Job->bSkipped ? 1 : 0; break;
+            case EPCGGenerationJobState::Cancelled: ++Cancelled; break;
+            case EPCGGenerationJobState::Failed:    ++Failed; break;
+        }
+
+        if (Job->State != EPCGGenerationJobState::Running)
+        {
+            LastEndTime = FMath::Max(LastEndTime, Job->EndTime);
+        }
+        if (Job->Stats.IsValid())
+        {
+            TotalPoints += static_cast<int32>(Job->Stats->GetNumberField(TEXT("point_count")));
+            TotalInstances += static_cast<int32>(Job->Stats->GetNumberField(TEXT("instance_count")));
+        }
+
+        if (bIncludeJobs)
+        {
+            JobsArray.Add(MakeShareable(new FJsonValueObject(DescribeJob(JobId))));
+        }
+    }
+
+    const int32 Total = Batch->JobIds.Num();
+    const int32 Finished = Total - Running;
+    const bool bDone = Running == 0;
+
+    TSharedPtr<FJsonObject> Status = MakeShareable(new FJsonObject);
+    Status->SetStringField(TEXT("batch_id"), BatchId);
+    Status->SetStringField(TEXT("state"), bDone ? TEXT("completed") : TEXT("running"));
+    Status->SetBoolField(TEXT("done"), bDone);
+    Status->SetNumberField(TEXT("total"), Total);
+    Status->SetNumberField(TEXT("finished"), Finished);
+    Status->SetNumberField(TEXT("progress"), Total > 0 ? static_cast<double>(Finished) / Total : 1.0);
+    Status->SetNumberField(TEXT("running"), Running);
+    Status->SetNumberField(TEXT("completed"), Completed);
+    Status->SetNumberField(TEXT("skipped"), Skipped);
+    Status->SetNumberField(TEXT("cancelled"), Cancelled);
+    Status->SetNumberField(TEXT("failed"), Failed);
+    Status->SetNumberField(TEXT("pruned"), Pruned);
+    Status->SetNumberField(TEXT("wall_time_ms"), ((bDone ? LastEndTime : FPlatformTime::Seconds()) - Batch->StartTime) * 1000.0);
+    Status->SetNumberField(TEXT("point_count"), TotalPoints);
+    Status->SetNumberField(TEXT("instance_count"), TotalInstances);
+    if (bIncludeJobs)
+    {
+        Status->SetArrayField(TEXT("jobs"), JobsArray);
+    }
+
+    return Status;
+}
+
+bool FPCGGenerationTracker::IsJobFinished(const FString& JobId)
+{
+    const FPCGGenerationJob* Job = GetPCGJobs().Find(JobId);
+    return !Job || Job->State != EPCGGenerationJobState::Running;
+}
@@ -0,0 +1,248 @@
+#include "Commands/PCGGraph/PCGGraphBuilder.h"
+#include "Commands/PCGGraph/PCGGraphCreator.h"
+#include "Commands/PCGGraph/PCGNodeManager.h"
+#include "Commands/PCGGraph/PCGNodeConnector.h"
+#include "Commands/PCGGraph/PCGNodePropertyManager.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "PCGGraph.h"
+#include "PCGNode.h"
+#include "PCGPin.h"
+#include "PCGSettings.h"
+
+// Horizontal spacing for nodes that do not specify a position
+static constexpr int32 PCGBuilderDefaultSpacingX = 300;
+
+// Helper to register a node under a lookup name (keys are lower-case for case-insensitive matching)
+static void AddNodeLookup(TMap<FString, UPCGNode*>& Lookup, const FString& Name, UPCGNode* Node)
+{
+    if (Node && !Name.IsEmpty())
+    {
+        Lookup.Add(Name.ToLower(), Node);
+    }
+}
+
+static UPCGNode* FindNodeLookup(const TMap<FString, UPCGNode*>& Lookup, const FString& Name)
+{
+    UPCGNode* const* Found = Lookup.Find(Name.ToLower());
+    return Found ? *Found : nullptr;
+}
+
+TSharedPtr<FJsonObject> FPCGGraphBuilder::BuildPCGGraph(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    const TArray<TSharedPtr<FJsonValue>>* NodesArray = nullptr;
+    Params->TryGetArrayField(TEXT("nodes"), NodesArray);
+
+    const TArray<TSharedPtr<FJsonValue>>* EdgesArray = nullptr;
+    Params->TryGetArrayField(TEXT("edges"), EdgesArray);
+
+    if ((!NodesArray || NodesArray->Num() == 0) && (!EdgesArray || EdgesArray->Num() == 0))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide at least one entry in 'nodes' or 'edges'"));
+    }
+
+    // Resolve or create the target graph
+    FString GraphPath;
+    bool bCreatedGraph = false;
+    if (!Params->TryGetStringField(TEXT("graph_path"), GraphPath))
+    {
+        if (!Params->HasField(TEXT("graph_name")))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Provide 'graph_path' or 'graph_name'"));
+        }
+
+        TSharedPtr<FJsonObject> CreateResult = FPCGGraphCreator::CreatePCGGraph(Params);
+        if (!CreateResult->GetBoolField(TEXT("success")))
+        {
+            return CreateResult;
+        }
+        GraphPath = CreateResult->GetStringField(TEXT("graph_path"));
+        bCreatedGraph = true;
+    }
+
+    UPCGGraph* Graph = FPCGGraphCreator::LoadPCGGraph(GraphPath);
+    if (!Graph)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Could not find PCG graph at '%s'"), *GraphPath));
+    }
+
+    bool bClearExisting = false;
+    Params->TryGetBoolField(TEXT("clear_existing"), bClearExisting);
+
+    TArray<TSharedPtr<FJsonValue>> Errors;
+    TSharedPtr<FJsonObject> NodeMap = MakeShareable(new FJsonObject);
+    int32 NodesCreated = 0;
+    int32 EdgesCreated = 0;
+    int32 PropertiesSet = 0;
+
+    // Hold graph change notifications; everything below is flushed as one structural change
+    Graph->DisableNotificationsForEditor();
+
+    if (bClearExisting)
+    {
+        TArray<UPCGNode*> ExistingNodes = Graph->GetNodes();
+        for (UPCGNode* Node : ExistingNodes)
+        {
+            if (Node && Node != Graph->GetInputNode() && Node != Graph->GetOutputNode())
+            {
+                Graph->RemoveNode(Node);
+            }
+        }
+    }
+
+    // Name -> node map built once, so edges and properties resolve without scanning the graph
+    TMap<FString, UPCGNode*> NodeLookup;
+    for (UPCGNode* Node : Graph->GetNodes())
+    {
+        AddNodeLookup(NodeLookup, Node ? Node->GetFName().ToString() : FString(), Node);
+    }
+    AddNodeLookup(NodeLookup, Graph->GetInputNode()->GetFName().ToString(), Graph->GetInputNode());
+    AddNodeLookup(NodeLookup, Graph->GetOutputNode()->GetFName().ToString(), Graph->GetOutputNode());
+    AddNodeLookup(NodeLookup, TEXT("Input"), Graph->GetInputNode());
+    AddNodeLookup(NodeLookup, TEXT("Output"), Graph->GetOutputNode());
+
+    if (NodesArray)
+    {
+        int32 NodeIndex = 0;
+        for (const TSharedPtr<FJsonValue>& NodeValue : *NodesArray)
+        {
+            const TSharedPtr<FJsonObject>* NodeSpec = nullptr;
+            FString SpecName;
+            FString NodeType;
+            if (!NodeValue->TryGetObject(NodeSpec)
+                || !(*NodeSpec)->TryGetStringField(TEXT("name"), SpecName)
+                || !(*NodeSpec)->TryGetStringField(TEXT("node_type"), NodeType))
+            {
+                Errors.Add(MakeShareable(new FJsonValueString(TEXT("Each node needs 'name' and 'node_type'"))));
+                continue;
+            }
+
+            UClass* SettingsClass = FPCGNodeManager::ResolveNodeType(NodeType);
+            if (!SettingsClass)
+            {
+                const TArray<FString> Suggestions = FPCGNodeManager::SuggestNodeTypes(NodeType, 3);
+                Errors.Add(MakeShareable(new FJsonValueString(Suggestions.Num() > 0
+                    ? FString::Printf(TEXT("%s: unknown PCG node type '%s' (did you mean: %s?)"), *SpecName, *NodeType, *FString::Join(Suggestions, TEXT(", ")))
+                    : FString::Printf(TEXT("%s: unknown PCG node type '%s'"), *SpecName, *NodeType))));
+                continue;
+            }
+
+            UPCGSettings* NewSettings = nullptr;
+            UPCGNode* NewNode = Graph->AddNodeOfType(SettingsClass, NewSettings);
+            if (!NewNode)
+            {
+                Errors.Add(MakeShareable(new FJsonValueString(
+                    FString::Printf(TEXT("%s: failed to create node of type '%s'"), *SpecName, *NodeType))));
+                continue;
+            }
+
+            int32 PosX = NodeIndex * PCGBuilderDefaultSpacingX;
+            int32 PosY = 0;
+            if ((*NodeSpec)->HasField(TEXT("pos_x")))
+            {
+                PosX = static_cast<int32>((*NodeSpec)->GetNumberField(TEXT("pos_x")));
+            }
+            if ((*NodeSpec)->HasField(TEXT("pos_y")))
+            {
+                PosY = static_cast<int32>((*NodeSpec)->GetNumberField(TEXT("pos_y")));
+            }
+            NewNode->SetNodePosition(PosX, PosY);
+            ++NodeIndex;
+            ++NodesCreated;
+
+            AddNodeLookup(NodeLookup, SpecName, NewNode);
+            NodeMap->SetStringField(SpecName, NewNode->GetFName().ToString());
+
+            const TSharedPtr<FJsonObject>* Properties = nullptr;
+            if (NewSettings && (*NodeSpec)->TryGetObjectField(TEXT("properties"), Properties))
+            {
+                for (const auto& PropertyPair : (*Properties)->Values)
+                {
+                    FString PropertyType;
+                    if (FPCGNodePropertyManager::ApplySettingsProperty(NewSettings, PropertyPair.Key, PropertyPair.Value, PropertyType))
+                    {
+                        ++PropertiesSet;
+                    }
+                    else
+                    {
+                        Errors.Add(MakeShareable(new FJsonValueString(FString::Printf(
+                            TEXT("%s: could not set property '%s' on %s"), *SpecName, *PropertyPair.Key, *SettingsClass->GetName()))));
+                    }
+                }
+            }
+        }
+    }
+
+    if (EdgesArray)
+    {
+        for (const TSharedPtr<FJsonValue>& EdgeValue : *EdgesArray)
+        {
+            const TSharedPtr<FJsonObject>* EdgeSpec = nullptr;
+            FString FromName;
+            FString ToName;
+            if (!EdgeValue->TryGetObject(EdgeSpec)
+                || !(*EdgeSpec)->TryGetStringField(TEXT("from"), FromName)
+                || !(*EdgeSpec)->TryGetStringField(TEXT("to"), ToName))
+            {
+                Errors.Add(MakeShareable(new FJsonValueString(TEXT("Each edge needs 'from' and 'to'"))));
+                continue;
+            }
+
+            FString FromPin = TEXT("Out");
+            (*EdgeSpec)->TryGetStringField(TEXT("from_pin"), FromPin);
+            FString ToPin = TEXT("In");
+            (*EdgeSpec)->TryGetStringField(TEXT("to_pin"), ToPin);
+
+            UPCGNode* FromNode = FindNodeLookup(NodeLookup, FromName);
+            UPCGNode* ToNode = FindNodeLookup(NodeLookup, ToName);
+            if (!FromNode || !ToNode)
+            {
+                Errors.Add(MakeShareable(new FJsonValueString(FString::Printf(
+                    TEXT("Edge %s -> %s: unknown node '%s'"), *FromName, *ToName, FromNode ? *ToName : *FromName))));
+                continue;
+            }
+
+            UPCGPin* OutputPin = nullptr;
+            UPCGPin* InputPin = nullptr;
+            FString ConnectError;
+            if (FPCGNodeConnector::ConnectPins(Graph, FromNode, FromPin, ToNode, ToPin, OutputPin, InputPin, ConnectError))
+            {
+                ++EdgesCreated;
+            }
+            else
+            {
+                Errors.Add(MakeShareable(new FJsonValueString(ConnectError)));
+            }
+        }
+    }
+
+    // Queue one structural notification, then release the hold so it is delivered exactly once
+    Graph->ForceNotificationForEditor(EPCGChangeType::Structural);
+    Graph->EnableNotificationsForEditor();
+    Graph->GetPackage()->MarkPackageDirty();
+
+    const double BuildTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    UE_LOG(LogTemp, Display, TEXT("FPCGGraphBuilder::BuildPCGGraph: %d nodes, %d edges, %d properties on '%s' in %.1f ms (%d errors)"),
+        NodesCreated, EdgesCreated, PropertiesSet, *GraphPath, BuildTimeMs, Errors.Num());
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    Result->SetBoolField(TEXT("success"), Errors.Num() == 0);
+    if (Errors.Num() > 0)
+    {
+        Result->SetStringField(TEXT("error"), FString::Printf(TEXT("%d graph element(s) failed; first: %s"),
+            Errors.Num(), *Errors[0]->AsString()));
+    }
+    Result->SetStringField(TEXT("graph_path"), GraphPath);
+    Result->SetBoolField(TEXT("created_graph"), bCreatedGraph);
+    Result->SetObjectField(TEXT("node_map"), NodeMap);
+    Result->SetNumberField(TEXT("nodes_created"), NodesCreated);
+    Result->SetNumberField(TEXT("edges_created"), EdgesCreated);
+    Result->SetNumberField(TEXT("properties_set"), PropertiesSet);
+    Result->SetArrayField(TEXT("errors"), Errors);
+    Result->SetNumberField(TEXT("build_time_ms"), BuildTimeMs);
+
+    return Result;
+}
@@ -290,6 +290,59 @@ TSharedPtr<FJsonObject> FPCGGraphCreator::ReadPCGGraph(const TSharedPtr<FJsonObj
             }
             ParamObj->SetStringField(TEXT("param_type"), TypeStr);
 
+            // Current default, in the form set_pcg_graph_parameter accepts
+            switch (Desc.ValueType)
+            {
+            case EPropertyBagPropertyType::Bool:
+                if (TValueOrError<bool, EPropertyBagResult> Value = UserParams->GetValueBool(Desc.Name); Value.HasValue())
+                {
+                    ParamObj->SetBoolField(TEXT("default_value"), Value.GetValue());
+                }
+                break;
+            case EPropertyBagPropertyType::Int32:
+                if (TValueOrError<int32, EPropertyBagResult> Value = UserParams->GetValueInt32(Desc.Name); Value.HasValue())
+                {
+                    ParamObj->SetNumberField(TEXT("default_value"), Value.GetValue());
+                }
+                break;
+            case EPropertyBagPropertyType::Int64:
+                if (TValueOrError<int64, EPropertyBagResult> Value = UserParams->GetValueInt64(Desc.Name); Value.HasValue())
+                {
+                    ParamObj->SetNumberField(TEXT("default_value"), static_cast<double>(Value.GetValue()));
+                }
+                break;
+            case EPropertyBagPropertyType::Float:
+                if (TValueOrError<float, EPropertyBagResult> Value = UserParams->GetValueFloat(Desc.Name); Value.HasValue())
+                {
+                    ParamObj->SetNumberField(TEXT("default_value"), Value.GetValue());
+                }
+                break;
+            case EPropertyBagPropertyType::Double:
+                if (TValueOrError<double, EPropertyBagResult> Value = UserParams->GetValueDouble(Desc.Name); Value.HasValue())
+                {
+                    ParamObj->SetNumberField(TEXT("default_value"), Value.GetValue());
+                }
+                break;
+            case EPropertyBagPropertyType::String:
+                if (TValueOrError<FString, EPropertyBagResult> Value = UserParams->GetValueString(Desc.Name); Value.HasValue())
+                {
+                    ParamObj->SetStringField(TEXT("default_value"), Value.GetValue());
+                }
+                break;
+            case EPropertyBagPropertyType::Name:
+                if (TValueOrError<FName, EPropertyBagResult> Value = UserParams->GetValueName(Desc.Name); Value.HasValue())
+                {
+                    ParamObj->SetStringField(TEXT("default_value"), Value.GetValue().ToString());
+                }
+                break;
+            default:
+                if (TValueOrError<FString, EPropertyBagResult> Value = UserParams->GetValueSerializedString(Desc.Name); Value.HasValue())
+                {
+                    ParamObj->SetStringField(TEXT("default_value"), Value.GetValue());
+                }
+                break;
+            }
+
             ParametersArray.Add(MakeShareable(new FJsonValueObject(ParamObj)));
         }
     }
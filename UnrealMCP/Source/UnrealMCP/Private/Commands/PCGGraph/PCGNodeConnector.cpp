@@ -6,8 +6,7 @@
 #include "PCGNode.h"
 #include "PCGPin.h"
 
-// Helper to find a pin by label on a node (case-insensitive)
-static UPCGPin* FindPinByLabel(UPCGNode* Node, const FString& PinLabel, bool bIsInput)
+UPCGPin* FPCGNodeConnector::FindPinByLabel(UPCGNode* Node, const FString& PinLabel, bool bIsInput)
 {
     const TArray<UPCGPin*>& Pins = bIsInput ? Node->GetInputPins() : Node->GetOutputPins();
 
@@ -87,6 +86,37 @@ TSharedPtr<FJsonObject> FPCGNodeConnector::ConnectNodes(const TSharedPtr<FJsonOb
             FString::Printf(TEXT("Could not find target node '%s' in PCG graph"), *ToNodeId));
     }
 
+    UPCGPin* OutputPin = nullptr;
+    UPCGPin* InputPin = nullptr;
+    FString ConnectError;
+    if (!ConnectPins(Graph, FromNode, FromPin, ToNode, ToPin, OutputPin, InputPin, ConnectError))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(ConnectError);
+    }
+
+    Graph->ForceNotificationForEditor(EPCGChangeType::Structural);
+    Graph->GetPackage()->MarkPackageDirty();
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("from_node_id"), FromNodeId);
+    Result->SetStringField(TEXT("from_pin"), OutputPin->Properties.Label.ToString());
+    Result->SetStringField(TEXT("to_node_id"), ToNodeId);
+    Result->SetStringField(TEXT("to_pin"), InputPin->Properties.Label.ToString());
+
+    return Result;
+}
+
+bool FPCGNodeConnector::ConnectPins(
+    UPCGGraph* Graph,
+    UPCGNode* FromNode,
+    const FString& FromPin,
+    UPCGNode* ToNode,
+    const FString& ToPin,
+    UPCGPin*& OutFromPin,
+    UPCGPin*& OutToPin,
+    FString& OutError)
+{
     // Find the output pin on source node
     UPCGPin* OutputPin = FindPinByLabel(FromNode, FromPin, false);
     if (!OutputPin)
@@ -101,9 +131,9 @@ TSharedPtr<FJsonObject> FPCGNodeConnector::ConnectNodes(const TSharedPtr<FJsonOb
                 AvailablePins += Pin->Properties.Label.ToString();
             }
         }
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not find output pin '%s' on node '%s'. Available: %s"),
-                *FromPin, *FromNodeId, *AvailablePins));
+        OutError = FString::Printf(TEXT("Could not find output pin '%s' on node '%s'. Available: %s"),
+            *FromPin, *FromNode->GetName(), *AvailablePins);
+        return false;
     }
 
     // Find the input pin on target node
@@ -119,9 +149,9 @@ TSharedPtr<FJsonObject> FPCGNodeConnector::ConnectNodes(const TSharedPtr<FJsonOb
                 AvailablePins += Pin->Properties.Label.ToString();
             }
         }
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not find input pin '%s' on node '%s'. Available: %s"),
-                *ToPin, *ToNodeId, *AvailablePins));
+        OutError = FString::Printf(TEXT("Could not find input pin '%s' on node '%s'. Available: %s"),
+            *ToPin, *ToNode->GetName(), *AvailablePins);
+        return false;
     }
 
     // Create the edge — try pin-based first (UE5.7), fall back to graph-based
@@ -133,20 +163,12 @@ TSharedPtr<FJsonObject> FPCGNodeConnector::ConnectNodes(const TSharedPtr<FJsonOb
     }
     if (!bSuccess)
     {
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Failed to create edge from '%s.%s' to '%s.%s'"),
-                *FromNodeId, *FromPin, *ToNodeId, *ToPin));
+        OutError = FString::Printf(TEXT("Failed to create edge from '%s.%s' to '%s.%s'"),
+            *FromNode->GetName(), *FromPin, *ToNode->GetName(), *ToPin);
+        return false;
     }
 
-    Graph->ForceNotificationForEditor(EPCGChangeType::Structural);
-    Graph->GetPackage()->MarkPackageDirty();
-
-    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
-    Result->SetBoolField(TEXT("success"), true);
-    Result->SetStringField(TEXT("from_node_id"), FromNodeId);
-    Result->SetStringField(TEXT("from_pin"), OutputPin->Properties.Label.ToString());
-    Result->SetStringField(TEXT("to_node_id"), ToNodeId);
-    Result->SetStringField(TEXT("to_pin"), InputPin->Properties.Label.ToString());
-
-    return Result;
+    OutFromPin = OutputPin;
+    OutToPin = InputPin;
+    return true;
 }
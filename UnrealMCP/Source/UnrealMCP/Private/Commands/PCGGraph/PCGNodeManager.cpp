@@ -26,147 +26,351 @@
 #include "Elements/PCGCopyPoints.h"
 #endif
 
-#include "UObject/UObjectIterator.h"
+#include "UObject/UObjectHash.h"
+#include "UObject/ObjectKey.h"
+#include "Modules/ModuleManager.h"
 
-// Forward declares for settings classes that may vary by engine version
-// We use the registry + fallback approach to handle this gracefully
+// Curated friendly names -> settings class names that may vary by engine version.
+// When several entries share a friendly name, the later one wins if its class exists.
+struct FPCGNodeTypeAlias
+{
+    const TCHAR* FriendlyName;
+    const TCHAR* ClassName;
+};
+
+static const FPCGNodeTypeAlias PCGNodeTypeAliases[] =
+{
+    // Core PCG node types - using class names that should work across UE5 versions
+    { TEXT("SurfaceSampler"), TEXT("PCGSurfaceSamplerSettings") },
+    { TEXT("StaticMeshSpawner"), TEXT("PCGStaticMeshSpawnerSettings") },
+    { TEXT("DensityFilter"), TEXT("PCGDensityFilterSettings") },
+    { TEXT("DensityNoise"), TEXT("PCGSpatialNoiseSettings") },
+    { TEXT("Union"), TEXT("PCGMergeSettings") },
+    { TEXT("Merge"), TEXT("PCGMergeSettings") },
+    { TEXT("CopyPoints"), TEXT("PCGCopyPointsSettings") },
+    { TEXT("TransformPoints"), TEXT("PCGTransformPointsSettings") },
+    { TEXT("CreatePointsGrid"), TEXT("PCGCreatePointsGridSettings") },
+    { TEXT("PointsGrid"), TEXT("PCGCreatePointsGridSettings") },
+    { TEXT("AttributeFilter"), TEXT("PCGFilterByAttributeSettings") },
+    { TEXT("FilterByAttribute"), TEXT("PCGFilterByAttributeSettings") },
+    { TEXT("CreateAttribute"), TEXT("PCGCreateAttributeSettings") },
+    { TEXT("Difference"), TEXT("PCGDifferenceSettings") },
+    { TEXT("Subgraph"), TEXT("PCGSubgraphSettings") },
+    { TEXT("GetActorData"), TEXT("PCGGetActorDataSettings") },
+    { TEXT("BoundsModifier"), TEXT("PCGBoundsModifierSettings") },
+    { TEXT("DensityRemapSettings"), TEXT("PCGDensityRemapSettings") },
+    { TEXT("DensityRemap"), TEXT("PCGDensityRemapSettings") },
+    { TEXT("Projection"), TEXT("PCGProjectionSettings") },
+    { TEXT("Intersection"), TEXT("PCGIntersectionSettings") },
+    { TEXT("SplineSampler"), TEXT("PCGSplineSamplerSettings") },
+    { TEXT("VolumeSampler"), TEXT("PCGVolumeSamplerSettings") },
+    { TEXT("PointMatchAndSet"), TEXT("PCGPointMatchAndSetSettings") },
+    { TEXT("AttributeNoise"), TEXT("PCGAttributeNoiseSettings") },
+    { TEXT("AttributeOperation"), TEXT("PCGAttributeOperationSettings") },
+    // UE5.7 alternative class names
+    { TEXT("AttributeFilter"), TEXT("PCGAttributeFilterSettings") },
+    { TEXT("CreateAttribute"), TEXT("PCGMetadataCreateAttributeSettings") },
+    { TEXT("AttributeOperation"), TEXT("PCGMetadataAttributeOperationSettings") },
+    { TEXT("Union"), TEXT("PCGUnionSettings") },
+    { TEXT("MetadataBreakVector"), TEXT("PCGMetadataBreakVectorSettings") },
+    { TEXT("BreakVector"), TEXT("PCGMetadataBreakVectorSettings") },
+    { TEXT("MetadataMakeVector"), TEXT("PCGMetadataMakeVectorSettings") },
+    { TEXT("MakeVector"), TEXT("PCGMetadataMakeVectorSettings") },
+};
+
+// One lookup name for a settings class
+struct FPCGNodeTypeEntry
+{
+    FString DisplayName;
+    TWeakObjectPtr<UClass> Class;
+    // Index into PCGNodeTypeAliases, or INDEX_NONE for names derived from the class name
+    int32 Priority = INDEX_NONE;
+};
+
+// Node type registry: entries keyed by normalized name, plus a trigram index for suggestions
+struct FPCGNodeTypeRegistry
+{
+    TArray<FPCGNodeTypeEntry> Entries;
+    TMap<FString, int32> EntryByKey;
+    TMap<uint32, TArray<int32>> EntriesByTrigram;
+    TSet<FObjectKey> RegisteredClasses;
+};
+
+// Helper to normalize a node type name: lower-case letters and digits only,
+// so "StaticMeshSpawner", "static_mesh_spawner" and "Static Mesh Spawner" share a key
+static FString NormalizeNodeTypeKey(const FString& Name)
+{
+    FString Key;
+    Key.Reserve(Name.Len());
+    for (TCHAR Char : Name)
+    {
+        if (FChar::IsAlnum(Char))
+        {
+            Key.AppendChar(FChar::ToLower(Char));
+        }
+    }
+    return Key;
+}
+
+// Helper to collect the trigrams of a normalized key, padded so short keys and word edges still count
+static void GetKeyTrigrams(const FString& Key, TArray<uint32, TInlineAllocator<32>>& OutTrigrams)
+{
+    const FString Padded = TEXT(" ") + Key + TEXT(" ");
+    for (int32 Index = 0; Index + 2 < Padded.Len(); ++Index)
+    {
+        const uint32 Trigram = (static_cast<uint32>(Padded[Index]) & 0x3FF)
+            | ((static_cast<uint32>(Padded[Index + 1]) & 0x3FF) << 10)
+            | ((static_cast<uint32>(Padded[Index + 2]) & 0x3FF) << 20);
+        OutTrigrams.AddUnique(Trigram);
+    }
+}
+
+// Helper to add or update one lookup name
+static void RegisterNodeTypeName(FPCGNodeTypeRegistry& Registry, const FString& Name, UClass* Class, int32 Priority)
+{
+    const FString Key = NormalizeNodeTypeKey(Name);
+    if (Key.IsEmpty())
+    {
+        return;
+    }
+
+    if (const int32* ExistingIndex = Registry.EntryByKey.Find(Key))
+    {
+        FPCGNodeTypeEntry& Existing = Registry.Entries[*ExistingIndex];
+        if (Priority > Existing.Priority || !Existing.Class.IsValid())
+        {
+            Existing.DisplayName = Name;
+            Existing.Class = Class;
+            Existing.Priority = Priority;
+        }
+        return;
+    }
+
+    FPCGNodeTypeEntry Entry;
+    Entry.DisplayName = Name;
+    Entry.Class = Class;
+    Entry.Priority = Priority;
+    const int32 EntryIndex = Registry.Entries.Add(MoveTemp(Entry));
+    Registry.EntryByKey.Add(Key, EntryIndex);
+
+    TArray<uint32, TInlineAllocator<32>> Trigrams;
+    GetKeyTrigrams(Key, Trigrams);
+    for (uint32 Trigram : Trigrams)
+    {
+        Registry.EntriesByTrigram.FindOrAdd(Trigram).Add(EntryIndex);
+    }
+}
+
+// Helper to register a settings class under its curated aliases, its short name and its class name
+static void RegisterNodeTypeClass(FPCGNodeTypeRegistry& Registry, UClass* Class)
+{
+    if (!Class || !Class->IsChildOf(UPCGSettings::StaticClass())
+        || Class->HasAnyClassFlags(CLASS_Abstract | CLASS_NewerVersionExists))
+    {
+        return;
+    }
+
+    bool bAlreadyRegistered = false;
+    Registry.RegisteredClasses.Add(FObjectKey(Class), &bAlreadyRegistered);
+    if (bAlreadyRegistered)
+    {
+        return;
+    }
+
+    const FString ClassName = Class->GetName();
+    for (int32 AliasIndex = 0; AliasIndex < UE_ARRAY_COUNT(PCGNodeTypeAliases); ++AliasIndex)
+    {
+        if (ClassName.Equals(PCGNodeTypeAliases[AliasIndex].ClassName))
+        {
+            RegisterNodeTypeName(Registry, PCGNodeTypeAliases[AliasIndex].FriendlyName, Class, AliasIndex);
+            UE_LOG(LogTemp, Verbose, TEXT("PCG Registry: Registered '%s' -> %s"), PCGNodeTypeAliases[AliasIndex].FriendlyName, *ClassName);
+        }
+    }
+
+    // Strip "Settings" suffix and PCG prefix for a shorter friendly name
+    FString ShortName = ClassName;
+    if (ShortName.EndsWith(TEXT("Settings")))
+    {
+        ShortName = ShortName.LeftChop(8);
+    }
+    if (ShortName.StartsWith(TEXT("PCG")))
+    {
+        ShortName = ShortName.RightChop(3);
+    }
+
+    RegisterNodeTypeName(Registry, ShortName, Class, INDEX_NONE);
+    // Also register the full class name as a key
+    RegisterNodeTypeName(Registry, ClassName, Class, INDEX_NONE);
+}
+
+// Helper to register the settings classes of a module that loaded after the registry was built.
+// Only the module's own script package is visited, not every class in the engine.
+static void RegisterModuleNodeTypes(FPCGNodeTypeRegistry& Registry, FName ModuleName)
+{
+    UPackage* ScriptPackage = FindPackage(nullptr, *(TEXT("/Script/") + ModuleName.ToString()));
+    if (!ScriptPackage)
+    {
+        return;
+    }
+
+    const int32 NumBefore = Registry.RegisteredClasses.Num();
+    ForEachObjectWithPackage(ScriptPackage, [&Registry](UObject* Object)
+    {
+        RegisterNodeTypeClass(Registry, Cast<UClass>(Object));
+        return true;
+    }, false);
 
-const TMap<FString, UClass*>& FPCGNodeManager::GetNodeTypeRegistry()
+    if (Registry.RegisteredClasses.Num() > NumBefore)
+    {
+        UE_LOG(LogTemp, Display, TEXT("PCG Registry: Module '%s' added %d node types (%d entries)"),
+            *ModuleName.ToString(), Registry.RegisteredClasses.Num() - NumBefore, Registry.Entries.Num());
+    }
+}
+
+// Module load hook that keeps the registry current; removed on module shutdown
+static FDelegateHandle& GetNodeTypeModulesChangedHandle()
+{
+    static FDelegateHandle Handle;
+    return Handle;
+}
+
+static FPCGNodeTypeRegistry& GetNodeTypeRegistry()
 {
-    static TMap<FString, UClass*> Registry;
+    static FPCGNodeTypeRegistry Registry;
     static bool bInitialized = false;
 
     if (!bInitialized)
     {
         bInitialized = true;
 
-        // Helper lambda to safely register a class by name
-        auto TryRegister = [&](const FString& FriendlyName, const FString& ClassName)
+        // Discover UPCGSettings subclasses through the class hierarchy index rather than iterating all classes
+        TArray<UClass*> SettingsClasses;
+        GetDerivedClasses(UPCGSettings::StaticClass(), SettingsClasses, true);
+        for (UClass* Class : SettingsClasses)
         {
-            UClass* FoundClass = FindObject<UClass>(nullptr, *ClassName);
-            if (!FoundClass)
-            {
-                // Try with /Script/PCG prefix
-                FoundClass = FindObject<UClass>(nullptr, *(TEXT("/Script/PCG.") + ClassName));
-            }
-            if (FoundClass && FoundClass->IsChildOf(UPCGSettings::StaticClass()))
-            {
-                Registry.Add(FriendlyName, FoundClass);
-                UE_LOG(LogTemp, Verbose, TEXT("PCG Registry: Registered '%s' -> %s"), *FriendlyName, *FoundClass->GetName());
-            }
-            else
-            {
-                UE_LOG(LogTemp, Verbose, TEXT("PCG Registry: Could not find class '%s' for '%s'"), *ClassName, *FriendlyName);
-            }
-        };
-
-        // Core PCG node types - using class names that should work across UE5 versions
-        TryRegister(TEXT("SurfaceSampler"), TEXT("PCGSurfaceSamplerSettings"));
-        TryRegister(TEXT("StaticMeshSpawner"), TEXT("PCGStaticMeshSpawnerSettings"));
-        TryRegister(TEXT("DensityFilter"), TEXT("PCGDensityFilterSettings"));
-        TryRegister(TEXT("DensityNoise"), TEXT("PCGSpatialNoiseSettings"));
-        TryRegister(TEXT("Union"), TEXT("PCGMergeSettings"));
-        TryRegister(TEXT("Merge"), TEXT("PCGMergeSettings"));
-        TryRegister(TEXT("CopyPoints"), TEXT("PCGCopyPointsSettings"));
-        TryRegister(TEXT("TransformPoints"), TEXT("PCGTransformPointsSettings"));
-        TryRegister(TEXT("CreatePointsGrid"), TEXT("PCGCreatePointsGridSettings"));
-        TryRegister(TEXT("PointsGrid"), TEXT("PCGCreatePointsGridSettings"));
-        TryRegister(TEXT("AttributeFilter"), TEXT("PCGFilterByAttributeSettings"));
-        TryRegister(TEXT("FilterByAttribute"), TEXT("PCGFilterByAttributeSettings"));
-        TryRegister(TEXT("CreateAttribute"), TEXT("PCGCreateAttributeSettings"));
-        TryRegister(TEXT("Difference"), TEXT("PCGDifferenceSettings"));
-        TryRegister(TEXT("Subgraph"), TEXT("PCGSubgraphSettings"));
-        TryRegister(TEXT("GetActorData"), TEXT("PCGGetActorDataSettings"));
-        TryRegister(TEXT("BoundsModifier"), TEXT("PCGBoundsModifierSettings"));
-        TryRegister(TEXT("DensityRemapSettings"), TEXT("PCGDensityRemapSettings"));
-        TryRegister(TEXT("DensityRemap"), TEXT("PCGDensityRemapSettings"));
-        TryRegister(TEXT("Projection"), TEXT("PCGProjectionSettings"));
-        TryRegister(TEXT("Intersection"), TEXT("PCGIntersectionSettings"));
-        TryRegister(TEXT("SplineSampler"), TEXT("PCGSplineSamplerSettings"));
-        TryRegister(TEXT("VolumeSampler"), TEXT("PCGVolumeSamplerSettings"));
-        TryRegister(TEXT("PointMatchAndSet"), TEXT("PCGPointMatchAndSetSettings"));
-        TryRegister(TEXT("AttributeNoise"), TEXT("PCGAttributeNoiseSettings"));
-        TryRegister(TEXT("AttributeOperation"), TEXT("PCGAttributeOperationSettings"));
-        // UE5.7 alternative class names
-        TryRegister(TEXT("AttributeFilter"), TEXT("PCGAttributeFilterSettings"));
-        TryRegister(TEXT("CreateAttribute"), TEXT("PCGMetadataCreateAttributeSettings"));
-        TryRegister(TEXT("AttributeOperation"), TEXT("PCGMetadataAttributeOperationSettings"));
-        TryRegister(TEXT("Union"), TEXT("PCGUnionSettings"));
-        TryRegister(TEXT("MetadataBreakVector"), TEXT("PCGMetadataBreakVectorSettings"));
-        TryRegister(TEXT("BreakVector"), TEXT("PCGMetadataBreakVectorSettings"));
-        TryRegister(TEXT("MetadataMakeVector"), TEXT("PCGMetadataMakeVectorSettings"));
-        TryRegister(TEXT("MakeVector"), TEXT("PCGMetadataMakeVectorSettings"));
-
-        UE_LOG(LogTemp, Display, TEXT("PCG Registry: Registered %d node types"), Registry.Num());
-
-        // Self-discover any remaining UPCGSettings subclasses
-        for (TObjectIterator<UClass> It; It; ++It)
+            RegisterNodeTypeClass(Registry, Class);
+        }
+
+        UE_LOG(LogTemp, Display, TEXT("PCG Registry: Registered %d node types (%d entries)"),
+            Registry.RegisteredClasses.Num(), Registry.Entries.Num());
+
+        // Pick up node types from PCG extension plugins that load later
+        GetNodeTypeModulesChangedHandle() = FModuleManager::Get().OnModulesChanged().AddLambda([](FName ModuleName, EModuleChangeReason Reason)
         {
-            UClass* Class = *It;
-            if (Class->IsChildOf(UPCGSettings::StaticClass()) && !Class->HasAnyClassFlags(CLASS_Abstract))
+            if (Reason == EModuleChangeReason::ModuleLoaded)
             {
-                FString ClassName = Class->GetName();
-                // Strip "Settings" suffix for a shorter friendly name if not already registered
-                FString ShortName = ClassName;
-                if (ShortName.EndsWith(TEXT("Settings")))
-                {
-                    ShortName = ShortName.LeftChop(8); // Remove "Settings"
-                }
-                // Strip PCG prefix if present
-                if (ShortName.StartsWith(TEXT("PCG")))
-                {
-                    ShortName = ShortName.RightChop(3);
-                }
-
-                if (!Registry.Contains(ShortName))
-                {
-                    Registry.Add(ShortName, Class);
-                }
-                // Also register the full class name as a key
-                if (!Registry.Contains(ClassName))
-                {
-                    Registry.Add(ClassName, Class);
-                }
+                RegisterModuleNodeTypes(GetNodeTypeRegistry(), ModuleName);
             }
-        }
-
-        UE_LOG(LogTemp, Display, TEXT("PCG Registry: Total entries after auto-discovery: %d"), Registry.Num());
+        });
     }
 
     return Registry;
 }
 
+void FPCGNodeManager::UnregisterDelegates()
+{
+    FDelegateHandle& Handle = GetNodeTypeModulesChangedHandle();
+    if (Handle.IsValid())
+    {
+        FModuleManager::Get().OnModulesChanged().Remove(Handle);
+        Handle.Reset();
+    }
+}
+
 UClass* FPCGNodeManager::ResolveNodeType(const FString& NodeType)
 {
-    const TMap<FString, UClass*>& Registry = GetNodeTypeRegistry();
+    FPCGNodeTypeRegistry& Registry = GetNodeTypeRegistry();
 
-    // Exact match in registry
-    if (const UClass* const* Found = Registry.Find(NodeType))
+    // Normalized lookup covers friendly names and class names in any casing
+    if (const int32* EntryIndex = Registry.EntryByKey.Find(NormalizeNodeTypeKey(NodeType)))
     {
-        return const_cast<UClass*>(*Found);
+        if (UClass* Class = Registry.Entries[*EntryIndex].Class.Get())
+        {
+            return Class;
+        }
     }
 
-    // Case-insensitive search
-    for (const auto& Pair : Registry)
+    // Fully qualified class paths (e.g. "/Script/MyPlugin.MyNodeSettings")
+    if (NodeType.StartsWith(TEXT("/")))
     {
-        if (Pair.Key.Equals(NodeType, ESearchCase::IgnoreCase))
+        UClass* DirectClass = FindObject<UClass>(nullptr, *NodeType);
+        if (DirectClass && DirectClass->IsChildOf(UPCGSettings::StaticClass()))
         {
-            return Pair.Value;
+            RegisterNodeTypeClass(Registry, DirectClass);
+            return DirectClass;
         }
     }
 
-    // Direct class lookup as fallback
-    UClass* DirectClass = FindObject<UClass>(nullptr, *NodeType);
-    if (!DirectClass)
+    return nullptr;
+}
+
+TArray<FString> FPCGNodeManager::SuggestNodeTypes(const FString& NodeType, int32 MaxSuggestions)
+{
+    const FPCGNodeTypeRegistry& Registry = GetNodeTypeRegistry();
+    const FString Key = NormalizeNodeTypeKey(NodeType);
+
+    TArray<uint32, TInlineAllocator<32>> QueryTrigrams;
+    GetKeyTrigrams(Key, QueryTrigrams);
+
+    // Count shared trigrams per candidate through the inverted index
+    TMap<int32, int32> SharedCounts;
+    for (uint32 Trigram : QueryTrigrams)
     {
-        DirectClass = FindObject<UClass>(nullptr, *(TEXT("/Script/PCG.") + NodeType));
+        if (const TArray<int32>* Candidates = Registry.EntriesByTrigram.Find(Trigram))
+        {
+            for (int32 EntryIndex : *Candidates)
+            {
+                SharedCounts.FindOrAdd(EntryIndex)++;
+            }
+        }
     }
-    if (DirectClass && DirectClass->IsChildOf(UPCGSettings::StaticClass()))
+
+    // Dice similarity over trigram sets, with a bonus when one name contains the other
+    TArray<TPair<float, int32>> Scored;
+    for (const TPair<int32, int32>& Pair : SharedCounts)
     {
-        return DirectClass;
+        const FPCGNodeTypeEntry& Entry = Registry.Entries[Pair.Key];
+        if (!Entry.Class.IsValid())
+        {
+            continue;
+        }
+
+        const FString EntryKey = NormalizeNodeTypeKey(Entry.DisplayName);
+        TArray<uint32, TInlineAllocator<32>> EntryTrigrams;
+        GetKeyTrigrams(EntryKey, EntryTrigrams);
+
+        float Score = 2.0f * Pair.Value / static_cast<float>(QueryTrigrams.Num() + EntryTrigrams.Num());
+        if (!Key.IsEmpty() && (EntryKey.Contains(Key) || Key.Contains(EntryKey)))
+        {
+            Score += 0.5f;
+        }
+        if (Score >= 0.3f)
+        {
+            Scored.Emplace(Score, Pair.Key);
+        }
     }
 
-    return nullptr;
+    Scored.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key > B.Key; });
+
+    // One suggestion per class, best-scoring name first
+    TArray<FString> Suggestions;
+    TSet<UClass*> SuggestedClasses;
+    for (const TPair<float, int32>& Candidate : Scored)
+    {
+        const FPCGNodeTypeEntry& Entry = Registry.Entries[Candidate.Value];
+        bool bAlreadySuggested = false;
+        SuggestedClasses.Add(Entry.Class.Get(), &bAlreadySuggested);
+        if (!bAlreadySuggested)
+        {
+            Suggestions.Add(Entry.DisplayName);
+            if (Suggestions.Num() >= MaxSuggestions)
+            {
+                break;
+            }
+        }
+    }
+
+    return Suggestions;
 }
 
 UPCGNode* FPCGNodeManager::FindNodeByName(UPCGGraph* Graph, const FString& NodeName)
@@ -223,20 +427,19 @@ TSharedPtr<FJsonObject> FPCGNodeManager::AddNode(const TSharedPtr<FJsonObject>&
     UClass* SettingsClass = ResolveNodeType(NodeType);
     if (!SettingsClass)
     {
-        // Build a helpful error with available types
-        FString AvailableTypes;
-        const TMap<FString, UClass*>& Registry = GetNodeTypeRegistry();
-        int32 Count = 0;
-        for (const auto& Pair : Registry)
+        // Suggest close matches from the registry
+        const TArray<FString> Suggestions = SuggestNodeTypes(NodeType);
+        TSharedPtr<FJsonObject> Error = FEpicUnrealMCPCommonUtils::CreateErrorResponse(Suggestions.Num() > 0
+            ? FString::Printf(TEXT("Unknown PCG node type '%s'. Did you mean: %s?"), *NodeType, *FString::Join(Suggestions, TEXT(", ")))
+            : FString::Printf(TEXT("Unknown PCG node type '%s'"), *NodeType));
+
+        TArray<TSharedPtr<FJsonValue>> SuggestionValues;
+        for (const FString& Suggestion : Suggestions)
         {
-            if (Count > 0) AvailableTypes += TEXT(", ");
-            AvailableTypes += Pair.Key;
-            Count++;
-            if (Count >= 30) { AvailableTypes += TEXT("..."); break; }
+            SuggestionValues.Add(MakeShareable(new FJsonValueString(Suggestion)));
         }
-
-        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Unknown PCG node type '%s'. Available types: %s"), *NodeType, *AvailableTypes));
+        Error->SetArrayField(TEXT("suggestions"), SuggestionValues);
+        return Error;
     }
 
     // Get optional position
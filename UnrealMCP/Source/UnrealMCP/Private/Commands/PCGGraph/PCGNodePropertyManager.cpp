@@ -6,7 +6,13 @@
 #include "PCGNode.h"
 #include "PCGSettings.h"
 #include "Engine/StaticMesh.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "UObject/SoftObjectPath.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/UObjectGlobals.h"
+#include "Misc/PackageName.h"
+#include "Async/Async.h"
 
 #if __has_include("Elements/PCGStaticMeshSpawner.h")
 #include "Elements/PCGStaticMeshSpawner.h"
@@ -15,6 +21,163 @@
 #define HAS_PCG_STATIC_MESH_SPAWNER 0
 #endif
 
+// A dotted property path resolved to its property chain. Every link but the last is a struct property.
+// On failure Chain holds the resolved prefix, so callers can report which segment broke.
+struct FPCGResolvedPropertyPath
+{
+    TArray<FProperty*, TInlineAllocator<4>> Chain;
+    bool bResolved = false;
+};
+
+// Mesh and weight fields of a mesh entry struct
+struct FPCGMeshEntryLayout
+{
+    // The mesh reference, either directly on the entry or Descriptor -> mesh (UE5.7)
+    TArray<FProperty*, TInlineAllocator<2>> MeshChain;
+    TArray<FProperty*, TInlineAllocator<2>> WeightProperties;
+};
+
+// Reflection caches. Hot reload and live coding rebuild native layouts and free the FProperty
+// objects these point at, so one ReloadComplete handler flushes all of them.
+struct FPCGPropertyCaches
+{
+    // Resolved paths keyed by (class or struct, lower-cased path), so case-insensitive aliases share an entry
+    TMap<TPair<FObjectKey, FString>, FPCGResolvedPropertyPath> PropertyPaths;
+    TMap<FObjectKey, FArrayProperty*> MeshArrays;
+    TMap<FObjectKey, FPCGMeshEntryLayout> MeshEntryLayouts;
+    FDelegateHandle ReloadHandle;
+};
+
+static FPCGPropertyCaches& GetPropertyCaches()
+{
+    static FPCGPropertyCaches Caches;
+    if (!Caches.ReloadHandle.IsValid())
+    {
+        Caches.ReloadHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddLambda([](EReloadCompleteReason)
+        {
+            FPCGPropertyCaches& Flushed = GetPropertyCaches();
+            Flushed.PropertyPaths.Reset();
+            Flushed.MeshArrays.Reset();
+            Flushed.MeshEntryLayouts.Reset();
+        });
+    }
+    return Caches;
+}
+
+static TMap<TPair<FObjectKey, FString>, FPCGResolvedPropertyPath>& GetPropertyPathCache()
+{
+    return GetPropertyCaches().PropertyPaths;
+}
+
+void FPCGNodePropertyManager::UnregisterDelegates()
+{
+    FPCGPropertyCaches& Caches = GetPropertyCaches();
+    FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(Caches.ReloadHandle);
+    Caches.ReloadHandle.Reset();
+    Caches.PropertyPaths.Reset();
+    Caches.MeshArrays.Reset();
+    Caches.MeshEntryLayouts.Reset();
+}
+
+// Helper to check whether a class or struct layout is fixed for the editor session.
+// Blueprint classes and user-defined structs are regenerated in place on compile, so they are never cached.
+static bool HasNativeLayout(const UStruct* Owner)
+{
+    if (const UClass* Class = Cast<UClass>(Owner))
+    {
+        return Class->HasAnyClassFlags(CLASS_Native);
+    }
+    if (const UScriptStruct* ScriptStruct = Cast<UScriptStruct>(Owner))
+    {
+        return (ScriptStruct->StructFlags & STRUCT_Native) != 0;
+    }
+    return false;
+}
+
+// Helper to find a property by name, falling back to a case-insensitive scan
+static FProperty* FindPropertyIgnoreCase(const UStruct* Owner, const FString& PropertyName)
+{
+    if (FProperty* Property = Owner->FindPropertyByName(FName(*PropertyName)))
+    {
+        return Property;
+    }
+    for (TFieldIterator<FProperty> It(Owner); It; ++It)
+    {
+        if (It->GetName().Equals(PropertyName, ESearchCase::IgnoreCase))
+        {
+            return *It;
+        }
+    }
+    return nullptr;
+}
+
+// Helper to resolve a dotted path (e.g. "InputSource1.AttributeName") on a class or struct.
+// Each segment is looked up once per owner; later calls for the same path are a single map lookup.
+static FPCGResolvedPropertyPath ResolvePropertyPath(const UStruct* Owner, const FString& PropertyPath)
+{
+    const TPair<FObjectKey, FString> CacheKey(FObjectKey(Owner), PropertyPath.ToLower());
+    if (const FPCGResolvedPropertyPath* Cached = GetPropertyPathCache().Find(CacheKey))
+    {
+        return *Cached;
+    }
+
+    FPCGResolvedPropertyPath Resolved;
+    bool bCacheable = true;
+
+    TArray<FString> Segments;
+    PropertyPath.ParseIntoArray(Segments, TEXT("."));
+
+    const UStruct* SegmentOwner = Owner;
+    for (int32 Index = 0; Index < Segments.Num(); ++Index)
+    {
+        bCacheable &= HasNativeLayout(SegmentOwner);
+
+        FProperty* Property = FindPropertyIgnoreCase(SegmentOwner, Segments[Index]);
+        if (!Property)
+        {
+            break;
+        }
+        Resolved.Chain.Add(Property);
+
+        if (Index == Segments.Num() - 1)
+        {
+            Resolved.bResolved = true;
+            break;
+        }
+
+        FStructProperty* StructProp = CastField<FStructProperty>(Property);
+        if (!StructProp)
+        {
+            break;
+        }
+        SegmentOwner = StructProp->Struct;
+    }
+
+    if (bCacheable)
+    {
+        GetPropertyPathCache().Add(CacheKey, Resolved);
+    }
+    return Resolved;
+}
+
+// Helper to find a single (non-dotted) property through the path cache
+static FProperty* FindPropertyCached(const UStruct* Owner, const FString& PropertyName)
+{
+    const FPCGResolvedPropertyPath Resolved = ResolvePropertyPath(Owner, PropertyName);
+    return Resolved.bResolved && Resolved.Chain.Num() == 1 ? Resolved.Chain[0] : nullptr;
+}
+
+// Helper to walk a resolved chain from a container to the value of its property at ChainLength - 1
+static void* GetChainValuePtr(const FPCGResolvedPropertyPath& Resolved, void* Container, int32 ChainLength)
+{
+    void* ValuePtr = Container;
+    for (int32 Index = 0; Index < ChainLength; ++Index)
+    {
+        ValuePtr = Resolved.Chain[Index]->ContainerPtrToValuePtr<void>(ValuePtr);
+    }
+    return ValuePtr;
+}
+
 bool FPCGNodePropertyManager::SetPropertyValue(
     UObject* Object,
     const FString& PropertyName,
@@ -26,19 +189,7 @@ bool FPCGNodePropertyManager::SetPropertyValue(
         return false;
     }
 
-    FProperty* Property = Object->GetClass()->FindPropertyByName(FName(*PropertyName));
-    if (!Property)
-    {
-        // Try case-insensitive search
-        for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
-        {
-            if (It->GetName().Equals(PropertyName, ESearchCase::IgnoreCase))
-            {
-                Property = *It;
-                break;
-            }
-        }
-    }
+    FProperty* Property = FindPropertyCached(Object->GetClass(), PropertyName);
 
     if (!Property)
     {
@@ -510,118 +661,44 @@ TSharedPtr<FJsonObject> FPCGNodePropertyManager::GetNodeProperty(const TSharedPt
             FString::Printf(TEXT("Node '%s' has no settings object"), *NodeId));
     }
 
-    // Navigate dot-notation paths (e.g. "InputSource1.AttributeName")
-    UObject* TargetObject = Settings;
-    void* TargetPtr = nullptr;
-    FProperty* TargetProperty = nullptr;
-    FString RemainingPath = PropertyName;
-
-    while (RemainingPath.Contains(TEXT(".")))
+    // Resolve plain names and dot-notation paths (e.g. "InputSource1.AttributeName")
+    const FPCGResolvedPropertyPath Resolved = ResolvePropertyPath(Settings->GetClass(), PropertyName);
+    if (!Resolved.bResolved)
     {
-        FString Head, Tail;
-        RemainingPath.Split(TEXT("."), &Head, &Tail);
-
-        FProperty* HeadProp = TargetObject->GetClass()->FindPropertyByName(FName(*Head));
-        if (!HeadProp)
+        if (Resolved.Chain.Num() > 0)
         {
-            // Case-insensitive fallback
-            for (TFieldIterator<FProperty> It(TargetObject->GetClass()); It; ++It)
+            FProperty* LastProp = Resolved.Chain.Last();
+            if (!CastField<FStructProperty>(LastProp))
             {
-                if (It->GetName().Equals(Head, ESearchCase::IgnoreCase))
-                {
-                    HeadProp = *It;
-                    break;
-                }
+                return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                    FString::Printf(TEXT("Property '%s' is not a struct, cannot traverse into it"), *LastProp->GetName()));
             }
-        }
-
-        if (!HeadProp)
-        {
-            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Could not find property '%s' on node '%s'"), *Head, *NodeId));
-        }
-
-        FStructProperty* StructProp = CastField<FStructProperty>(HeadProp);
-        if (!StructProp)
-        {
             return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Property '%s' is not a struct, cannot traverse into it"), *Head));
-        }
-
-        TargetPtr = StructProp->ContainerPtrToValuePtr<void>(TargetObject);
-        // For deeper traversal, we need to search within the struct
-        FProperty* LeafProp = StructProp->Struct->FindPropertyByName(FName(*Tail));
-        if (!LeafProp)
-        {
-            for (TFieldIterator<FProperty> It(StructProp->Struct); It; ++It)
-            {
-                if (It->GetName().Equals(Tail, ESearchCase::IgnoreCase))
-                {
-                    LeafProp = *It;
-                    break;
-                }
-            }
+                FString::Printf(TEXT("Could not find property '%s' on node '%s'"), *PropertyName, *NodeId));
         }
 
-        if (LeafProp && !Tail.Contains(TEXT(".")))
-        {
-            TargetProperty = LeafProp;
-            TargetPtr = LeafProp->ContainerPtrToValuePtr<void>(TargetPtr);
-            RemainingPath = TEXT("");
-            break;
-        }
-
-        // If tail still has dots, we need to continue — but we're in struct territory now
-        // For simplicity, fall through to ExportText on the whole struct
-        break;
-    }
-
-    // Simple (non-dotted) property lookup
-    if (!TargetProperty && !RemainingPath.IsEmpty())
-    {
-        TargetProperty = Settings->GetClass()->FindPropertyByName(FName(*RemainingPath));
-        if (!TargetProperty)
-        {
-            for (TFieldIterator<FProperty> It(Settings->GetClass()); It; ++It)
-            {
-                if (It->GetName().Equals(RemainingPath, ESearchCase::IgnoreCase))
-                {
-                    TargetProperty = *It;
-                    break;
-                }
-            }
-        }
-
-        if (!TargetProperty)
+        // Build available properties list
+        FString AvailableProperties;
+        int32 Count = 0;
+        for (TFieldIterator<FProperty> It(Settings->GetClass()); It; ++It)
         {
-            // Build available properties list
-            FString AvailableProperties;
-            int32 Count = 0;
-            for (TFieldIterator<FProperty> It(Settings->GetClass()); It; ++It)
+            if (It->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible))
             {
-                if (It->HasAnyPropertyFlags(CPF_Edit | CPF_BlueprintVisible))
-                {
-                    if (Count > 0) AvailableProperties += TEXT(", ");
-                    AvailableProperties += It->GetName();
-                    Count++;
-                    if (Count >= 30) { AvailableProperties += TEXT("..."); break; }
-                }
+                if (Count > 0) AvailableProperties += TEXT(", ");
+                AvailableProperties += It->GetName();
+                Count++;
+                if (Count >= 30) { AvailableProperties += TEXT("..."); break; }
             }
-
-            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-                FString::Printf(TEXT("Could not find property '%s' on node '%s' (class: %s). Available: %s"),
-                    *PropertyName, *NodeId, *Settings->GetClass()->GetName(), *AvailableProperties));
         }
 
-        TargetPtr = TargetProperty->ContainerPtrToValuePtr<void>(Settings);
-    }
-
-    if (!TargetProperty || !TargetPtr)
-    {
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
-            FString::Printf(TEXT("Could not resolve property '%s' on node '%s'"), *PropertyName, *NodeId));
+            FString::Printf(TEXT("Could not find property '%s' on node '%s' (class: %s). Available: %s"),
+                *PropertyName, *NodeId, *Settings->GetClass()->GetName(), *AvailableProperties));
     }
 
+    FProperty* TargetProperty = Resolved.Chain.Last();
+    void* TargetPtr = GetChainValuePtr(Resolved, Settings, Resolved.Chain.Num());
+
     FString PropertyType;
     TSharedPtr<FJsonValue> JsonValue = ReadPropertyToJson(TargetProperty, TargetPtr, PropertyType);
 
@@ -638,6 +715,18 @@ TSharedPtr<FJsonObject> FPCGNodePropertyManager::GetNodeProperty(const TSharedPt
     return Result;
 }
 
+bool FPCGNodePropertyManager::ApplySettingsProperty(
+    UObject* Settings,
+    const FString& PropertyName,
+    const TSharedPtr<FJsonValue>& JsonValue,
+    FString& OutPropertyType)
+{
+    // Try to set the property via reflection — use dot-notation path traversal if needed
+    return PropertyName.Contains(TEXT("."))
+        ? SetPropertyValueByPath(Settings, PropertyName, JsonValue, OutPropertyType)
+        : SetPropertyValue(Settings, PropertyName, JsonValue, OutPropertyType);
+}
+
 TSharedPtr<FJsonObject> FPCGNodePropertyManager::SetNodeProperty(const TSharedPtr<FJsonObject>& Params)
 {
     FString GraphPath;
@@ -686,11 +775,8 @@ TSharedPtr<FJsonObject> FPCGNodePropertyManager::SetNodeProperty(const TSharedPt
             FString::Printf(TEXT("Node '%s' has no settings object"), *NodeId));
     }
 
-    // Try to set the property via reflection — use dot-notation path traversal if needed
     FString PropertyType;
-    bool bSuccess = PropertyName.Contains(TEXT("."))
-        ? SetPropertyValueByPath(Settings, PropertyName, PropertyValue, PropertyType)
-        : SetPropertyValue(Settings, PropertyName, PropertyValue, PropertyType);
+    bool bSuccess = ApplySettingsProperty(Settings, PropertyName, PropertyValue, PropertyType);
 
     if (!bSuccess)
     {
@@ -741,19 +827,7 @@ bool FPCGNodePropertyManager::SetStructPropertyValue(
     }
 
     // Find the property on the struct
-    FProperty* Property = Struct->FindPropertyByName(FName(*PropertyName));
-    if (!Property)
-    {
-        // Case-insensitive fallback
-        for (TFieldIterator<FProperty> It(Struct); It; ++It)
-        {
-            if (It->GetName().Equals(PropertyName, ESearchCase::IgnoreCase))
-            {
-                Property = *It;
-                break;
-            }
-        }
-    }
+    FProperty* Property = FindPropertyCached(Struct, PropertyName);
 
     if (!Property)
     {
@@ -920,83 +994,147 @@ bool FPCGNodePropertyManager::SetPropertyValueByPath(
         return false;
     }
 
-    // Split on first dot: "InputSource1.AttributeName" -> head="InputSource1", tail="AttributeName"
-    FString Head, Tail;
-    if (!PropertyPath.Split(TEXT("."), &Head, &Tail))
+    if (!PropertyPath.Contains(TEXT(".")))
     {
         // No dot — shouldn't happen (caller checks), but handle gracefully
         return SetPropertyValue(Object, PropertyPath, JsonValue, OutPropertyType);
     }
 
-    // Find the head property on the object
-    FProperty* HeadProp = Object->GetClass()->FindPropertyByName(FName(*Head));
-    if (!HeadProp)
+    // Resolve "InputSource1.AttributeName" (any depth) to its property chain
+    const FPCGResolvedPropertyPath Resolved = ResolvePropertyPath(Object->GetClass(), PropertyPath);
+    if (!Resolved.bResolved)
+    {
+        if (Resolved.Chain.Num() > 0 && !CastField<FStructProperty>(Resolved.Chain.Last()))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("SetPropertyValueByPath: Property '%s' is not a struct (type: %s)"),
+                *Resolved.Chain.Last()->GetName(), *Resolved.Chain.Last()->GetCPPType());
+        }
+        else
+        {
+            UE_LOG(LogTemp, Warning, TEXT("SetPropertyValueByPath: Could not resolve '%s' on %s"),
+                *PropertyPath, *Object->GetClass()->GetName());
+        }
+        return false;
+    }
+
+    // Everything but the leaf is a struct; set the leaf on the innermost struct
+    const int32 LeafIndex = Resolved.Chain.Num() - 1;
+    if (LeafIndex == 0)
+    {
+        return SetPropertyValue(Object, Resolved.Chain[0]->GetName(), JsonValue, OutPropertyType);
+    }
+    FStructProperty* OwnerStructProp = CastField<FStructProperty>(Resolved.Chain[LeafIndex - 1]);
+    void* InnerPtr = GetChainValuePtr(Resolved, Object, LeafIndex);
+    return SetStructPropertyValue(OwnerStructProp->Struct, InnerPtr, Resolved.Chain[LeafIndex]->GetName(), JsonValue, OutPropertyType);
+}
+
+// Helper to find the mesh entries array on a spawner settings (or mesh selector) class, cached per class
+static FArrayProperty* FindMeshEntriesArray(UClass* Class)
+{
+    TMap<FObjectKey, FArrayProperty*>& MeshArrayCache = GetPropertyCaches().MeshArrays;
+
+    const FObjectKey CacheKey(Class);
+    if (FArrayProperty* const* Cached = MeshArrayCache.Find(CacheKey))
+    {
+        return *Cached;
+    }
+
+    FArrayProperty* Found = nullptr;
+    for (TFieldIterator<FArrayProperty> It(Class); It; ++It)
     {
-        // Case-insensitive fallback
-        for (TFieldIterator<FProperty> It(Object->GetClass()); It; ++It)
+        FStructProperty* InnerStructProp = CastField<FStructProperty>((*It)->Inner);
+        if (InnerStructProp)
         {
-            if (It->GetName().Equals(Head, ESearchCase::IgnoreCase))
+            FString StructName = InnerStructProp->Struct->GetName();
+            if (StructName.Contains(TEXT("MeshSpawnerEntry")) ||
+                StructName.Contains(TEXT("WeightedMesh")) ||
+                StructName.Contains(TEXT("MeshEntry")) ||
+                StructName.Contains(TEXT("MeshSelectorWeighted")))
             {
-                HeadProp = *It;
+                Found = *It;
                 break;
             }
         }
     }
 
-    if (!HeadProp)
+    if (HasNativeLayout(Class))
     {
-        UE_LOG(LogTemp, Warning, TEXT("SetPropertyValueByPath: Could not find property '%s' on %s"),
-            *Head, *Object->GetClass()->GetName());
-        return false;
+        MeshArrayCache.Add(CacheKey, Found);
     }
+    return Found;
+}
 
-    // Head must be a struct property to traverse into
-    FStructProperty* StructProp = CastField<FStructProperty>(HeadProp);
-    if (!StructProp)
+// Helper to check whether a property can hold a mesh reference set from a path
+static bool IsMeshReferenceProperty(FProperty* Prop)
+{
+    if (CastField<FSoftObjectProperty>(Prop) || CastField<FObjectProperty>(Prop))
     {
-        UE_LOG(LogTemp, Warning, TEXT("SetPropertyValueByPath: Property '%s' is not a struct (type: %s)"),
-            *Head, *HeadProp->GetCPPType());
-        return false;
+        return true;
     }
+    FStructProperty* StructProp = CastField<FStructProperty>(Prop);
+    return StructProp && StructProp->Struct == TBaseStructure<FSoftObjectPath>::Get();
+}
+
+// Helper to find the mesh and weight fields of an entry struct once, instead of scanning it for every entry
+static FPCGMeshEntryLayout FindMeshEntryLayout(UScriptStruct* EntryStruct)
+{
+    TMap<FObjectKey, FPCGMeshEntryLayout>& LayoutCache = GetPropertyCaches().MeshEntryLayouts;
 
-    void* InnerPtr = StructProp->ContainerPtrToValuePtr<void>(Object);
-    UScriptStruct* InnerStruct = StructProp->Struct;
+    const FObjectKey CacheKey(EntryStruct);
+    if (const FPCGMeshEntryLayout* Cached = LayoutCache.Find(CacheKey))
+    {
+        return *Cached;
+    }
 
-    // If tail still contains dots, recurse deeper
-    if (Tail.Contains(TEXT(".")))
+    FPCGMeshEntryLayout Layout;
+    bool bCacheable = HasNativeLayout(EntryStruct);
+    for (TFieldIterator<FProperty> PropIt(EntryStruct); PropIt; ++PropIt)
     {
-        FString NextHead, NextTail;
-        Tail.Split(TEXT("."), &NextHead, &NextTail);
+        FProperty* Prop = *PropIt;
+        FString PropName = Prop->GetName();
 
-        FProperty* NextProp = InnerStruct->FindPropertyByName(FName(*NextHead));
-        if (!NextProp)
+        // Mesh reference — look for soft object path / mesh properties
+        if (Layout.MeshChain.Num() == 0 && PropName.Contains(TEXT("Mesh"), ESearchCase::IgnoreCase)
+            && IsMeshReferenceProperty(Prop))
         {
-            for (TFieldIterator<FProperty> It(InnerStruct); It; ++It)
+            Layout.MeshChain.Add(Prop);
+            continue;
+        }
+
+        // UE5.7: mesh is inside a Descriptor struct — search inside it
+        if (Layout.MeshChain.Num() == 0 && PropName.Equals(TEXT("Descriptor"), ESearchCase::IgnoreCase))
+        {
+            if (FStructProperty* DescStructProp = CastField<FStructProperty>(Prop))
             {
-                if (It->GetName().Equals(NextHead, ESearchCase::IgnoreCase))
+                bCacheable &= HasNativeLayout(DescStructProp->Struct);
+                for (TFieldIterator<FProperty> DescIt(DescStructProp->Struct); DescIt; ++DescIt)
                 {
-                    NextProp = *It;
-                    break;
+                    if (DescIt->GetName().Contains(TEXT("Mesh"), ESearchCase::IgnoreCase) && IsMeshReferenceProperty(*DescIt))
+                    {
+                        Layout.MeshChain.Add(Prop);
+                        Layout.MeshChain.Add(*DescIt);
+                        break;
+                    }
+                }
+                if (Layout.MeshChain.Num() > 0)
+                {
+                    continue;
                 }
             }
         }
 
-        if (NextProp)
+        if (PropName.Contains(TEXT("Weight"), ESearchCase::IgnoreCase)
+            && (CastField<FIntProperty>(Prop) || CastField<FFloatProperty>(Prop)))
         {
-            FStructProperty* NextStructProp = CastField<FStructProperty>(NextProp);
-            if (NextStructProp)
-            {
-                void* DeepPtr = NextStructProp->ContainerPtrToValuePtr<void>(InnerPtr);
-                return SetStructPropertyValue(NextStructProp->Struct, DeepPtr, NextTail, JsonValue, OutPropertyType);
-            }
+            Layout.WeightProperties.Add(Prop);
         }
-
-        UE_LOG(LogTemp, Warning, TEXT("SetPropertyValueByPath: Could not traverse deeper into '%s.%s'"), *Head, *NextHead);
-        return false;
     }
 
-    // Tail is the leaf property name — set it on the inner struct
-    return SetStructPropertyValue(InnerStruct, InnerPtr, Tail, JsonValue, OutPropertyType);
+    if (bCacheable)
+    {
+        LayoutCache.Add(CacheKey, Layout);
+    }
+    return Layout;
 }
 
 TSharedPtr<FJsonObject> FPCGNodePropertyManager::SetSpawnerEntries(const TSharedPtr<FJsonObject>& Params)
@@ -1019,6 +1157,15 @@ TSharedPtr<FJsonObject> FPCGNodePropertyManager::SetSpawnerEntries(const TShared
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'entries' array parameter"));
     }
 
+    FString PreloadMode = TEXT("wait");
+    Params->TryGetStringField(TEXT("preload"), PreloadMode);
+    PreloadMode = PreloadMode.ToLower();
+    if (PreloadMode != TEXT("wait") && PreloadMode != TEXT("async") && PreloadMode != TEXT("none"))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Invalid preload '%s'. Use 'wait', 'async' or 'none'"), *PreloadMode));
+    }
+
     UPCGGraph* Graph = FPCGGraphCreator::LoadPCGGraph(GraphPath);
     if (!Graph)
     {
@@ -1042,51 +1189,28 @@ TSharedPtr<FJsonObject> FPCGNodePropertyManager::SetSpawnerEntries(const TShared
 
     // Use reflection to find the mesh entries TArray property.
     // In UE5.7, StaticMeshSpawner stores entries on MeshSelectorParameters sub-object.
-    FArrayProperty* MeshArrayProp = nullptr;
-    FStructProperty* MeshEntryStructProp = nullptr;
     UObject* MeshEntriesOwner = Settings; // The object that owns the array (may be sub-object)
 
-    // Lambda to search an object for mesh entry arrays
-    auto FindMeshEntriesOnObject = [&](UObject* Obj) -> bool
-    {
-        for (TFieldIterator<FArrayProperty> It(Obj->GetClass()); It; ++It)
-        {
-            FStructProperty* InnerStructProp = CastField<FStructProperty>((*It)->Inner);
-            if (InnerStructProp)
-            {
-                FString StructName = InnerStructProp->Struct->GetName();
-                if (StructName.Contains(TEXT("MeshSpawnerEntry")) ||
-                    StructName.Contains(TEXT("WeightedMesh")) ||
-                    StructName.Contains(TEXT("MeshEntry")) ||
-                    StructName.Contains(TEXT("MeshSelectorWeighted")))
-                {
-                    MeshArrayProp = *It;
-                    MeshEntryStructProp = InnerStructProp;
-                    MeshEntriesOwner = Obj;
-                    return true;
-                }
-            }
-        }
-        return false;
-    };
-
     // First search directly on settings
-    FindMeshEntriesOnObject(Settings);
+    FArrayProperty* MeshArrayProp = FindMeshEntriesArray(Settings->GetClass());
 
     // If not found, check MeshSelectorParameters sub-object (UE5.7 pattern)
     if (!MeshArrayProp)
     {
-        FObjectProperty* SelectorProp = FindFProperty<FObjectProperty>(Settings->GetClass(), TEXT("MeshSelectorParameters"));
+        FObjectProperty* SelectorProp = CastField<FObjectProperty>(FindPropertyCached(Settings->GetClass(), TEXT("MeshSelectorParameters")));
         if (SelectorProp)
         {
             UObject* SelectorObj = SelectorProp->GetObjectPropertyValue(SelectorProp->ContainerPtrToValuePtr<void>(Settings));
             if (SelectorObj)
             {
-                FindMeshEntriesOnObject(SelectorObj);
+                MeshArrayProp = FindMeshEntriesArray(SelectorObj->GetClass());
+                MeshEntriesOwner = SelectorObj;
             }
         }
     }
 
+    FStructProperty* MeshEntryStructProp = MeshArrayProp ? CastField<FStructProperty>(MeshArrayProp->Inner) : nullptr;
+
     if (!MeshArrayProp || !MeshEntryStructProp)
     {
         // List available array properties for debugging
@@ -1111,15 +1235,11 @@ TSharedPtr<FJsonObject> FPCGNodePropertyManager::SetSpawnerEntries(const TShared
     }
 
     UScriptStruct* EntryStruct = MeshEntryStructProp->Struct;
+    const FPCGMeshEntryLayout EntryLayout = FindMeshEntryLayout(EntryStruct);
 
-    // Get the array helper to manipulate the TArray (use MeshEntriesOwner, not Settings)
-    FScriptArrayHelper ArrayHelper(MeshArrayProp, MeshArrayProp->ContainerPtrToValuePtr<void>(MeshEntriesOwner));
-
-    // Clear existing entries
-    ArrayHelper.EmptyValues();
-
-    int32 AddedCount = 0;
-
+    // Parse every entry first so the meshes can be requested together
+    TArray<TPair<FSoftObjectPath, int32>> ParsedEntries;
+    TArray<FSoftObjectPath> MeshPaths;
     for (const TSharedPtr<FJsonValue>& EntryValue : *EntriesArray)
     {
         const TSharedPtr<FJsonObject>* EntryObj;
@@ -1140,103 +1260,156 @@ TSharedPtr<FJsonObject> FPCGNodePropertyManager::SetSpawnerEntries(const TShared
             Weight = static_cast<int32>((*EntryObj)->GetNumberField(TEXT("weight")));
         }
 
-        // Add a new element to the array
-        int32 NewIndex = ArrayHelper.AddValue();
-        uint8* EntryPtr = ArrayHelper.GetRawPtr(NewIndex);
-
-        // Lambda to set a mesh on a property within a given struct
-        auto TrySetMeshOnProperty = [&MeshPath](FProperty* Prop, void* PropValuePtr) -> bool
+        // Package-only paths ("/Game/Meshes/SM_Wall") name the asset of the same name
+        if (!FPackageName::GetShortName(MeshPath).Contains(TEXT(".")))
         {
-            // Try FSoftObjectProperty first (TSoftObjectPtr<UStaticMesh>)
-            if (FSoftObjectProperty* SoftProp = CastField<FSoftObjectProperty>(Prop))
-            {
-                FSoftObjectPtr& SoftPtr = *reinterpret_cast<FSoftObjectPtr*>(PropValuePtr);
-                SoftPtr = FSoftObjectPath(MeshPath);
-                return true;
-            }
+            MeshPath += TEXT(".") + FPackageName::GetShortName(MeshPath);
+        }
+
+        const FSoftObjectPath MeshObjectPath(MeshPath);
+        ParsedEntries.Emplace(MeshObjectPath, Weight);
+        MeshPaths.AddUnique(MeshObjectPath);
+    }
 
-            // Try FStructProperty for FSoftObjectPath
-            if (FStructProperty* StructProp = CastField<FStructProperty>(Prop))
+    // A hard UStaticMesh* entry field needs the loaded object, so it always waits
+    if (EntryLayout.MeshChain.Num() > 0 && CastField<FObjectProperty>(EntryLayout.MeshChain.Last()))
+    {
+        PreloadMode = TEXT("wait");
+    }
+
+    // One streamable request for every referenced mesh instead of a blocking LoadObject per entry.
+    // A waited load is released once the entries are written; an async load is only kept while it is
+    // still pending, so a node's handle never outlives its load.
+    static TMap<FString, TSharedPtr<FStreamableHandle>> SpawnerPreloadHandles;
+    const FString PreloadKey = GraphPath + TEXT(":") + NodeId;
+    SpawnerPreloadHandles.Remove(PreloadKey);
+
+    const double LoadStartTime = FPlatformTime::Seconds();
+    TArray<TSharedPtr<FJsonValue>> MissingMeshes;
+    TSharedPtr<FStreamableHandle> LoadHandle;
+    if (PreloadMode != TEXT("none") && MeshPaths.Num() > 0)
+    {
+        // Drop the pending entry on completion, on a later tick rather than inside the handle's own callback
+        FStreamableDelegate OnLoaded = FStreamableDelegate::CreateLambda([PreloadKey]()
+        {
+            AsyncTask(ENamedThreads::GameThread, [PreloadKey]()
             {
-                if (StructProp->Struct == TBaseStructure<FSoftObjectPath>::Get())
+                const TSharedPtr<FStreamableHandle>* Pending = SpawnerPreloadHandles.Find(PreloadKey);
+                if (Pending && (!Pending->IsValid() || !(*Pending)->IsLoadingInProgress()))
                 {
-                    FSoftObjectPath& SoftPath = *reinterpret_cast<FSoftObjectPath*>(PropValuePtr);
-                    SoftPath.SetPath(MeshPath);
-                    return true;
+                    SpawnerPreloadHandles.Remove(PreloadKey);
                 }
+            });
+        });
+
+        LoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+            MeshPaths, MoveTemp(OnLoaded), FStreamableManager::AsyncLoadHighPriority);
+        if (LoadHandle.IsValid())
+        {
+            if (PreloadMode == TEXT("wait"))
+            {
+                LoadHandle->WaitUntilComplete();
             }
+            else if (LoadHandle->IsLoadingInProgress())
+            {
+                SpawnerPreloadHandles.Add(PreloadKey, LoadHandle);
+            }
+        }
 
-            // Try FObjectProperty (direct UStaticMesh pointer)
-            if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Prop))
+        if (PreloadMode == TEXT("wait"))
+        {
+            for (const FSoftObjectPath& MeshObjectPath : MeshPaths)
             {
-                UStaticMesh* LoadedMesh = LoadObject<UStaticMesh>(nullptr, *MeshPath);
-                if (LoadedMesh)
+                if (!Cast<UStaticMesh>(MeshObjectPath.ResolveObject()))
                 {
-                    ObjProp->SetObjectPropertyValue(PropValuePtr, LoadedMesh);
-                    return true;
+                    MissingMeshes.Add(MakeShareable(new FJsonValueString(MeshObjectPath.ToString())));
                 }
             }
-            return false;
-        };
+        }
+    }
+    const double LoadTimeMs = (FPlatformTime::Seconds() - LoadStartTime) * 1000.0;
 
-        // Set each field on the new entry using reflection
-        bool bMeshSet = false;
-        for (TFieldIterator<FProperty> PropIt(EntryStruct); PropIt; ++PropIt)
+    // Set a mesh on a property within a given struct
+    auto TrySetMeshOnProperty = [](FProperty* Prop, void* PropValuePtr, const FSoftObjectPath& MeshObjectPath) -> bool
+    {
+        // Try FSoftObjectProperty first (TSoftObjectPtr<UStaticMesh>)
+        if (FSoftObjectProperty* SoftProp = CastField<FSoftObjectProperty>(Prop))
         {
-            FProperty* Prop = *PropIt;
-            void* PropValuePtr = Prop->ContainerPtrToValuePtr<void>(EntryPtr);
-            FString PropName = Prop->GetName();
+            FSoftObjectPtr& SoftPtr = *reinterpret_cast<FSoftObjectPtr*>(PropValuePtr);
+            SoftPtr = MeshObjectPath;
+            return true;
+        }
 
-            // Set the mesh path — look for soft object path / mesh properties
-            if (!bMeshSet && (PropName.Contains(TEXT("Mesh"), ESearchCase::IgnoreCase) ||
-                PropName.Contains(TEXT("StaticMesh"), ESearchCase::IgnoreCase)))
+        // Try FStructProperty for FSoftObjectPath
+        if (FStructProperty* StructProp = CastField<FStructProperty>(Prop))
+        {
+            if (StructProp->Struct == TBaseStructure<FSoftObjectPath>::Get())
             {
-                bMeshSet = TrySetMeshOnProperty(Prop, PropValuePtr);
-                if (bMeshSet) continue;
+                *reinterpret_cast<FSoftObjectPath*>(PropValuePtr) = MeshObjectPath;
+                return true;
             }
+        }
 
-            // UE5.7: mesh is inside a Descriptor struct — recurse into it
-            if (!bMeshSet && PropName.Equals(TEXT("Descriptor"), ESearchCase::IgnoreCase))
+        // Try FObjectProperty (direct UStaticMesh pointer), resolved from the preloaded set
+        if (FObjectProperty* ObjProp = CastField<FObjectProperty>(Prop))
+        {
+            if (UStaticMesh* LoadedMesh = Cast<UStaticMesh>(MeshObjectPath.ResolveObject()))
             {
-                FStructProperty* DescStructProp = CastField<FStructProperty>(Prop);
-                if (DescStructProp)
-                {
-                    // Search inside the Descriptor for mesh-like properties
-                    for (TFieldIterator<FProperty> DescIt(DescStructProp->Struct); DescIt; ++DescIt)
-                    {
-                        FProperty* DescProp = *DescIt;
-                        FString DescPropName = DescProp->GetName();
-                        if (DescPropName.Contains(TEXT("Mesh"), ESearchCase::IgnoreCase) ||
-                            DescPropName.Contains(TEXT("StaticMesh"), ESearchCase::IgnoreCase))
-                        {
-                            void* DescPropValuePtr = DescProp->ContainerPtrToValuePtr<void>(PropValuePtr);
-                            bMeshSet = TrySetMeshOnProperty(DescProp, DescPropValuePtr);
-                            if (bMeshSet) break;
-                        }
-                    }
-                    if (bMeshSet) continue;
-                }
+                ObjProp->SetObjectPropertyValue(PropValuePtr, LoadedMesh);
+                return true;
             }
+        }
+        return false;
+    };
 
-            // Set the weight
-            if (PropName.Contains(TEXT("Weight"), ESearchCase::IgnoreCase))
+    // Get the array helper to manipulate the TArray (use MeshEntriesOwner, not Settings)
+    FScriptArrayHelper ArrayHelper(MeshArrayProp, MeshArrayProp->ContainerPtrToValuePtr<void>(MeshEntriesOwner));
+
+    // Replace existing entries, sizing the array once
+    ArrayHelper.EmptyValues();
+    ArrayHelper.AddValues(ParsedEntries.Num());
+
+    int32 AddedCount = 0;
+
+    for (int32 EntryIndex = 0; EntryIndex < ParsedEntries.Num(); ++EntryIndex)
+    {
+        const FSoftObjectPath& MeshObjectPath = ParsedEntries[EntryIndex].Key;
+        const int32 Weight = ParsedEntries[EntryIndex].Value;
+        uint8* EntryPtr = ArrayHelper.GetRawPtr(EntryIndex);
+
+        // Set the mesh and weight fields found for this entry type
+        if (EntryLayout.MeshChain.Num() > 0)
+        {
+            void* MeshValuePtr = EntryPtr;
+            for (FProperty* Prop : EntryLayout.MeshChain)
             {
-                if (FIntProperty* IntProp = CastField<FIntProperty>(Prop))
-                {
-                    IntProp->SetPropertyValue(PropValuePtr, Weight);
-                    continue;
-                }
-                if (FFloatProperty* FloatProp = CastField<FFloatProperty>(Prop))
-                {
-                    FloatProp->SetPropertyValue(PropValuePtr, static_cast<float>(Weight));
-                    continue;
-                }
+                MeshValuePtr = Prop->ContainerPtrToValuePtr<void>(MeshValuePtr);
+            }
+            TrySetMeshOnProperty(EntryLayout.MeshChain.Last(), MeshValuePtr, MeshObjectPath);
+        }
+
+        for (FProperty* WeightProp : EntryLayout.WeightProperties)
+        {
+            void* WeightValuePtr = WeightProp->ContainerPtrToValuePtr<void>(EntryPtr);
+            if (FIntProperty* IntProp = CastField<FIntProperty>(WeightProp))
+            {
+                IntProp->SetPropertyValue(WeightValuePtr, Weight);
+            }
+            else if (FFloatProperty* FloatProp = CastField<FFloatProperty>(WeightProp))
+            {
+                FloatProp->SetPropertyValue(WeightValuePtr, static_cast<float>(Weight));
             }
         }
 
         AddedCount++;
     }
 
+    // The entries are written, so a waited load has nothing left to hold
+    if (LoadHandle.IsValid() && PreloadMode == TEXT("wait"))
+    {
+        LoadHandle->ReleaseHandle();
+    }
+
     // Mark as modified
     Settings->MarkPackageDirty();
     Graph->ForceNotificationForEditor(EPCGChangeType::Structural);
@@ -1248,6 +1421,10 @@ TSharedPtr<FJsonObject> FPCGNodePropertyManager::SetSpawnerEntries(const TShared
     Result->SetNumberField(TEXT("entry_count"), AddedCount);
     Result->SetStringField(TEXT("array_property"), MeshArrayProp->GetName());
     Result->SetStringField(TEXT("entry_struct"), EntryStruct->GetName());
+    Result->SetStringField(TEXT("preload"), PreloadMode);
+    Result->SetNumberField(TEXT("mesh_count"), MeshPaths.Num());
+    Result->SetNumberField(TEXT("load_time_ms"), LoadTimeMs);
+    Result->SetArrayField(TEXT("missing_meshes"), MissingMeshes);
 
     return Result;
 }
@@ -0,0 +1,545 @@
+#include "Commands/PCGGraph/PCGOutputExporter.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "PCGComponent.h"
+#include "PCGData.h"
+#include "Data/PCGPointData.h"
+#include "Metadata/PCGMetadata.h"
+#include "Metadata/PCGMetadataAttributeTpl.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Editor.h"
+#include "Misc/Base64.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include <limits>
+
+#if __has_include("Data/PCGBasePointData.h")
+#include "Data/PCGBasePointData.h"
+#define MCP_PCG_HAS_BASE_POINT_DATA 1
+#else
+#define MCP_PCG_HAS_BASE_POINT_DATA 0
+#endif
+
+// Blobs above this size are written to Saved/ in "auto" mode instead of being inlined as base64.
+// Inline data goes through the JSON bridge and into the client's context, so keep it small.
+static constexpr int32 MaxInlinePCGOutputBytes = 64 * 1024;
+
+// Built-in point columns, in the order they are written when requested
+struct FPCGOutputColumnDef
+{
+    const TCHAR* Name;
+    int32 Components;
+    bool bInt32;
+};
+
+static const FPCGOutputColumnDef PCGOutputBuiltinColumns[] =
+{
+    { TEXT("position"), 3, false },
+    { TEXT("rotation"), 4, false },     // Quaternion x, y, z, w
+    { TEXT("scale"), 3, false },
+    { TEXT("density"), 1, false },
+    { TEXT("seed"), 1, true },
+    { TEXT("bounds_min"), 3, false },
+    { TEXT("bounds_max"), 3, false },
+    { TEXT("color"), 4, false },
+    { TEXT("steepness"), 1, false },
+};
+
+enum class EPCGOutputBuiltinColumn : int32
+{
+    Position, Rotation, Scale, Density, Seed, BoundsMin, BoundsMax, Color, Steepness
+};
+
+struct FPCGOutputColumn
+{
+    FString Name;
+    int32 Components = 1;
+    bool bInt32 = false;
+    // Index into PCGOutputBuiltinColumns, or INDEX_NONE for a metadata attribute
+    int32 BuiltinIndex = INDEX_NONE;
+    FName AttributeName;
+    TArray<float> Floats;
+    TArray<int32> Ints;
+};
+
+#if MCP_PCG_HAS_BASE_POINT_DATA
+using FMCPOutputPointData = UPCGBasePointData;
+
+// Per-point accessors over the value ranges of a point data (UE 5.6+ structure-of-arrays layout)
+struct FPCGOutputPointReader
+{
+    explicit FPCGOutputPointReader(const UPCGBasePointData* PointData)
+        : Transforms(PointData->GetConstTransformValueRange())
+        , Densities(PointData->GetConstDensityValueRange())
+        , Seeds(PointData->GetConstSeedValueRange())
+        , BoundsMins(PointData->GetConstBoundsMinValueRange())
+        , BoundsMaxs(PointData->GetConstBoundsMaxValueRange())
+        , Colors(PointData->GetConstColorValueRange())
+        , Steepnesses(PointData->GetConstSteepnessValueRange())
+        , MetadataEntries(PointData->GetConstMetadataEntryValueRange())
+    {
+    }
+
+    const FTransform& GetTransform(int32 Index) const { return Transforms[Index]; }
+    float GetDensity(int32 Index) const { return Densities[Index]; }
+    int32 GetSeed(int32 Index) const { return Seeds[Index]; }
+    const FVector& GetBoundsMin(int32 Index) const { return BoundsMins[Index]; }
+    const FVector& GetBoundsMax(int32 Index) const { return BoundsMaxs[Index]; }
+    const FVector4& GetColor(int32 Index) const { return Colors[Index]; }
+    float GetSteepness(int32 Index) const { return Steepnesses[Index]; }
+    int64 GetMetadataEntry(int32 Index) const { return MetadataEntries[Index]; }
+
+    TConstPCGValueRange<FTransform> Transforms;
+    TConstPCGValueRange<float> Densities;
+    TConstPCGValueRange<int32> Seeds;
+    TConstPCGValueRange<FVector> BoundsMins;
+    TConstPCGValueRange<FVector> BoundsMaxs;
+    TConstPCGValueRange<FVector4> Colors;
+    TConstPCGValueRange<float> Steepnesses;
+    TConstPCGValueRange<int64> MetadataEntries;
+};
+
+static int32 GetOutputPointCount(const UPCGBasePointData* PointData)
+{
+    return PointData->GetNumPoints();
+}
+#else
+using FMCPOutputPointData = UPCGPointData;
+
+// Per-point accessors over an FPCGPoint array
+struct FPCGOutputPointReader
+{
+    explicit FPCGOutputPointReader(const UPCGPointData* PointData)
+        : Points(PointData->GetPoints())
+    {
+    }
+
+    const FTransform& GetTransform(int32 Index) const { return Points[Index].Transform; }
+    float GetDensity(int32 Index) const { return Points[Index].Density; }
+    int32 GetSeed(int32 Index) const { return Points[Index].Seed; }
+    const FVector& GetBoundsMin(int32 Index) const { return Points[Index].BoundsMin; }
+    const FVector& GetBoundsMax(int32 Index) const { return Points[Index].BoundsMax; }
+    const FVector4& GetColor(int32 Index) const { return Points[Index].Color; }
+    float GetSteepness(int32 Index) const { return Points[Index].Steepness; }
+    int64 GetMetadataEntry(int32 Index) const { return Points[Index].MetadataEntry; }
+
+    const TArray<FPCGPoint>& Points;
+};
+
+static int32 GetOutputPointCount(const UPCGPointData* PointData)
+{
+    return PointData->GetPoints().Num();
+}
+#endif
+
+// Helpers to append an attribute value as float components
+static void AppendFloats(TArray<float>& Out, float Value) { Out.Add(Value); }
+static void AppendFloats(TArray<float>& Out, double Value) { Out.Add(static_cast<float>(Value)); }
+static void AppendFloats(TArray<float>& Out, int32 Value) { Out.Add(static_cast<float>(Value)); }
+static void AppendFloats(TArray<float>& Out, int64 Value) { Out.Add(static_cast<float>(Value)); }
+static void AppendFloats(TArray<float>& Out, bool Value) { Out.Add(Value ? 1.0f : 0.0f); }
+static void AppendFloats(TArray<float>& Out, const FVector2D& Value) { Out.Append({ float(Value.X), float(Value.Y) }); }
+static void AppendFloats(TArray<float>& Out, const FVector& Value) { Out.Append({ float(Value.X), float(Value.Y), float(Value.Z) }); }
+static void AppendFloats(TArray<float>& Out, const FVector4& Value) { Out.Append({ float(Value.X), float(Value.Y), float(Value.Z), float(Value.W) }); }
+static void AppendFloats(TArray<float>& Out, const FQuat& Value) { Out.Append({ float(Value.X), float(Value.Y), float(Value.Z), float(Value.W) }); }
+static void AppendFloats(TArray<float>& Out, const FRotator& Value) { Out.Append({ float(Value.Pitch), float(Value.Yaw), float(Value.Roll) }); }
+
+// Helper to get the float component count of a metadata type, or 0 if it cannot be exported numerically
+static int32 GetAttributeComponentCount(EPCGMetadataTypes Type)
+{
+    switch (Type)
+    {
+    case EPCGMetadataTypes::Float:
+    case EPCGMetadataTypes::Double:
+    case EPCGMetadataTypes::Integer32:
+    case EPCGMetadataTypes::Integer64:
+    case EPCGMetadataTypes::Boolean:
+        return 1;
+    case EPCGMetadataTypes::Vector2:
+        return 2;
+    case EPCGMetadataTypes::Vector:
+    case EPCGMetadataTypes::Rotator:
+        return 3;
+    case EPCGMetadataTypes::Vector4:
+    case EPCGMetadataTypes::Quaternion:
+        return 4;
+    default:
+        return 0;
+    }
+}
+
+template <typename T>
+static void AppendAttributeValues(const FPCGMetadataAttributeBase* Attribute, const FPCGOutputPointReader& Reader, int32 Count, TArray<float>& Out)
+{
+    const FPCGMetadataAttribute<T>* TypedAttribute = static_cast<const FPCGMetadataAttribute<T>*>(Attribute);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        AppendFloats(Out, TypedAttribute->GetValueFromItemKey(Reader.GetMetadataEntry(Index)));
+    }
+}
+
+// Helper to append one attribute column for a point data; returns false if the attribute is missing or not numeric
+static bool AppendAttributeColumn(const FMCPOutputPointData* PointData, const FPCGOutputPointReader& Reader, int32 Count, FPCGOutputColumn& Column)
+{
+    const UPCGMetadata* Metadata = PointData->ConstMetadata();
+    const FPCGMetadataAttributeBase* Attribute = Metadata ? Metadata->GetConstAttribute(Column.AttributeName) : nullptr;
+    if (!Attribute)
+    {
+        return false;
+    }
+
+    const EPCGMetadataTypes Type = static_cast<EPCGMetadataTypes>(Attribute->GetTypeId());
+    if (GetAttributeComponentCount(Type) != Column.Components)
+    {
+        return false;
+    }
+
+    switch (Type)
+    {
+    case EPCGMetadataTypes::Float: AppendAttributeValues<float>(Attribute, Reader, Count, Column.Floats); return true;
+    case EPCGMetadataTypes::Double: AppendAttributeValues<double>(Attribute, Reader, Count, Column.Floats); return true;
+    case EPCGMetadataTypes::Integer32: AppendAttributeValues<int32>(Attribute, Reader, Count, Column.Floats); return true;
+    case EPCGMetadataTypes::Integer64: AppendAttributeValues<int64>(Attribute, Reader, Count, Column.Floats); return true;
+    case EPCGMetadataTypes::Boolean: AppendAttributeValues<bool>(Attribute, Reader, Count, Column.Floats); return true;
+    case EPCGMetadataTypes::Vector2: AppendAttributeValues<FVector2D>(Attribute, Reader, Count, Column.Floats); return true;
+    case EPCGMetadataTypes::Vector: AppendAttributeValues<FVector>(Attribute, Reader, Count, Column.Floats); return true;
+    case EPCGMetadataTypes::Rotator: AppendAttributeValues<FRotator>(Attribute, Reader, Count, Column.Floats); return true;
+    case EPCGMetadataTypes::Vector4: AppendAttributeValues<FVector4>(Attribute, Reader, Count, Column.Floats); return true;
+    case EPCGMetadataTypes::Quaternion: AppendAttributeValues<FQuat>(Attribute, Reader, Count, Column.Floats); return true;
+    default: return false;
+    }
+}
+
+// Helper to append the first Count points of a point data to every column
+static void AppendPointColumns(const FMCPOutputPointData* PointData, int32 Count, TArray<FPCGOutputColumn>& Columns, TArray<FString>& OutMissingAttributes)
+{
+    const FPCGOutputPointReader Reader(PointData);
+
+    for (FPCGOutputColumn& Column : Columns)
+    {
+        if (Column.BuiltinIndex == INDEX_NONE)
+        {
+            if (!AppendAttributeColumn(PointData, Reader, Count, Column))
+            {
+                // Keep columns aligned: points without the attribute read as NaN
+                Column.Floats.AddUninitialized(Count * Column.Components);
+                float* Fill = Column.Floats.GetData() + Column.Floats.Num() - Count * Column.Components;
+                for (int32 Index = 0; Index < Count * Column.Components; ++Index)
+                {
+                    Fill[Index] = std::numeric_limits<float>::quiet_NaN();
+                }
+                OutMissingAttributes.Add(Column.Name);
+            }
+            continue;
+        }
+
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            switch (static_cast<EPCGOutputBuiltinColumn>(Column.BuiltinIndex))
+            {
+            case EPCGOutputBuiltinColumn::Position: AppendFloats(Column.Floats, Reader.GetTransform(Index).GetLocation()); break;
+            case EPCGOutputBuiltinColumn::Rotation: AppendFloats(Column.Floats, Reader.GetTransform(Index).GetRotation()); break;
+            case EPCGOutputBuiltinColumn::Scale: AppendFloats(Column.Floats, Reader.GetTransform(Index).GetScale3D()); break;
+            case EPCGOutputBuiltinColumn::Density: AppendFloats(Column.Floats, Reader.GetDensity(Index)); break;
+            case EPCGOutputBuiltinColumn::Seed: Column.Ints.Add(Reader.GetSeed(Index)); break;
+            case EPCGOutputBuiltinColumn::BoundsMin: AppendFloats(Column.Floats, Reader.GetBoundsMin(Index)); break;
+            case EPCGOutputBuiltinColumn::BoundsMax: AppendFloats(Column.Floats, Reader.GetBoundsMax(Index)); break;
+            case EPCGOutputBuiltinColumn::Color: AppendFloats(Column.Floats, Reader.GetColor(Index)); break;
+            case EPCGOutputBuiltinColumn::Steepness: AppendFloats(Column.Floats, Reader.GetSteepness(Index)); break;
+            }
+        }
+    }
+}
+
+// Helper to find the component count of an attribute on the first output data that has it
+static int32 FindAttributeComponentCount(const FPCGDataCollection& Collection, FName AttributeName)
+{
+    for (const FPCGTaggedData& Tagged : Collection.TaggedData)
+    {
+        const FMCPOutputPointData* PointData = Cast<FMCPOutputPointData>(Tagged.Data);
+        const UPCGMetadata* Metadata = PointData ? PointData->ConstMetadata() : nullptr;
+        if (const FPCGMetadataAttributeBase* Attribute = Metadata ? Metadata->GetConstAttribute(AttributeName) : nullptr)
+        {
+            return GetAttributeComponentCount(static_cast<EPCGMetadataTypes>(Attribute->GetTypeId()));
+        }
+    }
+    return INDEX_NONE;
+}
+
+TSharedPtr<FJsonObject> FPCGOutputExporter::GetPCGOutput(const TSharedPtr<FJsonObject>& Params)
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    FString ActorName;
+    if (!Params->TryGetStringField(TEXT("actor_name"), ActorName))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
+    }
+
+    FString OutputMode = TEXT("auto");
+    Params->TryGetStringField(TEXT("output"), OutputMode);
+    OutputMode = OutputMode.ToLower();
+    if (OutputMode != TEXT("auto") && OutputMode != TEXT("base64") && OutputMode != TEXT("file"))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Invalid output '%s'. Use 'auto', 'base64' or 'file'"), *OutputMode));
+    }
+
+    FString PinFilter;
+    Params->TryGetStringField(TEXT("pin"), PinFilter);
+
+    int32 MaxPoints = 0;
+    Params->TryGetNumberField(TEXT("max_points"), MaxPoints);
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No editor world available"));
+    }
+
+    AActor* FoundActor = nullptr;
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        if (It->GetActorLabel() == ActorName || It->GetName() == ActorName)
+        {
+            FoundActor = *It;
+            break;
+        }
+    }
+
+    if (!FoundActor)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Actor '%s' not found in the level"), *ActorName));
+    }
+
+    UPCGComponent* PCGComp = FoundActor->FindComponentByClass<UPCGComponent>();
+    if (!PCGComp)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Actor '%s' has no PCGComponent"), *ActorName));
+    }
+
+    if (PCGComp->IsGenerating())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("PCG on '%s' is still generating; wait for the generation job to finish"), *ActorName));
+    }
+
+    const FPCGDataCollection& Collection = PCGComp->GetGeneratedGraphOutput();
+
+    // Resolve the requested columns
+    TArray<FPCGOutputColumn> Columns;
+    const TArray<TSharedPtr<FJsonValue>>* ColumnsArray = nullptr;
+    TArray<FString> ColumnNames;
+    if (Params->TryGetArrayField(TEXT("columns"), ColumnsArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *ColumnsArray)
+        {
+            ColumnNames.AddUnique(Value->AsString().ToLower());
+        }
+    }
+    else
+    {
+        ColumnNames = { TEXT("position"), TEXT("rotation"), TEXT("scale"), TEXT("density"), TEXT("seed") };
+    }
+
+    for (int32 BuiltinIndex = 0; BuiltinIndex < UE_ARRAY_COUNT(PCGOutputBuiltinColumns); ++BuiltinIndex)
+    {
+        const FPCGOutputColumnDef& Def = PCGOutputBuiltinColumns[BuiltinIndex];
+        if (ColumnNames.Remove(Def.Name) > 0)
+        {
+            FPCGOutputColumn& Column = Columns.AddDefaulted_GetRef();
+            Column.Name = Def.Name;
+            Column.Components = Def.Components;
+            Column.bInt32 = Def.bInt32;
+            Column.BuiltinIndex = BuiltinIndex;
+        }
+    }
+
+    if (ColumnNames.Num() > 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(FString::Printf(
+            TEXT("Unknown columns: %s. Use position, rotation, scale, density, seed, bounds_min, bounds_max, color, steepness, "
+                 "or list metadata attributes under 'attributes'"), *FString::Join(ColumnNames, TEXT(", "))));
+    }
+
+    TArray<FString> SkippedAttributes;
+    const TArray<TSharedPtr<FJsonValue>>* AttributesArray = nullptr;
+    if (Params->TryGetArrayField(TEXT("attributes"), AttributesArray))
+    {
+        for (const TSharedPtr<FJsonValue>& Value : *AttributesArray)
+        {
+            const FString AttributeName = Value->AsString();
+            const int32 Components = FindAttributeComponentCount(Collection, FName(*AttributeName));
+            if (Components <= 0)
+            {
+                // Not present on any output, or a string / name / soft path attribute
+                SkippedAttributes.Add(AttributeName);
+                continue;
+            }
+
+            FPCGOutputColumn& Column = Columns.AddDefaulted_GetRef();
+            Column.Name = AttributeName;
+            Column.Components = Components;
+            Column.AttributeName = FName(*AttributeName);
+        }
+    }
+
+    if (Columns.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No columns to export"));
+    }
+
+    // Gather the point data to export and reserve each column once
+    TArray<TPair<const FPCGTaggedData*, int32>> Sources;
+    int32 TotalPoints = 0;
+    for (const FPCGTaggedData& Tagged : Collection.TaggedData)
+    {
+        if (!PinFilter.IsEmpty() && !Tagged.Pin.ToString().Equals(PinFilter, ESearchCase::IgnoreCase))
+        {
+            continue;
+        }
+
+        const FMCPOutputPointData* PointData = Cast<FMCPOutputPointData>(Tagged.Data);
+        if (!PointData)
+        {
+            continue;
+        }
+
+        int32 Count = GetOutputPointCount(PointData);
+        if (MaxPoints > 0)
+        {
+            Count = FMath::Min(Count, MaxPoints - TotalPoints);
+        }
+        if (Count <= 0)
+        {
+            continue;
+        }
+
+        Sources.Emplace(&Tagged, Count);
+        TotalPoints += Count;
+    }
+
+    for (FPCGOutputColumn& Column : Columns)
+    {
+        if (Column.bInt32)
+        {
+            Column.Ints.Reserve(TotalPoints * Column.Components);
+        }
+        else
+        {
+            Column.Floats.Reserve(TotalPoints * Column.Components);
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> SegmentsArray;
+    int32 PointOffset = 0;
+    for (const TPair<const FPCGTaggedData*, int32>& Source : Sources)
+    {
+        const FPCGTaggedData& Tagged = *Source.Key;
+        TArray<FString> MissingAttributes;
+        AppendPointColumns(Cast<FMCPOutputPointData>(Tagged.Data), Source.Value, Columns, MissingAttributes);
+
+        TSharedPtr<FJsonObject> SegmentObj = MakeShareable(new FJsonObject);
+        SegmentObj->SetStringField(TEXT("pin"), Tagged.Pin.ToString());
+        SegmentObj->SetNumberField(TEXT("point_offset"), PointOffset);
+        SegmentObj->SetNumberField(TEXT("point_count"), Source.Value);
+        TArray<TSharedPtr<FJsonValue>> TagsArray;
+        for (const FString& Tag : Tagged.Tags)
+        {
+            TagsArray.Add(MakeShareable(new FJsonValueString(Tag)));
+        }
+        SegmentObj->SetArrayField(TEXT("tags"), TagsArray);
+        if (MissingAttributes.Num() > 0)
+        {
+            TArray<TSharedPtr<FJsonValue>> MissingArray;
+            for (const FString& Missing : MissingAttributes)
+            {
+                MissingArray.Add(MakeShareable(new FJsonValueString(Missing)));
+            }
+            SegmentObj->SetArrayField(TEXT("missing_attributes"), MissingArray);
+        }
+        SegmentsArray.Add(MakeShareable(new FJsonValueObject(SegmentObj)));
+
+        PointOffset += Source.Value;
+    }
+
+    // Lay the columns out back to back: [column 0 values][column 1 values]...
+    TArray<uint8> Blob;
+    TArray<TSharedPtr<FJsonValue>> ColumnsInfo;
+    for (const FPCGOutputColumn& Column : Columns)
+    {
+        const uint8* Data = Column.bInt32
+            ? reinterpret_cast<const uint8*>(Column.Ints.GetData())
+            : reinterpret_cast<const uint8*>(Column.Floats.GetData());
+        const int32 ByteLength = (Column.bInt32 ? Column.Ints.Num() : Column.Floats.Num()) * 4;
+
+        TSharedPtr<FJsonObject> ColumnObj = MakeShareable(new FJsonObject);
+        ColumnObj->SetStringField(TEXT("name"), Column.Name);
+        ColumnObj->SetStringField(TEXT("source"), Column.BuiltinIndex == INDEX_NONE ? TEXT("attribute") : TEXT("point"));
+        ColumnObj->SetStringField(TEXT("dtype"), Column.bInt32 ? TEXT("int32") : TEXT("float32"));
+        ColumnObj->SetNumberField(TEXT("components"), Column.Components);
+        ColumnObj->SetNumberField(TEXT("offset"), Blob.Num());
+        ColumnObj->SetNumberField(TEXT("byte_length"), ByteLength);
+        ColumnsInfo.Add(MakeShareable(new FJsonValueObject(ColumnObj)));
+
+        Blob.Append(Data, ByteLength);
+    }
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("actor_name"), ActorName);
+    Result->SetNumberField(TEXT("point_count"), TotalPoints);
+    Result->SetStringField(TEXT("layout"), TEXT("columnar"));
+    Result->SetStringField(TEXT("byte_order"), TEXT("little"));
+    Result->SetNumberField(TEXT("byte_length"), Blob.Num());
+    Result->SetArrayField(TEXT("columns"), ColumnsInfo);
+    Result->SetArrayField(TEXT("segments"), SegmentsArray);
+    if (SkippedAttributes.Num() > 0)
+    {
+        TArray<TSharedPtr<FJsonValue>> SkippedArray;
+        for (const FString& Skipped : SkippedAttributes)
+        {
+            SkippedArray.Add(MakeShareable(new FJsonValueString(Skipped)));
+        }
+        Result->SetArrayField(TEXT("skipped_attributes"), SkippedArray);
+    }
+
+    const bool bWriteFile = OutputMode == TEXT("file") || (OutputMode == TEXT("auto") && Blob.Num() > MaxInlinePCGOutputBytes);
+    if (bWriteFile)
+    {
+        const FString BaseName = FString::Printf(TEXT("%s_%s"),
+            *FPaths::MakeValidFileName(ActorName, TEXT('_')), *FDateTime::Now().ToString(TEXT("%Y%m%d_%H%M%S")));
+        const FString FilePath = FPaths::ConvertRelativePathToFull(
+            FPaths::ProjectSavedDir() / TEXT("MCP") / TEXT("PCGOutput") / (BaseName + TEXT(".bin")));
+
+        if (!FFileHelper::SaveArrayToFile(Blob, *FilePath))
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Failed to write PCG output to '%s'"), *FilePath));
+        }
+
+        // Sidecar with the column layout, so the file can be read without this response
+        FString HeaderText;
+        TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&HeaderText);
+        FJsonSerializer::Serialize(Result.ToSharedRef(), Writer);
+        FFileHelper::SaveStringToFile(HeaderText, *FPaths::ChangeExtension(FilePath, TEXT("json")));
+
+        Result->SetStringField(TEXT("file_path"), FilePath);
+    }
+    else
+    {
+        Result->SetStringField(TEXT("data_base64"), FBase64::Encode(Blob));
+    }
+
+    const double ExportTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    Result->SetNumberField(TEXT("export_time_ms"), ExportTimeMs);
+
+    UE_LOG(LogTemp, Display, TEXT("FPCGOutputExporter::GetPCGOutput: %d points, %d columns, %d bytes from '%s' in %.1f ms"),
+        TotalPoints, Columns.Num(), Blob.Num(), *ActorName, ExportTimeMs);
+
+    return Result;
+}
@@ -1,5 +1,6 @@
 #include "Commands/PCGGraph/PCGParameterManager.h"
 #include "Commands/PCGGraph/PCGGraphCreator.h"
+#include "Commands/PCGGraph/PCGGenerationTracker.h"
 #include "Commands/EpicUnrealMCPCommonUtils.h"
 #include "PCGGraph.h"
 #include "PCGComponent.h"
@@ -327,6 +328,13 @@ TSharedPtr<FJsonObject> FPCGParameterManager::AssignPCGGraph(const TSharedPtr<FJ
             FString::Printf(TEXT("Could not find PCG graph at '%s'"), *GraphPath));
     }
 
+    EPCGGenerationRequestMode Mode;
+    FString ModeError;
+    if (!FPCGGenerationTracker::ParseMode(Params, Mode, ModeError))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(ModeError);
+    }
+
     // Try actor_name first
     FString ActorName;
     if (Params->TryGetStringField(TEXT("actor_name"), ActorName))
@@ -362,13 +370,13 @@ TSharedPtr<FJsonObject> FPCGParameterManager::AssignPCGGraph(const TSharedPtr<FJ
         }
 
         PCGComp->SetGraph(Graph);
-        PCGComp->CleanupLocal(/*bRemoveComponents=*/true, /*bSave=*/false);
-        PCGComp->Generate(/*bForce=*/true);
+        const FString JobId = FPCGGenerationTracker::StartGeneration(PCGComp, ActorName, Mode);
 
         TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
         Result->SetBoolField(TEXT("success"), true);
         Result->SetStringField(TEXT("graph_path"), GraphPath);
         Result->SetStringField(TEXT("assigned_to_actor"), ActorName);
+        Result->SetStringField(TEXT("job_id"), JobId);
         return Result;
     }
 
@@ -444,6 +452,13 @@ TSharedPtr<FJsonObject> FPCGParameterManager::GeneratePCG(const TSharedPtr<FJson
         return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'actor_name' parameter"));
     }
 
+    EPCGGenerationRequestMode Mode;
+    FString ModeError;
+    if (!FPCGGenerationTracker::ParseMode(Params, Mode, ModeError))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(ModeError);
+    }
+
     UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
     if (!World)
     {
@@ -473,12 +488,198 @@ TSharedPtr<FJsonObject> FPCGParameterManager::GeneratePCG(const TSharedPtr<FJson
             FString::Printf(TEXT("Actor '%s' has no PCGComponent"), *ActorName));
     }
 
-    PCGComp->CleanupLocal(/*bRemoveComponents=*/true, /*bSave=*/false);
-    PCGComp->Generate(/*bForce=*/true);
+    // Optional checks for callers that edit the graph asset and expect this component to pick the edits up:
+    // the component must run that graph and must not override the parameters being edited
+    UPCGGraph* ComponentGraph = PCGComp->GetGraph();
+    FString ExpectedGraphPath;
+    if (Params->TryGetStringField(TEXT("graph_path"), ExpectedGraphPath))
+    {
+        UPCGGraph* ExpectedGraph = FPCGGraphCreator::LoadPCGGraph(ExpectedGraphPath);
+        if (!ExpectedGraph || ComponentGraph != ExpectedGraph)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Actor '%s' runs graph '%s', not '%s'"), *ActorName,
+                    ComponentGraph ? *ComponentGraph->GetPathName() : TEXT("none"), *ExpectedGraphPath));
+        }
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* RequiredDefaults = nullptr;
+    if (Params->TryGetArrayField(TEXT("require_defaults"), RequiredDefaults))
+    {
+        const UPCGGraphInstance* GraphInstance = PCGComp->GetGraphInstance();
+        const FInstancedPropertyBag* GraphParams = ComponentGraph ? ComponentGraph->GetUserParametersStruct() : nullptr;
+        const UPropertyBag* BagStruct = GraphParams ? GraphParams->GetPropertyBagStruct() : nullptr;
+
+        TArray<FString> Overridden;
+        for (const TSharedPtr<FJsonValue>& NameValue : *RequiredDefaults)
+        {
+            const FString ParamName = NameValue->AsString();
+            const FPropertyBagPropertyDesc* Desc = BagStruct ? BagStruct->FindPropertyDescByName(FName(*ParamName)) : nullptr;
+            if (Desc && GraphInstance && GraphInstance->IsPropertyOverridden(Desc->CachedProperty))
+            {
+                Overridden.Add(ParamName);
+            }
+        }
+
+        if (Overridden.Num() > 0)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+                FString::Printf(TEXT("Actor '%s' overrides graph parameter(s) %s, so graph default changes would not reach it"),
+                    *ActorName, *FString::Join(Overridden, TEXT(", "))));
+        }
+    }
+
+    bool bValidateOnly = false;
+    Params->TryGetBoolField(TEXT("validate_only"), bValidateOnly);
+    if (bValidateOnly)
+    {
+        TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+        Result->SetBoolField(TEXT("success"), true);
+        Result->SetStringField(TEXT("actor_name"), ActorName);
+        Result->SetStringField(TEXT("graph_path"), ComponentGraph ? ComponentGraph->GetPathName() : FString());
+        Result->SetNumberField(TEXT("seed"), PCGComp->Seed);
+        return Result;
+    }
+
+    // Optional seed override, so seed variations can be generated without editing the actor by hand
+    const int32 PreviousSeed = PCGComp->Seed;
+    int32 Seed = PreviousSeed;
+    if (Params->TryGetNumberField(TEXT("seed"), Seed) && Seed != PreviousSeed)
+    {
+        PCGComp->Modify();
+        PCGComp->Seed = Seed;
+    }
+
+    // Generation runs over later editor ticks; callers poll get_pcg_job_status with the job id
+    const FString JobId = FPCGGenerationTracker::StartGeneration(PCGComp, ActorName, Mode);
 
     TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
     Result->SetBoolField(TEXT("success"), true);
     Result->SetStringField(TEXT("actor_name"), ActorName);
+    Result->SetStringField(TEXT("job_id"), JobId);
+    Result->SetNumberField(TEXT("seed"), PCGComp->Seed);
+    if (PCGComp->Seed != PreviousSeed)
+    {
+        Result->SetNumberField(TEXT("previous_seed"), PreviousSeed);
+    }
     Result->SetStringField(TEXT("message"), TEXT("PCG generation triggered"));
     return Result;
 }
+
+TSharedPtr<FJsonObject> FPCGParameterManager::GeneratePCGAll(const TSharedPtr<FJsonObject>& Params)
+{
+    EPCGGenerationRequestMode Mode;
+    FString ModeError;
+    if (!FPCGGenerationTracker::ParseMode(Params, Mode, ModeError))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(ModeError);
+    }
+
+    FString ActorFilter;
+    Params->TryGetStringField(TEXT("actor_filter"), ActorFilter);
+    const bool bActorWildcard = ActorFilter.Contains(TEXT("*")) || ActorFilter.Contains(TEXT("?"));
+
+    FString GraphFilter;
+    Params->TryGetStringField(TEXT("graph_filter"), GraphFilter);
+
+    const bool bUseBounds = Params->HasField(TEXT("bounds_min")) && Params->HasField(TEXT("bounds_max"));
+    FBox FilterBounds(ForceInit);
+    if (bUseBounds)
+    {
+        FilterBounds = FBox(
+            FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("bounds_min")),
+            FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("bounds_max")));
+    }
+
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No editor world available"));
+    }
+
+    // Collect every matching component first, then schedule them back to back so the PCG
+    // scheduler sees the whole set at once and can overlap their work on worker threads
+    TArray<TPair<UPCGComponent*, FString>> Targets;
+    int32 LocalComponentsSkipped = 0;
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        AActor* Actor = *It;
+        const FString Label = Actor->GetActorLabel();
+
+        if (!ActorFilter.IsEmpty())
+        {
+            const bool bMatches = bActorWildcard
+                ? (Label.MatchesWildcard(ActorFilter) || Actor->GetName().MatchesWildcard(ActorFilter))
+                : (Label.Contains(ActorFilter) || Actor->GetName().Contains(ActorFilter));
+            if (!bMatches)
+            {
+                continue;
+            }
+        }
+
+        TInlineComponentArray<UPCGComponent*> PCGComponents(Actor);
+        if (PCGComponents.Num() == 0)
+        {
+            continue;
+        }
+
+        if (bUseBounds && !Actor->GetComponentsBoundingBox(/*bNonColliding=*/true).Intersect(FilterBounds))
+        {
+            continue;
+        }
+
+        for (UPCGComponent* PCGComp : PCGComponents)
+        {
+            UPCGGraph* Graph = PCGComp ? PCGComp->GetGraph() : nullptr;
+            if (!Graph)
+            {
+                continue;
+            }
+            if (!GraphFilter.IsEmpty() && !Graph->GetPathName().Contains(GraphFilter))
+            {
+                continue;
+            }
+            // Partition-local components are generated by their partitioned original; generating
+            // them directly as well would run the same cells twice
+            if (PCGComp->IsLocalComponent())
+            {
+                ++LocalComponentsSkipped;
+                continue;
+            }
+            Targets.Emplace(PCGComp, Label);
+        }
+    }
+
+    if (Targets.Num() == 0)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No PCG components matched the given filters"));
+    }
+
+    TArray<FString> JobIds;
+    TArray<TSharedPtr<FJsonValue>> JobsArray;
+    JobIds.Reserve(Targets.Num());
+    for (const TPair<UPCGComponent*, FString>& Target : Targets)
+    {
+        const FString JobId = FPCGGenerationTracker::StartGeneration(Target.Key, Target.Value, Mode);
+        JobIds.Add(JobId);
+
+        TSharedPtr<FJsonObject> JobObj = MakeShareable(new FJsonObject);
+        JobObj->SetStringField(TEXT("job_id"), JobId);
+        JobObj->SetStringField(TEXT("actor_name"), Target.Value);
+        JobObj->SetStringField(TEXT("graph_path"), Target.Key->GetGraph()->GetPathName());
+        JobsArray.Add(MakeShareable(new FJsonValueObject(JobObj)));
+    }
+
+    const FString BatchId = FPCGGenerationTracker::RegisterBatch(JobIds);
+
+    UE_LOG(LogTemp, Display, TEXT("FPCGParameterManager::GeneratePCGAll: Scheduled %d PCG components (batch %s)"),
+        Targets.Num(), *BatchId);
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("batch_id"), BatchId);
+    Result->SetNumberField(TEXT("component_count"), Targets.Num());
+    Result->SetNumberField(TEXT("local_components_skipped"), LocalComponentsSkipped);
+    Result->SetArrayField(TEXT("jobs"), JobsArray);
+    return Result;
+}
@@ -0,0 +1,450 @@
+#include "Commands/Screenshot/MultiViewCapture.h"
+#include "Commands/Screenshot/ScreenshotCapture.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "Engine/Selection.h"
+#include "Engine/World.h"
+#include "TextureResource.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
+#include "EngineUtils.h"
+#include "Editor.h"
+#include "Async/ParallelFor.h"
+#include "Misc/Paths.h"
+
+// Limits that keep a single request from allocating unbounded render targets
+static constexpr int32 MaxCaptureViews = 32;
+static constexpr int32 MinViewResolution = 64;
+static constexpr int32 MaxViewResolution = 2048;
+
+// Framing margin around the target bounds
+static constexpr float ViewFramingMargin = 1.1f;
+
+struct FCaptureViewSpec
+{
+    FString Name;
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+    float FOV = 60.0f;
+    bool bOrthographic = false;
+    float OrthoWidth = 0.0f;
+};
+
+// ============================================================================
+// Helper: Resolve the box to frame
+// ============================================================================
+static bool ResolveCaptureBounds(UWorld* World, const TSharedPtr<FJsonObject>& Params, FBox& OutBounds, TArray<FString>& OutMissing, FString& OutError)
+{
+    OutBounds = FBox(ForceInit);
+
+    if (Params->HasField(TEXT("center")) && Params->HasField(TEXT("extent")))
+    {
+        const FVector Center = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("center"));
+        const FVector Extent = FEpicUnrealMCPCommonUtils::GetVectorFromJson(Params, TEXT("extent"));
+        OutBounds = FBox(Center - Extent, Center + Extent);
+        return true;
+    }
+
+    TArray<AActor*> Actors;
+    TArray<FString> ActorNames;
+    Params->TryGetStringArrayField(TEXT("actor_names"), ActorNames);
+
+    if (ActorNames.Num() > 0)
+    {
+        TSet<FString> Wanted(ActorNames);
+        TSet<FString> Found;
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            if (Wanted.Contains(It->GetActorLabel()) || Wanted.Contains(It->GetName()))
+            {
+                Actors.Add(*It);
+                Found.Add(It->GetActorLabel());
+                Found.Add(It->GetName());
+            }
+        }
+        for (const FString& Name : ActorNames)
+        {
+            if (!Found.Contains(Name))
+            {
+                OutMissing.Add(Name);
+            }
+        }
+    }
+    else if (GEditor)
+    {
+        GEditor->GetSelectedActors()->GetSelectedObjects<AActor>(Actors);
+    }
+
+    for (AActor* Actor : Actors)
+    {
+        const FBox ActorBounds = Actor->GetComponentsBoundingBox(true);
+        if (ActorBounds.IsValid)
+        {
+            OutBounds += ActorBounds;
+        }
+    }
+
+    if (!OutBounds.IsValid)
+    {
+        OutError = ActorNames.Num() > 0
+            ? TEXT("None of the actors were found or they have no bounds")
+            : TEXT("Pass actor_names or center/extent, or select actors in the editor");
+        return false;
+    }
+    return true;
+}
+
+// ============================================================================
+// Helper: Build the list of cameras
+// ============================================================================
+static bool BuildCaptureViews(const TSharedPtr<FJsonObject>& Params, const FBox& Bounds, TArray<FCaptureViewSpec>& OutViews, FString& OutError)
+{
+    const FVector Center = Bounds.GetCenter();
+    const FVector Extent = Bounds.GetExtent();
+    const float Radius = FMath::Max(Extent.Size(), 1.0f);
+
+    double FOV = 60.0;
+    Params->TryGetNumberField(TEXT("fov"), FOV);
+    FOV = FMath::Clamp(FOV, 5.0, 170.0);
+
+    // Distance at which the bounding sphere fills the view
+    const float OrbitDistance = Radius * ViewFramingMargin / FMath::Sin(FMath::DegreesToRadians(FOV * 0.5));
+
+    int32 OrbitCount = 4;
+    Params->TryGetNumberField(TEXT("orbit_count"), OrbitCount);
+    OrbitCount = FMath::Max(OrbitCount, 0);
+    double OrbitPitch = -30.0;
+    Params->TryGetNumberField(TEXT("orbit_pitch"), OrbitPitch);
+    double OrbitYaw = 45.0;
+    Params->TryGetNumberField(TEXT("orbit_yaw"), OrbitYaw);
+
+    for (int32 Index = 0; Index < OrbitCount; ++Index)
+    {
+        FCaptureViewSpec& View = OutViews.AddDefaulted_GetRef();
+        View.Name = FString::Printf(TEXT("orbit_%d"), Index);
+        View.Rotation = FRotator(OrbitPitch, OrbitYaw + Index * 360.0 / OrbitCount, 0.0);
+        View.Location = Center - View.Rotation.Vector() * OrbitDistance;
+        View.FOV = FOV;
+    }
+
+    bool bIncludeTop = true;
+    Params->TryGetBoolField(TEXT("include_top"), bIncludeTop);
+    if (bIncludeTop)
+    {
+        FCaptureViewSpec& View = OutViews.AddDefaulted_GetRef();
+        View.Name = TEXT("top");
+        View.Rotation = FRotator(-90.0, 0.0, 0.0);
+        View.Location = Center + FVector(0.0, 0.0, Extent.Z + Radius);
+        View.bOrthographic = true;
+        View.OrthoWidth = 2.0f * FMath::Max(Extent.X, Extent.Y) * ViewFramingMargin;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* CustomViews = nullptr;
+    if (Params->TryGetArrayField(TEXT("views"), CustomViews))
+    {
+        for (int32 Index = 0; Index < CustomViews->Num(); ++Index)
+        {
+            const TSharedPtr<FJsonObject>* ViewObject = nullptr;
+            if (!(*CustomViews)[Index]->TryGetObject(ViewObject))
+            {
+                OutError = FString::Printf(TEXT("views[%d] must be an object"), Index);
+                return false;
+            }
+
+            FCaptureViewSpec& View = OutViews.AddDefaulted_GetRef();
+            View.Name = FString::Printf(TEXT("custom_%d"), Index);
+            (*ViewObject)->TryGetStringField(TEXT("name"), View.Name);
+            View.Location = FEpicUnrealMCPCommonUtils::GetVectorFromJson(*ViewObject, TEXT("location"));
+
+            if ((*ViewObject)->HasField(TEXT("look_at")))
+            {
+                const FVector LookAt = FEpicUnrealMCPCommonUtils::GetVectorFromJson(*ViewObject, TEXT("look_at"));
+                View.Rotation = (LookAt - View.Location).Rotation();
+            }
+            else if ((*ViewObject)->HasField(TEXT("rotation")))
+            {
+                View.Rotation = FEpicUnrealMCPCommonUtils::GetRotatorFromJson(*ViewObject, TEXT("rotation"));
+            }
+            else
+            {
+                View.Rotation = (Center - View.Location).Rotation();
+            }
+
+            double ViewFOV = FOV;
+            (*ViewObject)->TryGetNumberField(TEXT("fov"), ViewFOV);
+            View.FOV = FMath::Clamp(ViewFOV, 5.0, 170.0);
+
+            (*ViewObject)->TryGetBoolField(TEXT("orthographic"), View.bOrthographic);
+            double OrthoWidth = 2.0 * FMath::Max(Extent.X, Extent.Y) * ViewFramingMargin;
+            (*ViewObject)->TryGetNumberField(TEXT("ortho_width"), OrthoWidth);
+            View.OrthoWidth = OrthoWidth;
+        }
+    }
+
+    if (OutViews.Num() == 0)
+    {
+        OutError = TEXT("No views requested");
+        return false;
+    }
+    if (OutViews.Num() > MaxCaptureViews)
+    {
+        OutError = FString::Printf(TEXT("Too many views (%d, max %d)"), OutViews.Num(), MaxCaptureViews);
+        return false;
+    }
+    return true;
+}
+
+static TSharedPtr<FJsonObject> CaptureViewToJson(const FCaptureViewSpec& View)
+{
+    TSharedPtr<FJsonObject> ViewJson = MakeShareable(new FJsonObject);
+    ViewJson->SetStringField(TEXT("name"), View.Name);
+
+    TArray<TSharedPtr<FJsonValue>> Location;
+    Location.Add(MakeShareable(new FJsonValueNumber(View.Location.X)));
+    Location.Add(MakeShareable(new FJsonValueNumber(View.Location.Y)));
+    Location.Add(MakeShareable(new FJsonValueNumber(View.Location.Z)));
+    ViewJson->SetArrayField(TEXT("location"), Location);
+
+    TArray<TSharedPtr<FJsonValue>> Rotation;
+    Rotation.Add(MakeShareable(new FJsonValueNumber(View.Rotation.Pitch)));
+    Rotation.Add(MakeShareable(new FJsonValueNumber(View.Rotation.Yaw)));
+    Rotation.Add(MakeShareable(new FJsonValueNumber(View.Rotation.Roll)));
+    ViewJson->SetArrayField(TEXT("rotation"), Rotation);
+
+    ViewJson->SetStringField(TEXT("projection"), View.bOrthographic ? TEXT("orthographic") : TEXT("perspective"));
+    if (View.bOrthographic)
+    {
+        ViewJson->SetNumberField(TEXT("ortho_width"), View.OrthoWidth);
+    }
+    else
+    {
+        ViewJson->SetNumberField(TEXT("fov"), View.FOV);
+    }
+    return ViewJson;
+}
+
+// ============================================================================
+// capture_views
+// ============================================================================
+TSharedPtr<FJsonObject> FMultiViewCapture::CaptureViews(const TSharedPtr<FJsonObject>& Params)
+{
+    UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+    if (!World)
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("No editor world available"));
+    }
+
+    FBox Bounds;
+    TArray<FString> MissingActors;
+    FString Error;
+    if (!ResolveCaptureBounds(World, Params, Bounds, MissingActors, Error))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    TArray<FCaptureViewSpec> Views;
+    if (!BuildCaptureViews(Params, Bounds, Views, Error))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+
+    FScreenshotEncodeOptions EncodeOptions;
+    if (!FScreenshotEncodeOptions::FromJson(Params, EncodeOptions, Error))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Error);
+    }
+    if (!Params->HasField(TEXT("view_key")))
+    {
+        EncodeOptions.ViewKey = TEXT("capture_views");
+    }
+
+    int32 Resolution = 512;
+    Params->TryGetNumberField(TEXT("resolution"), Resolution);
+    Resolution = FMath::Clamp(Resolution, MinViewResolution, MaxViewResolution);
+
+    FString Layout = TEXT("contact_sheet");
+    Params->TryGetStringField(TEXT("layout"), Layout);
+    const bool bContactSheet = Layout != TEXT("array");
+
+    FString Filename;
+    if (!Params->TryGetStringField(TEXT("filename"), Filename) || Filename.IsEmpty())
+    {
+        Filename = FPaths::ProjectSavedDir() / TEXT("Screenshots") / TEXT("MCP_Views");
+    }
+    else if (FPaths::IsRelative(Filename))
+    {
+        Filename = FPaths::ProjectSavedDir() / TEXT("Screenshots") / Filename;
+    }
+    Filename = FPaths::ChangeExtension(Filename, EncodeOptions.GetExtension());
+
+    const double StartTime = FPlatformTime::Seconds();
+
+    // One transient capture component and render target per view, so every capture is queued before any read
+    TArray<USceneCaptureComponent2D*> Captures;
+    TArray<UTextureRenderTarget2D*> RenderTargets;
+    for (const FCaptureViewSpec& View : Views)
+    {
+        UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>(GetTransientPackage());
+        RenderTarget->RenderTargetFormat = RTF_RGBA8;
+        RenderTarget->ClearColor = FLinearColor::Black;
+        RenderTarget->InitAutoFormat(Resolution, Resolution);
+        RenderTarget->UpdateResourceImmediate(true);
+
+        USceneCaptureComponent2D* Capture = NewObject<USceneCaptureComponent2D>(GetTransientPackage());
+        Capture->bCaptureEveryFrame = false;
+        Capture->bCaptureOnMovement = false;
+        Capture->CaptureSource = SCS_FinalColorLDR;
+        Capture->TextureTarget = RenderTarget;
+        Capture->ProjectionType = View.bOrthographic ? ECameraProjectionMode::Orthographic : ECameraProjectionMode::Perspective;
+        Capture->FOVAngle = View.FOV;
+        Capture->OrthoWidth = View.OrthoWidth;
+        // No view history exists for a one-off capture; temporal effects would only smear it
+        Capture->ShowFlags.SetTemporalAA(false);
+        Capture->ShowFlags.SetMotionBlur(false);
+        Capture->SetWorldLocationAndRotation(View.Location, View.Rotation);
+        Capture->RegisterComponentWithWorld(World);
+
+        Capture->CaptureScene();
+
+        Captures.Add(Capture);
+        RenderTargets.Add(RenderTarget);
+    }
+
+    // Queue every read behind the captures and resolve them with one flush
+    TArray<TArray<FColor>> ViewPixels;
+    ViewPixels.SetNum(Views.Num());
+    for (int32 Index = 0; Index < Views.Num(); ++Index)
+    {
+        FTextureRenderTargetResource* Resource = RenderTargets[Index]->GameThread_GetRenderTargetResource();
+        TArray<FColor>* OutPixels = &ViewPixels[Index];
+        ENQUEUE_RENDER_COMMAND(MCPReadCaptureView)(
+            [Resource, OutPixels, Resolution](FRHICommandListImmediate& RHICmdList)
+            {
+                RHICmdList.ReadSurfaceData(Resource->GetRenderTargetTexture(), FIntRect(0, 0, Resolution, Resolution), *OutPixels, FReadSurfaceDataFlags(RCM_UNorm));
+            });
+    }
+    FlushRenderingCommands();
+
+    for (USceneCaptureComponent2D* Capture : Captures)
+    {
+        Capture->TextureTarget = nullptr;
+        Capture->DestroyComponent();
+    }
+    for (UTextureRenderTarget2D* RenderTarget : RenderTargets)
+    {
+        RenderTarget->ReleaseResource();
+        RenderTarget->MarkAsGarbage();
+    }
+
+    const double CaptureEndTime = FPlatformTime::Seconds();
+
+    for (TArray<FColor>& Pixels : ViewPixels)
+    {
+        if (Pixels.Num() != Resolution * Resolution)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Failed to read a capture render target"));
+        }
+        for (FColor& Pixel : Pixels)
+        {
+            Pixel.A = 255;
+        }
+    }
+
+    FScreenshotCapture::LoadEncoder();
+
+    TSharedPtr<FJsonObject> Result = MakeShareable(new FJsonObject);
+    TArray<TSharedPtr<FJsonValue>> ViewsJson;
+
+    if (bContactSheet)
+    {
+        // Near-square grid of views, row-major
+        const int32 Columns = FMath::CeilToInt(FMath::Sqrt(static_cast<float>(Views.Num())));
+        const int32 Rows = FMath::DivideAndRoundUp(Views.Num(), Columns);
+        const FIntPoint SheetSize(Columns * Resolution, Rows * Resolution);
+
+        TArray<FColor> Sheet;
+        Sheet.Init(FColor::Black, SheetSize.X * SheetSize.Y);
+        for (int32 Index = 0; Index < Views.Num(); ++Index)
+        {
+            const int32 CellX = (Index % Columns) * Resolution;
+            const int32 CellY = (Index / Columns) * Resolution;
+            for (int32 Row = 0; Row < Resolution; ++Row)
+            {
+                FMemory::Memcpy(&Sheet[(CellY + Row) * SheetSize.X + CellX], &ViewPixels[Index][Row * Resolution], Resolution * sizeof(FColor));
+            }
+
+            TSharedPtr<FJsonObject> ViewJson = CaptureViewToJson(Views[Index]);
+            ViewJson->SetNumberField(TEXT("cell_x"), Index % Columns);
+            ViewJson->SetNumberField(TEXT("cell_y"), Index / Columns);
+            ViewsJson.Add(MakeShareable(new FJsonValueObject(ViewJson)));
+        }
+
+        const FScreenshotEncodeResult Encoded = FScreenshotCapture::EncodeFrame(MoveTemp(Sheet), SheetSize, EncodeOptions, Filename);
+        if (!Encoded.bSuccess)
+        {
+            return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Encoded.Message);
+        }
+
+        FScreenshotCapture::AddEncodeResultFields(Encoded, EncodeOptions, Filename, Result);
+        Result->SetNumberField(TEXT("columns"), Columns);
+        Result->SetNumberField(TEXT("rows"), Rows);
+        Result->SetNumberField(TEXT("cell_size"), FMath::RoundToInt(static_cast<float>(Resolution) * Encoded.Size.X / SheetSize.X));
+    }
+    else
+    {
+        // Views are independent, so encode them in parallel
+        TArray<FScreenshotEncodeResult> Encoded;
+        Encoded.SetNum(Views.Num());
+        TArray<FString> ViewFilenames;
+        for (int32 Index = 0; Index < Views.Num(); ++Index)
+        {
+            ViewFilenames.Add(FPaths::GetPath(Filename) / FString::Printf(TEXT("%s_%d.%s"), *FPaths::GetBaseFilename(Filename), Index, EncodeOptions.GetExtension()));
+        }
+
+        // Each view is compared with its own previous frame
+        TArray<FScreenshotEncodeOptions> ViewOptions;
+        for (const FCaptureViewSpec& View : Views)
+        {
+            FScreenshotEncodeOptions& Options = ViewOptions.Add_GetRef(EncodeOptions);
+            Options.ViewKey = EncodeOptions.ViewKey / View.Name;
+        }
+
+        ParallelFor(Views.Num(), [&](int32 Index)
+        {
+            Encoded[Index] = FScreenshotCapture::EncodeFrame(MoveTemp(ViewPixels[Index]), FIntPoint(Resolution, Resolution), ViewOptions[Index], ViewFilenames[Index]);
+        });
+
+        for (int32 Index = 0; Index < Views.Num(); ++Index)
+        {
+            if (!Encoded[Index].bSuccess)
+            {
+                return FEpicUnrealMCPCommonUtils::CreateErrorResponse(Encoded[Index].Message);
+            }
+
+            TSharedPtr<FJsonObject> ViewJson = CaptureViewToJson(Views[Index]);
+            FScreenshotCapture::AddEncodeResultFields(Encoded[Index], ViewOptions[Index], ViewFilenames[Index], ViewJson);
+            ViewsJson.Add(MakeShareable(new FJsonValueObject(ViewJson)));
+        }
+    }
+
+    TArray<TSharedPtr<FJsonValue>> MissingJson;
+    for (const FString& Name : MissingActors)
+    {
+        MissingJson.Add(MakeShareable(new FJsonValueString(Name)));
+    }
+
+    Result->SetBoolField(TEXT("success"), true);
+    Result->SetStringField(TEXT("layout"), bContactSheet ? TEXT("contact_sheet") : TEXT("array"));
+    Result->SetArrayField(TEXT("views"), ViewsJson);
+    Result->SetNumberField(TEXT("view_count"), Views.Num());
+    Result->SetNumberField(TEXT("resolution"), Resolution);
+    Result->SetNumberField(TEXT("capture_ms"), (CaptureEndTime - StartTime) * 1000.0);
+    Result->SetNumberField(TEXT("total_ms"), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+    Result->SetArrayField(TEXT("missing_actors"), MissingJson);
+
+    UE_LOG(LogTemp, Display, TEXT("FMultiViewCapture::CaptureViews: %d views at %d px in %.1f ms"),
+        Views.Num(), Resolution, (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+    return Result;
+}
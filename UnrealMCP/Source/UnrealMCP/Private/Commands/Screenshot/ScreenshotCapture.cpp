@@ -0,0 +1,800 @@
+#include "Commands/Screenshot/ScreenshotCapture.h"
+#include "Commands/EpicUnrealMCPCommonUtils.h"
+#include "Commands/EpicUnrealMCPJobRegistry.h"
+#include "UnrealClient.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
+#include "RHIGPUReadback.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Modules/ModuleManager.h"
+#include "Async/Async.h"
+#include "Containers/Ticker.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/Base64.h"
+#include "Misc/ScopeLock.h"
+#include "ImageUtils.h"
+#include <atomic>
+
+// Finished jobs kept around for status queries before the oldest are dropped
+static constexpr int32 MaxFinishedScreenshotJobs = 64;
+
+// A readback that is not ready by then will not become ready (e.g. the viewport stopped rendering)
+static constexpr double ScreenshotReadbackTimeoutSeconds = 5.0;
+
+enum class EScreenshotJobState : uint8
+{
+    ReadingBack,
+    Encoding,
+    Completed,
+    Failed
+};
+
+// State shared with the rendering thread; only the rendering thread touches Readback after creation
+struct FScreenshotReadbackState
+{
+    TUniquePtr<FRHIGPUTextureReadback> Readback;
+    EPixelFormat Format = PF_Unknown;
+    FIntPoint Size = FIntPoint::ZeroValue;
+    std::atomic<bool> bPollInFlight{false};
+    // Taken by whichever side acts first: the rendering thread when it copies the finished readback out,
+    // or the game thread when the job times out. The loser leaves the job alone, so a readback that
+    // completes after the timeout is never encoded, written or used as a change baseline.
+    std::atomic<bool> bClaimed{false};
+};
+
+struct FScreenshotJob
+{
+    FString JobId;
+    FString Filename;
+    FScreenshotEncodeOptions Options;
+    EScreenshotJobState State = EScreenshotJobState::ReadingBack;
+    FString Message;
+    FIntPoint Size = FIntPoint::ZeroValue;
+    double StartTime = 0.0;
+    double ReadbackEndTime = 0.0;
+    double EndTime = 0.0;
+    FScreenshotEncodeResult Encoded;
+    // Set once the inline image was returned by a status query; its Base64 is freed then
+    bool bInlineDelivered = false;
+    TSharedPtr<FScreenshotReadbackState, ESPMode::ThreadSafe> Readback;
+};
+
+static FTSTicker::FDelegateHandle& GetScreenshotTickerHandle()
+{
+    static FTSTicker::FDelegateHandle Handle;
+    return Handle;
+}
+
+static const TCHAR* ScreenshotJobStateToString(EScreenshotJobState State)
+{
+    switch (State)
+    {
+    case EScreenshotJobState::ReadingBack: return TEXT("reading_back");
+    case EScreenshotJobState::Encoding:    return TEXT("encoding");
+    case EScreenshotJobState::Completed:   return TEXT("completed");
+    case EScreenshotJobState::Failed:      return TEXT("failed");
+    }
+    return TEXT("unknown");
+}
+
+static bool IsScreenshotJobDone(const FScreenshotJob& Job)
+{
+    return Job.State == EScreenshotJobState::Completed || Job.State == EScreenshotJobState::Failed;
+}
+
+// Helper to access the job registry (game thread only)
+static TEpicUnrealMCPJobRegistry<FScreenshotJob>& GetScreenshotJobs()
+{
+    static TEpicUnrealMCPJobRegistry<FScreenshotJob> Jobs(MaxFinishedScreenshotJobs, &IsScreenshotJobDone);
+    return Jobs;
+}
+
+// ============================================================================
+// FScreenshotEncodeOptions
+// ============================================================================
+bool FScreenshotEncodeOptions::FromJson(const TSharedPtr<FJsonObject>& Params, FScreenshotEncodeOptions& Out, FString& OutError)
+{
+    Params->TryGetNumberField(TEXT("max_dimension"), Out.MaxDimension);
+    Out.MaxDimension = FMath::Max(Out.MaxDimension, 0);
+
+    FString Format;
+    if (Params->TryGetStringField(TEXT("format"), Format) && !Format.IsEmpty())
+    {
+        if (Format.Equals(TEXT("png"), ESearchCase::IgnoreCase))
+        {
+            Out.Codec = EScreenshotCodec::Png;
+        }
+        else if (Format.Equals(TEXT("jpeg"), ESearchCase::IgnoreCase) || Format.Equals(TEXT("jpg"), ESearchCase::IgnoreCase))
+        {
+            Out.Codec = EScreenshotCodec::Jpeg;
+        }
+        else if (Format.Equals(TEXT("webp"), ESearchCase::IgnoreCase))
+        {
+            OutError = TEXT("WebP encoding is not available in this engine build; use jpeg or png");
+            return false;
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Unknown format '%s' (use png or jpeg)"), *Format);
+            return false;
+        }
+    }
+
+    Params->TryGetNumberField(TEXT("quality"), Out.Quality);
+    Out.Quality = FMath::Clamp(Out.Quality, 1, 100);
+
+    FString ChangeDetection;
+    if (Params->TryGetStringField(TEXT("change_detection"), ChangeDetection) && !ChangeDetection.IsEmpty())
+    {
+        if (ChangeDetection.Equals(TEXT("off"), ESearchCase::IgnoreCase))
+        {
+            Out.ChangeMode = EScreenshotChangeMode::Off;
+        }
+        else if (ChangeDetection.Equals(TEXT("bbox"), ESearchCase::IgnoreCase))
+        {
+            Out.ChangeMode = EScreenshotChangeMode::BoundingBox;
+        }
+        else if (ChangeDetection.Equals(TEXT("crop"), ESearchCase::IgnoreCase))
+        {
+            Out.ChangeMode = EScreenshotChangeMode::Crop;
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Unknown change_detection '%s' (use off, bbox or crop)"), *ChangeDetection);
+            return false;
+        }
+    }
+
+    Params->TryGetStringField(TEXT("view_key"), Out.ViewKey);
+    Params->TryGetNumberField(TEXT("tile_size"), Out.TileSize);
+    Out.TileSize = FMath::Clamp(Out.TileSize, 4, 256);
+    double ChangeThreshold = Out.ChangeThreshold;
+    Params->TryGetNumberField(TEXT("change_threshold"), ChangeThreshold);
+    Out.ChangeThreshold = FMath::Max(static_cast<float>(ChangeThreshold), 0.0f);
+    Params->TryGetBoolField(TEXT("reset_baseline"), Out.bResetBaseline);
+
+    FString Output;
+    if (Params->TryGetStringField(TEXT("output"), Output) && !Output.IsEmpty())
+    {
+        if (Output.Equals(TEXT("file"), ESearchCase::IgnoreCase))
+        {
+            Out.bWriteFile = true;
+            Out.bInline = false;
+        }
+        else if (Output.Equals(TEXT("base64"), ESearchCase::IgnoreCase))
+        {
+            Out.bWriteFile = false;
+            Out.bInline = true;
+        }
+        else if (Output.Equals(TEXT("both"), ESearchCase::IgnoreCase))
+        {
+            Out.bWriteFile = true;
+            Out.bInline = true;
+        }
+        else
+        {
+            OutError = FString::Printf(TEXT("Unknown output '%s' (use file, base64 or both)"), *Output);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+const TCHAR* FScreenshotEncodeOptions::GetExtension() const
+{
+    return Codec == EScreenshotCodec::Jpeg ? TEXT("jpg") : TEXT("png");
+}
+
+const TCHAR* FScreenshotEncodeOptions::GetMimeType() const
+{
+    return Codec == EScreenshotCodec::Jpeg ? TEXT("image/jpeg") : TEXT("image/png");
+}
+
+// ============================================================================
+// Helper: Convert raw render target rows to opaque BGRA8 (worker thread)
+// ============================================================================
+static bool ConvertReadbackPixels(const TArray<uint8>& Raw, EPixelFormat Format, const FIntPoint& Size, TArray<FColor>& OutPixels)
+{
+    const int32 PixelCount = Size.X * Size.Y;
+    OutPixels.SetNumUninitialized(PixelCount);
+
+    switch (Format)
+    {
+    case PF_B8G8R8A8:
+        FMemory::Memcpy(OutPixels.GetData(), Raw.GetData(), PixelCount * sizeof(FColor));
+        break;
+
+    case PF_R8G8B8A8:
+        for (int32 Index = 0; Index < PixelCount; ++Index)
+        {
+            const uint8* Src = Raw.GetData() + Index * 4;
+            OutPixels[Index] = FColor(Src[0], Src[1], Src[2], 255);
+        }
+        break;
+
+    case PF_A2B10G10R10:
+        for (int32 Index = 0; Index < PixelCount; ++Index)
+        {
+            const uint32 Packed = reinterpret_cast<const uint32*>(Raw.GetData())[Index];
+            OutPixels[Index] = FColor(
+                static_cast<uint8>((Packed & 0x3FF) >> 2),
+                static_cast<uint8>(((Packed >> 10) & 0x3FF) >> 2),
+                static_cast<uint8>(((Packed >> 20) & 0x3FF) >> 2),
+                255);
+        }
+        break;
+
+    case PF_FloatRGBA:
+        for (int32 Index = 0; Index < PixelCount; ++Index)
+        {
+            const FFloat16Color& Src = reinterpret_cast<const FFloat16Color*>(Raw.GetData())[Index];
+            OutPixels[Index] = FLinearColor(Src.R.GetFloat(), Src.G.GetFloat(), Src.B.GetFloat(), 1.0f).ToFColor(true);
+        }
+        break;
+
+    default:
+        return false;
+    }
+
+    // Viewport alpha is not coverage; keep screenshots opaque
+    for (FColor& Pixel : OutPixels)
+    {
+        Pixel.A = 255;
+    }
+    return true;
+}
+
+// ============================================================================
+// Helper: Change detection against the previous frame of a view
+// ============================================================================
+
+// Per-tile mean colour of a frame: a coarse perceptual signature that ignores single-pixel noise
+struct FScreenshotSignature
+{
+    FIntPoint Size = FIntPoint::ZeroValue;
+    int32 TileSize = 0;
+    FIntPoint TileCount = FIntPoint::ZeroValue;
+    TArray<FVector3f> TileMeans;
+};
+
+// Helper to access stored signatures by view key (any thread, under the lock)
+static TMap<FString, FScreenshotSignature>& GetScreenshotSignatures()
+{
+    static TMap<FString, FScreenshotSignature> Signatures;
+    return Signatures;
+}
+
+static FCriticalSection& GetScreenshotSignatureLock()
+{
+    static FCriticalSection Lock;
+    return Lock;
+}
+
+static FScreenshotSignature ComputeScreenshotSignature(const TArray<FColor>& Pixels, const FIntPoint& Size, int32 TileSize)
+{
+    FScreenshotSignature Signature;
+    Signature.Size = Size;
+    Signature.TileSize = TileSize;
+    Signature.TileCount = FIntPoint(FMath::DivideAndRoundUp(Size.X, TileSize), FMath::DivideAndRoundUp(Size.Y, TileSize));
+
+    const int32 NumTiles = Signature.TileCount.X * Signature.TileCount.Y;
+    TArray<FUintVector3> Sums;
+    Sums.Init(FUintVector3(0, 0, 0), NumTiles);
+    TArray<uint32> Counts;
+    Counts.Init(0, NumTiles);
+
+    for (int32 Y = 0; Y < Size.Y; ++Y)
+    {
+        const int32 TileRow = (Y / TileSize) * Signature.TileCount.X;
+        const FColor* Row = Pixels.GetData() + Y * Size.X;
+        for (int32 X = 0; X < Size.X; ++X)
+        {
+            const int32 Tile = TileRow + X / TileSize;
+            Sums[Tile].X += Row[X].R;
+            Sums[Tile].Y += Row[X].G;
+            Sums[Tile].Z += Row[X].B;
+            ++Counts[Tile];
+        }
+    }
+
+    Signature.TileMeans.SetNumUninitialized(NumTiles);
+    for (int32 Tile = 0; Tile < NumTiles; ++Tile)
+    {
+        const float Count = FMath::Max<uint32>(Counts[Tile], 1);
+        Signature.TileMeans[Tile] = FVector3f(Sums[Tile].X / Count, Sums[Tile].Y / Count, Sums[Tile].Z / Count);
+    }
+    return Signature;
+}
+
+// Compare with the stored signature of the view. The baseline is left alone here: an unchanged frame
+// keeps it (so slow drift still adds up against the last delivered image) and a changed frame only
+// replaces it through CommitScreenshotSignature once its image was actually produced.
+static void DetectScreenshotChange(const TArray<FColor>& Pixels, const FIntPoint& Size, const FScreenshotEncodeOptions& Options,
+    FScreenshotEncodeResult& Result, FScreenshotSignature& OutSignature)
+{
+    FScreenshotSignature Signature = ComputeScreenshotSignature(Pixels, Size, Options.TileSize);
+    Result.TotalTiles = Signature.TileMeans.Num();
+
+    FScopeLock ScopeLock(&GetScreenshotSignatureLock());
+    const TMap<FString, FScreenshotSignature>& Signatures = GetScreenshotSignatures();
+
+    const FScreenshotSignature* Previous = Options.bResetBaseline ? nullptr : Signatures.Find(Options.ViewKey);
+    if (!Previous || Previous->Size != Size || Previous->TileSize != Options.TileSize)
+    {
+        Result.Change = EScreenshotChange::First;
+        Result.ChangedRect = FIntRect(FIntPoint::ZeroValue, Size);
+        Result.ChangedTiles = Result.TotalTiles;
+    }
+    else
+    {
+        FIntPoint MinTile(MAX_int32, MAX_int32);
+        FIntPoint MaxTile(-1, -1);
+        for (int32 Tile = 0; Tile < Signature.TileMeans.Num(); ++Tile)
+        {
+            const FVector3f Delta = (Signature.TileMeans[Tile] - Previous->TileMeans[Tile]).GetAbs();
+            if (Delta.GetMax() > Options.ChangeThreshold)
+            {
+                const FIntPoint TileCoord(Tile % Signature.TileCount.X, Tile / Signature.TileCount.X);
+                MinTile = MinTile.ComponentMin(TileCoord);
+                MaxTile = MaxTile.ComponentMax(TileCoord);
+                ++Result.ChangedTiles;
+            }
+        }
+
+        if (Result.ChangedTiles == 0)
+        {
+            Result.Change = EScreenshotChange::Unchanged;
+        }
+        else
+        {
+            Result.Change = EScreenshotChange::Changed;
+            Result.ChangedRect = FIntRect(MinTile * Options.TileSize, ((MaxTile + 1) * Options.TileSize).ComponentMin(Size));
+        }
+    }
+
+    OutSignature = MoveTemp(Signature);
+}
+
+// Make a delivered frame the new baseline of its view
+static void CommitScreenshotSignature(const FString& ViewKey, FScreenshotSignature&& Signature)
+{
+    FScopeLock ScopeLock(&GetScreenshotSignatureLock());
+    GetScreenshotSignatures().Add(ViewKey, MoveTemp(Signature));
+}
+
+static const TCHAR* ScreenshotChangeToString(EScreenshotChange Change)
+{
+    switch (Change)
+    {
+    case EScreenshotChange::NotChecked: return TEXT("not_checked");
+    case EScreenshotChange::First:      return TEXT("first");
+    case EScreenshotChange::Changed:    return TEXT("changed");
+    case EScreenshotChange::Unchanged:  return TEXT("unchanged");
+    }
+    return TEXT("unknown");
+}
+
+// ============================================================================
+// EncodeFrame
+// ============================================================================
+void FScreenshotCapture::LoadEncoder()
+{
+    FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName(TEXT("ImageWrapper")));
+}
+
+FScreenshotEncodeResult FScreenshotCapture::EncodeFrame(TArray<FColor>&& Pixels, const FIntPoint& SourceSize, const FScreenshotEncodeOptions& Options, const FString& Filename)
+{
+    FScreenshotEncodeResult Result;
+    Result.SourceSize = SourceSize;
+    const double EncodeStart = FPlatformTime::Seconds();
+
+    FIntPoint Size = SourceSize;
+    FScreenshotSignature PendingSignature;
+    if (Options.ChangeMode != EScreenshotChangeMode::Off)
+    {
+        DetectScreenshotChange(Pixels, SourceSize, Options, Result, PendingSignature);
+
+        // Nothing visible changed: skip the encode and the write entirely
+        if (Result.Change == EScreenshotChange::Unchanged)
+        {
+            Result.bSuccess = true;
+            Result.EncodeMs = (FPlatformTime::Seconds() - EncodeStart) * 1000.0;
+            return Result;
+        }
+
+        if (Options.ChangeMode == EScreenshotChangeMode::Crop && Result.Change == EScreenshotChange::Changed)
+        {
+            const FIntRect& Rect = Result.ChangedRect;
+            TArray<FColor> Cropped;
+            Cropped.SetNumUninitialized(Rect.Area());
+            for (int32 Row = 0; Row < Rect.Height(); ++Row)
+            {
+                FMemory::Memcpy(&Cropped[Row * Rect.Width()], &Pixels[(Rect.Min.Y + Row) * SourceSize.X + Rect.Min.X], Rect.Width() * sizeof(FColor));
+            }
+            Pixels = MoveTemp(Cropped);
+            Size = Rect.Size();
+        }
+    }
+    Result.Size = Size;
+
+    // Downscale first: encoding cost scales with pixel count
+    const int32 LongSide = FMath::Max(Size.X, Size.Y);
+    if (Options.MaxDimension > 0 && LongSide > Options.MaxDimension)
+    {
+        const float Scale = static_cast<float>(Options.MaxDimension) / LongSide;
+        Result.Size = FIntPoint(FMath::Max(1, FMath::RoundToInt(Size.X * Scale)), FMath::Max(1, FMath::RoundToInt(Size.Y * Scale)));
+
+        TArray<FColor> Scaled;
+        FImageUtils::ImageResize(Size.X, Size.Y, Pixels, Result.Size.X, Result.Size.Y, Scaled, false);
+        Pixels = MoveTemp(Scaled);
+    }
+
+    IImageWrapperModule* ImageWrapperModule = FModuleManager::GetModulePtr<IImageWrapperModule>(FName(TEXT("ImageWrapper")));
+    TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule
+        ? ImageWrapperModule->CreateImageWrapper(Options.Codec == EScreenshotCodec::Jpeg ? EImageFormat::JPEG : EImageFormat::PNG)
+        : nullptr;
+    if (!ImageWrapper.IsValid() || !ImageWrapper->SetRaw(Pixels.GetData(), Pixels.Num() * sizeof(FColor), Result.Size.X, Result.Size.Y, ERGBFormat::BGRA, 8))
+    {
+        Result.Message = TEXT("Failed to compress viewport image");
+        return Result;
+    }
+
+    // PNG ignores the quality argument; 0 keeps its default compression level
+    const TArray64<uint8> Compressed = ImageWrapper->GetCompressed(Options.Codec == EScreenshotCodec::Jpeg ? Options.Quality : 0);
+    if (Compressed.Num() == 0)
+    {
+        Result.Message = TEXT("Failed to compress viewport image");
+        return Result;
+    }
+
+    if (Options.bWriteFile)
+    {
+        IFileManager::Get().MakeDirectory(*FPaths::GetPath(Filename), true);
+        if (!FFileHelper::SaveArrayToFile(Compressed, *Filename))
+        {
+            Result.Message = FString::Printf(TEXT("Failed to save screenshot to: %s"), *Filename);
+            return Result;
+        }
+    }
+
+    if (Options.bInline)
+    {
+        Result.Base64 = FBase64::Encode(Compressed.GetData(), Compressed.Num());
+    }
+
+    // Only a frame that reached the caller becomes the baseline; a failed encode or write keeps the old one
+    if (Options.ChangeMode != EScreenshotChangeMode::Off)
+    {
+        CommitScreenshotSignature(Options.ViewKey, MoveTemp(PendingSignature));
+    }
+
+    Result.bSuccess = true;
+    Result.EncodedBytes = Compressed.Num();
+    Result.EncodeMs = (FPlatformTime::Seconds() - EncodeStart) * 1000.0;
+    return Result;
+}
+
+void FScreenshotCapture::AddEncodeResultFields(const FScreenshotEncodeResult& Result, const FScreenshotEncodeOptions& Options, const FString& Filename,
+    const TSharedPtr<FJsonObject>& OutJson)
+{
+    OutJson->SetNumberField(TEXT("source_width"), Result.SourceSize.X);
+    OutJson->SetNumberField(TEXT("source_height"), Result.SourceSize.Y);
+
+    if (Result.Change != EScreenshotChange::NotChecked)
+    {
+        OutJson->SetStringField(TEXT("change"), ScreenshotChangeToString(Result.Change));
+        OutJson->SetStringField(TEXT("view_key"), Options.ViewKey);
+        OutJson->SetNumberField(TEXT("changed_tiles"), Result.ChangedTiles);
+        OutJson->SetNumberField(TEXT("total_tiles"), Result.TotalTiles);
+        OutJson->SetNumberField(TEXT("changed_fraction"), Result.TotalTiles > 0 ? static_cast<double>(Result.ChangedTiles) / Result.TotalTiles : 0.0);
+
+        if (Result.Change == EScreenshotChange::Unchanged)
+        {
+            // No image was produced
+            OutJson->SetNumberField(TEXT("encode_ms"), Result.EncodeMs);
+            return;
+        }
+
+        TSharedPtr<FJsonObject> RectJson = MakeShareable(new FJsonObject);
+        RectJson->SetNumberField(TEXT("x"), Result.ChangedRect.Min.X);
+        RectJson->SetNumberField(TEXT("y"), Result.ChangedRect.Min.Y);
+        RectJson->SetNumberField(TEXT("width"), Result.ChangedRect.Width());
+        RectJson->SetNumberField(TEXT("height"), Result.ChangedRect.Height());
+        OutJson->SetObjectField(TEXT("changed_bbox"), RectJson);
+        OutJson->SetBoolField(TEXT("cropped"), Options.ChangeMode == EScreenshotChangeMode::Crop && Result.Change == EScreenshotChange::Changed);
+    }
+
+    OutJson->SetNumberField(TEXT("width"), Result.Size.X);
+    OutJson->SetNumberField(TEXT("height"), Result.Size.Y);
+    OutJson->SetStringField(TEXT("format"), Options.GetExtension());
+    OutJson->SetStringField(TEXT("mime_type"), Options.GetMimeType());
+    OutJson->SetNumberField(TEXT("encoded_bytes"), static_cast<double>(Result.EncodedBytes));
+    OutJson->SetNumberField(TEXT("encode_ms"), Result.EncodeMs);
+    if (Options.bWriteFile)
+    {
+        OutJson->SetStringField(TEXT("file_path"), Filename);
+    }
+    if (Options.bInline)
+    {
+        OutJson->SetStringField(TEXT("data_base64"), Result.Base64);
+    }
+}
+
+// Helper to record the end of the readback (game thread)
+static void MarkScreenshotReadbackDone(const FString& JobId, const FIntPoint& Size)
+{
+    FScreenshotJob* Job = GetScreenshotJobs().Find(JobId);
+    if (Job && Job->State == EScreenshotJobState::ReadingBack)
+    {
+        Job->State = EScreenshotJobState::Encoding;
+        Job->Size = Size;
+        Job->ReadbackEndTime = FPlatformTime::Seconds();
+        Job->Readback.Reset();
+    }
+}
+
+// Helper to move a job to a terminal state (game thread)
+static void FinishScreenshotJob(FScreenshotJob& Job, bool bSuccess, const FString& Message)
+{
+    if (IsScreenshotJobDone(Job))
+    {
+        return;
+    }
+
+    Job.EndTime = FPlatformTime::Seconds();
+    if (Job.ReadbackEndTime == 0.0)
+    {
+        Job.ReadbackEndTime = Job.EndTime;
+    }
+    Job.State = bSuccess ? EScreenshotJobState::Completed : EScreenshotJobState::Failed;
+    Job.Message = Message;
+    Job.Readback.Reset();
+
+    UE_LOG(LogTemp, Display, TEXT("FScreenshotCapture: '%s' %s in %.1f ms"),
+        *Job.Filename, ScreenshotJobStateToString(Job.State), (Job.EndTime - Job.StartTime) * 1000.0);
+}
+
+// ============================================================================
+// Helper: Poll one readback on the rendering thread
+// ============================================================================
+static void EnqueueScreenshotPoll(const FString& JobId, const FString& Filename, const FScreenshotEncodeOptions& Options,
+    TSharedPtr<FScreenshotReadbackState, ESPMode::ThreadSafe> State)
+{
+    State->bPollInFlight = true;
+
+    ENQUEUE_RENDER_COMMAND(MCPPollScreenshotReadback)(
+        [JobId, Filename, Options, State](FRHICommandListImmediate& RHICmdList)
+        {
+            if (!State->Readback.IsValid() || !State->Readback->IsReady())
+            {
+                State->bPollInFlight = false;
+                return;
+            }
+            if (State->bClaimed.exchange(true))
+            {
+                // The job already timed out
+                State->bPollInFlight = false;
+                return;
+            }
+
+            // Copy the rows out tightly packed; the readback buffer is padded to its row pitch
+            const FIntPoint Size = State->Size;
+            const int32 BytesPerPixel = GPixelFormats[State->Format].BlockBytes;
+            TArray<uint8> Raw;
+            Raw.SetNumUninitialized(Size.X * Size.Y * BytesPerPixel);
+
+            int32 RowPitchInPixels = 0;
+            const uint8* Data = static_cast<const uint8*>(State->Readback->Lock(RowPitchInPixels));
+            if (Data)
+            {
+                for (int32 Row = 0; Row < Size.Y; ++Row)
+                {
+                    FMemory::Memcpy(Raw.GetData() + Row * Size.X * BytesPerPixel, Data + Row * RowPitchInPixels * BytesPerPixel, Size.X * BytesPerPixel);
+                }
+            }
+            State->Readback->Unlock();
+            State->Readback.Reset();
+
+            if (!Data)
+            {
+                AsyncTask(ENamedThreads::GameThread, [JobId]()
+                {
+                    if (FScreenshotJob* Job = GetScreenshotJobs().Find(JobId))
+                    {
+                        FinishScreenshotJob(*Job, false, TEXT("Failed to map the GPU readback"));
+                    }
+                    GetScreenshotJobs().PruneFinished();
+                });
+                return;
+            }
+
+            AsyncTask(ENamedThreads::GameThread, [JobId, Size]()
+            {
+                MarkScreenshotReadbackDone(JobId, Size);
+            });
+
+            const EPixelFormat Format = State->Format;
+            Async(EAsyncExecution::ThreadPool, [JobId, Filename, Options, Raw = MoveTemp(Raw), Format, Size]()
+            {
+                FScreenshotEncodeResult Result;
+                TArray<FColor> Pixels;
+                if (ConvertReadbackPixels(Raw, Format, Size, Pixels))
+                {
+                    Result = FScreenshotCapture::EncodeFrame(MoveTemp(Pixels), Size, Options, Filename);
+                }
+                else
+                {
+                    Result.Message = FString::Printf(TEXT("Unsupported viewport pixel format %s"), GetPixelFormatString(Format));
+                }
+
+                AsyncTask(ENamedThreads::GameThread, [JobId, Result = MoveTemp(Result)]()
+                {
+                    FScreenshotJob* Job = GetScreenshotJobs().Find(JobId);
+                    if (Job && !IsScreenshotJobDone(*Job))
+                    {
+                        Job->Encoded = Result;
+                        FinishScreenshotJob(*Job, Result.bSuccess, Result.bSuccess ? TEXT("Screenshot encoded") : Result.Message);
+                    }
+                    GetScreenshotJobs().PruneFinished();
+                });
+            });
+        });
+}
+
+// Core ticker callback: poll pending readbacks, stop ticking when none are left
+static bool TickScreenshotJobs(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    bool bAnyReadingBack = false;
+    for (TPair<FString, FScreenshotJob>& Pair : GetScreenshotJobs().GetJobs())
+    {
+        FScreenshotJob& Job = Pair.Value;
+        if (Job.State != EScreenshotJobState::ReadingBack || !Job.Readback.IsValid())
+        {
+            continue;
+        }
+
+        // Once the rendering thread has claimed the readback it finishes the job itself
+        if (Now - Job.StartTime > ScreenshotReadbackTimeoutSeconds && !Job.Readback->bClaimed.exchange(true))
+        {
+            FinishScreenshotJob(Job, false, TEXT("GPU readback timed out; is the viewport rendering?"));
+            continue;
+        }
+
+        bAnyReadingBack = true;
+        if (!Job.Readback->bPollInFlight)
+        {
+            EnqueueScreenshotPoll(Job.JobId, Job.Filename, Job.Options, Job.Readback);
+        }
+    }
+
+    if (!bAnyReadingBack)
+    {
+        GetScreenshotTickerHandle().Reset();
+        GetScreenshotJobs().PruneFinished();
+    }
+    return bAnyReadingBack;
+}
+
+FString FScreenshotCapture::StartCapture(FViewport* Viewport, const FString& Filename, const FScreenshotEncodeOptions& Options, FString& OutError)
+{
+    if (!Viewport)
+    {
+        OutError = TEXT("No viewport");
+        return FString();
+    }
+
+    // Viewports drawn straight to the back buffer have nothing that survives until the copy
+    FTextureRHIRef RenderTarget = Viewport->GetRenderTargetTexture();
+    if (!RenderTarget.IsValid())
+    {
+        OutError = TEXT("Viewport has no separate render target");
+        return FString();
+    }
+
+    // The module must be loaded on the game thread before workers use it
+    LoadEncoder();
+
+    const FIntPoint ViewportSize = Viewport->GetSizeXY();
+
+    TSharedPtr<FScreenshotReadbackState, ESPMode::ThreadSafe> State = MakeShared<FScreenshotReadbackState, ESPMode::ThreadSafe>();
+    State->Readback = MakeUnique<FRHIGPUTextureReadback>(TEXT("MCPScreenshotReadback"));
+
+    FString JobId;
+    FScreenshotJob& Job = GetScreenshotJobs().Add(JobId);
+    Job.JobId = JobId;
+    Job.Filename = Filename;
+    Job.Options = Options;
+    Job.Size = ViewportSize;
+    Job.StartTime = FPlatformTime::Seconds();
+    Job.Readback = State;
+
+    // Runs after the frame already queued on the rendering thread, so it copies the last drawn image without a flush
+    ENQUEUE_RENDER_COMMAND(MCPCopyScreenshot)(
+        [State, RenderTarget, ViewportSize](FRHICommandListImmediate& RHICmdList)
+        {
+            const FIntPoint TargetSize(RenderTarget->GetSizeXYZ().X, RenderTarget->GetSizeXYZ().Y);
+            State->Format = RenderTarget->GetFormat();
+            State->Size = FIntPoint(FMath::Min(ViewportSize.X, TargetSize.X), FMath::Min(ViewportSize.Y, TargetSize.Y));
+            State->Readback->EnqueueCopy(RHICmdList, RenderTarget);
+        });
+
+    if (!GetScreenshotTickerHandle().IsValid())
+    {
+        GetScreenshotTickerHandle() = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateStatic(&TickScreenshotJobs));
+    }
+
+    UE_LOG(LogTemp, Display, TEXT("FScreenshotCapture::StartCapture: Queued %dx%d readback for '%s'"), ViewportSize.X, ViewportSize.Y, *Filename);
+    return JobId;
+}
+
+TSharedPtr<FJsonObject> FScreenshotCapture::GetJobStatus(const TSharedPtr<FJsonObject>& Params)
+{
+    FString JobId;
+    if (!Params->TryGetStringField(TEXT("job_id"), JobId))
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(TEXT("Missing 'job_id' parameter"));
+    }
+
+    TSharedPtr<FJsonObject> Result = DescribeJob(JobId);
+    if (!Result.IsValid())
+    {
+        return FEpicUnrealMCPCommonUtils::CreateErrorResponse(
+            FString::Printf(TEXT("Unknown screenshot job '%s'"), *JobId));
+    }
+
+    // The inline image is returned once; finished jobs are kept for a while and should not pin it
+    FScreenshotJob* Job = GetScreenshotJobs().Find(JobId);
+    if (Job && Job->State == EScreenshotJobState::Completed && Job->Options.bInline && !Job->bInlineDelivered)
+    {
+        Job->bInlineDelivered = true;
+        Job->Encoded.Base64.Empty();
+    }
+
+    Result->SetBoolField(TEXT("success"), true);
+    return Result;
+}
+
+TSharedPtr<FJsonObject> FScreenshotCapture::DescribeJob(const FString& JobId)
+{
+    const FScreenshotJob* Job = GetScreenshotJobs().Find(JobId);
+    if (!Job)
+    {
+        return nullptr;
+    }
+
+    const bool bDone = IsScreenshotJobDone(*Job);
+    const double Now = FPlatformTime::Seconds();
+
+    TSharedPtr<FJsonObject> Status = MakeShareable(new FJsonObject);
+    Status->SetStringField(TEXT("job_id"), Job->JobId);
+    Status->SetStringField(TEXT("state"), ScreenshotJobStateToString(Job->State));
+    Status->SetBoolField(TEXT("done"), bDone);
+    Status->SetNumberField(TEXT("width"), Job->Size.X);
+    Status->SetNumberField(TEXT("height"), Job->Size.Y);
+    Status->SetNumberField(TEXT("total_ms"), ((bDone ? Job->EndTime : Now) - Job->StartTime) * 1000.0);
+    if (Job->ReadbackEndTime > 0.0)
+    {
+        Status->SetNumberField(TEXT("readback_ms"), (Job->ReadbackEndTime - Job->StartTime) * 1000.0);
+    }
+    if (Job->State == EScreenshotJobState::Completed)
+    {
+        AddEncodeResultFields(Job->Encoded, Job->Options, Job->Filename, Status);
+        if (Job->bInlineDelivered)
+        {
+            Status->RemoveField(TEXT("data_base64"));
+            Status->SetBoolField(TEXT("data_base64_delivered"), true);
+        }
+    }
+    if (!Job->Message.IsEmpty())
+    {
+        Status->SetStringField(TEXT("message"), Job->Message);
+    }
+
+    return Status;
+}
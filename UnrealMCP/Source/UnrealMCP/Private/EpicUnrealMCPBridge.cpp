@@ -233,7 +233,11 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
                      CommandType == TEXT("list_content_browser_meshes") ||
                      CommandType == TEXT("get_actor_details") ||
                      CommandType == TEXT("duplicate_actor") ||
-                     CommandType == TEXT("take_screenshot"))
+                     CommandType == TEXT("take_screenshot") ||
+                     CommandType == TEXT("get_screenshot_status") ||
+                     CommandType == TEXT("capture_views") ||
+                     CommandType == TEXT("query_mesh_catalog") ||
+                     CommandType == TEXT("get_mesh_catalog_info"))
             {
                 ResultJson = EditorCommands->HandleCommand(CommandType, Params);
             }
@@ -242,6 +246,7 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
                      CommandType == TEXT("add_component_to_blueprint") ||
                      CommandType == TEXT("set_physics_properties") ||
                      CommandType == TEXT("compile_blueprint") ||
+                     CommandType == TEXT("compile_blueprints") ||
                      CommandType == TEXT("set_static_mesh_properties") ||
                      CommandType == TEXT("set_mesh_material_color") ||
                      CommandType == TEXT("get_available_materials") ||
@@ -268,7 +273,10 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
                      CommandType == TEXT("add_function_input") ||
                      CommandType == TEXT("add_function_output") ||
                      CommandType == TEXT("delete_function") ||
-                     CommandType == TEXT("rename_function"))
+                     CommandType == TEXT("rename_function") ||
+                     CommandType == TEXT("find_in_blueprints") ||
+                     CommandType == TEXT("layout_blueprint_graph") ||
+                     CommandType == TEXT("scaffold_blueprint_interface"))
             {
                 ResultJson = BlueprintGraphCommands->HandleCommand(CommandType, Params);
             }
@@ -284,7 +292,11 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
                      CommandType == TEXT("assign_pcg_graph") ||
                      CommandType == TEXT("set_pcg_spawner_entries") ||
                      CommandType == TEXT("generate_pcg") ||
-                     CommandType == TEXT("get_pcg_node_property"))
+                     CommandType == TEXT("generate_pcg_all") ||
+                     CommandType == TEXT("get_pcg_node_property") ||
+                     CommandType == TEXT("get_pcg_job_status") ||
+                     CommandType == TEXT("build_pcg_graph") ||
+                     CommandType == TEXT("get_pcg_output"))
             {
                 ResultJson = PCGGraphCommands->HandleCommand(CommandType, Params);
             }
@@ -295,7 +307,11 @@ FString UEpicUnrealMCPBridge::ExecuteCommand(const FString& CommandType, const T
                      CommandType == TEXT("connect_material_expressions") ||
                      CommandType == TEXT("connect_material_to_output") ||
                      CommandType == TEXT("set_landscape_material") ||
-                     CommandType == TEXT("compile_material"))
+                     CommandType == TEXT("compile_material") ||
+                     CommandType == TEXT("build_material_graph") ||
+                     CommandType == TEXT("get_material_compile_status") ||
+                     CommandType == TEXT("save_materials") ||
+                     CommandType == TEXT("apply_material_variant"))
             {
                 ResultJson = MaterialGraphCommands->HandleCommand(CommandType, Params);
             }
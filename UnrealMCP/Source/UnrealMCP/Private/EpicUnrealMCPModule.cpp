@@ -1,5 +1,10 @@
 #include "EpicUnrealMCPModule.h"
 #include "EpicUnrealMCPBridge.h"
+#include "Commands/BlueprintGraph/BlueprintSearchIndex.h"
+#include "Commands/MeshCatalog/ContentMeshListing.h"
+#include "Commands/MeshCatalog/MeshCatalogIndex.h"
+#include "Commands/PCGGraph/PCGNodeManager.h"
+#include "Commands/PCGGraph/PCGNodePropertyManager.h"
 #include "Modules/ModuleManager.h"
 #include "EditorSubsystem.h"
 #include "Editor.h"
@@ -13,6 +18,12 @@ void FEpicUnrealMCPModule::StartupModule()
 
 void FEpicUnrealMCPModule::ShutdownModule()
 {
+	// Static delegates would otherwise outlive the module's code
+	FBlueprintSearchIndex::UnregisterDelegates();
+	FMeshCatalogIndex::UnregisterDelegates();
+	FContentMeshListing::UnregisterDelegates();
+	FPCGNodeManager::UnregisterDelegates();
+	FPCGNodePropertyManager::UnregisterDelegates();
 	UE_LOG(LogTemp, Display, TEXT("Epic Unreal MCP Module has shut down"));
 }
 
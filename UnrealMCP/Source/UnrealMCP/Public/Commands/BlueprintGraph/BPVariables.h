@@ -4,6 +4,7 @@
 #include "Dom/JsonObject.h"
 
 // Forward declarations
+class UBlueprint;
 struct FEdGraphPinType;
 struct FBPVariableDescription;
 
@@ -30,6 +31,18 @@ public:
      */
     static TSharedPtr<FJsonObject> SetVariableProperties(const TSharedPtr<FJsonObject>& Params);
 
+    /**
+     * Adds and configures a member variable without compiling the Blueprint, so callers can batch
+     * several edits before a single compile. The name is validated the same way in both paths
+     * @param Blueprint Target Blueprint
+     * @param VariableSpec JSON containing variable_name, variable_type and optional default_value, is_public, tooltip, category
+     * @param OutError Reason for failure
+     * @param bDeferStructuralUpdate Skip the per-variable structural modification; the caller must
+     *        call FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified once after the batch
+     * @return true if the variable was added
+     */
+    static bool AddVariableToBlueprint(UBlueprint* Blueprint, const TSharedPtr<FJsonObject>& VariableSpec, FString& OutError, bool bDeferStructuralUpdate = false);
+
 private:
     /**
      * Converts a type string to FEdGraphPinType
@@ -0,0 +1,30 @@
+// Declares Blueprint variables and function signatures in one batched edit
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+/**
+ * Applies a whole Blueprint interface (variables, functions, parameters, defaults) at once
+ *
+ * create_variable / create_function each compile the Blueprint, so scaffolding N members costs
+ * N compiles. Here all members are added inside one undo transaction, followed by a single
+ * structural-modify notification and a single compile.
+ */
+class UNREALMCP_API FBlueprintScaffolder
+{
+public:
+	/**
+	 * Scaffold variables and function signatures on a Blueprint
+	 * @param Params JSON parameters containing:
+	 *   - blueprint_name (string): Name of the Blueprint
+	 *   - variables (array, optional): Objects with variable_name, variable_type and optional
+	 *     default_value, is_public, tooltip, category (same fields as create_variable)
+	 *   - functions (array, optional): Objects with function_name and optional inputs / outputs,
+	 *     each an array of { param_name, param_type, is_array, default_value (inputs only) }
+	 *   - compile (bool, optional): Compile once at the end (default true)
+	 *   - auto_layout (bool, optional): Lay out each new function graph (default true)
+	 * @return JSON with variables_created, functions_created, errors, compiled and status
+	 */
+	static TSharedPtr<FJsonObject> ScaffoldBlueprintInterface(const TSharedPtr<FJsonObject>& Params);
+};
@@ -0,0 +1,55 @@
+// Project-wide search index over Blueprint graphs
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UBlueprint;
+class UPackage;
+
+/**
+ * Indexes nodes, function references, variable references and pin types across Blueprints
+ * so "who calls X" / "where is Y read" can be answered without walking every graph per query.
+ *
+ * The index is built lazily for the requested content path, refreshed when a Blueprint package
+ * is saved, and dropped per asset when the asset registry reports a removal or rename.
+ * Blueprints with unsaved edits are re-indexed at query time so results never lag MCP edits.
+ */
+class UNREALMCP_API FBlueprintSearchIndex
+{
+public:
+	/**
+	 * Search indexed Blueprint graphs
+	 * @param Params JSON parameters containing:
+	 *   - query (string): Pattern to match; supports * and ? wildcards, otherwise case-insensitive substring
+	 *   - search_type (string, optional): "all" (default), "node", "function", "variable" or "pin_type"
+	 *   - variable_access (string, optional): "any" (default), "read" or "write" (variable searches only)
+	 *   - search_path (string, optional): Content path to search (default "/Game/")
+	 *   - max_results (int, optional): Maximum matches to return (default 200)
+	 *   - rebuild (bool, optional): Discard cached entries under search_path and re-index them
+	 * @return JSON response with matches (blueprint_path, graph, node_guid, node_title, match_type, match)
+	 */
+	static TSharedPtr<FJsonObject> FindInBlueprints(const TSharedPtr<FJsonObject>& Params);
+
+	/**
+	 * Re-index a single Blueprint immediately (no-op if it is not a Blueprint)
+	 * @param Blueprint The Blueprint to index
+	 */
+	static void IndexBlueprint(UBlueprint* Blueprint);
+
+	/** Remove the package save and asset registry hooks (module shutdown); the next search registers them again */
+	static void UnregisterDelegates();
+
+private:
+	/** Hook package save and asset registry events once, on first use */
+	static void EnsureDelegatesRegistered();
+
+	/** Package save callback: refresh entries for any Blueprint in the saved package */
+	static void OnPackageSaved(const FString& PackageFileName, UPackage* Package);
+
+	/** Index every Blueprint under the given path that is missing or has unsaved edits; returns the number indexed */
+	static int32 RefreshPath(const FString& SearchPath, bool bForceRebuild);
+
+	/** Match a value against a query (wildcards if present, else case-insensitive substring) */
+	static bool MatchesQuery(const FString& Value, const FString& Query, bool bWildcard);
+};
@@ -41,15 +41,15 @@ public:
 	 */
 	static TSharedPtr<FJsonObject> AddFunctionOutput(const TSharedPtr<FJsonObject>& Params);
 
-private:
 	/**
-	 * Add a parameter to a function (internal)
+	 * Add a parameter to a function
 	 * @param Blueprint The Blueprint containing the function
 	 * @param FunctionName Name of the function
 	 * @param ParamName Name of the parameter
 	 * @param ParamType Type of the parameter
 	 * @param bIsInput true for input, false for output
 	 * @param bIsArray true if parameter is an array
+	 * @param bNotify false to leave marking the Blueprint modified to the caller (batched edits)
 	 * @return true if successful
 	 */
 	static bool AddFunctionParameter(
@@ -58,9 +58,18 @@ private:
 		const FString& ParamName,
 		const FString& ParamType,
 		bool bIsInput,
-		bool bIsArray = false
+		bool bIsArray = false,
+		bool bNotify = true
 	);
 
+	/**
+	 * Validate parameter name
+	 * @param ParamName Name to validate
+	 * @return true if valid
+	 */
+	static bool ValidateParameterName(const FString& ParamName);
+
+private:
 	/**
 	 * Load a Blueprint by name
 	 * @param BlueprintName Name or path of the Blueprint
@@ -83,13 +92,6 @@ private:
 	 */
 	static UEdGraph* FindFunctionGraph(UBlueprint* Blueprint, const FString& FunctionName);
 
-	/**
-	 * Validate parameter name
-	 * @param ParamName Name to validate
-	 * @return true if valid
-	 */
-	static bool ValidateParameterName(const FString& ParamName);
-
 	// Helper functions for JSON responses
 	static TSharedPtr<FJsonObject> CreateSuccessResponse(const FString& ParamName, const FString& ParamType, bool bIsInput);
 	static TSharedPtr<FJsonObject> CreateErrorResponse(const FString& ErrorMessage);
@@ -44,6 +44,18 @@ public:
 	 */
 	static TSharedPtr<FJsonObject> RenameFunction(const TSharedPtr<FJsonObject>& Params);
 
+	/**
+	 * Create a function graph (entry and result nodes) without compiling the Blueprint, so callers
+	 * can batch several edits before a single compile
+	 * @param Blueprint The Blueprint to add the function to
+	 * @param FunctionName Name for the new function (must not already exist)
+	 * @param OutError Reason for failure
+	 * @param bDeferStructuralUpdate Skip the structural modification AddFunctionGraph makes per function;
+	 *        the caller must call FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified once after the batch
+	 * @return The new function graph or nullptr
+	 */
+	static UEdGraph* CreateFunctionGraph(UBlueprint* Blueprint, const FString& FunctionName, FString& OutError, bool bDeferStructuralUpdate = false);
+
 private:
 	/**
 	 * Load a Blueprint by name
@@ -0,0 +1,60 @@
+// Automatic layered layout for Blueprint graphs
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Json.h"
+
+class UEdGraph;
+
+/**
+ * Spacing used by the layout pass (graph units)
+ */
+struct FBlueprintGraphLayoutSettings
+{
+	/** Horizontal distance between consecutive exec layers */
+	float ExecSpacingX = 400.0f;
+
+	/** Horizontal distance between columns of pure (data) nodes feeding the same consumer */
+	float DataSpacingX = 280.0f;
+
+	/** Vertical gap between stacked nodes */
+	float SpacingY = 64.0f;
+
+	/** Top-left corner of the laid out graph */
+	FVector2D Origin = FVector2D::ZeroVector;
+};
+
+/**
+ * Layered (Sugiyama-style) auto-layout for Blueprint graphs
+ *
+ * Exec-connected nodes are assigned to layers by longest path from their roots, ordered
+ * within each layer by the barycenter of their predecessors, and placed left to right.
+ * Pure nodes are placed in columns just left of the node that consumes them and stacked
+ * below it, so each exec node and its inputs form one block. Comment nodes are left alone.
+ * The pass is linear in nodes + links apart from the per-layer sort.
+ */
+class UNREALMCP_API FBlueprintGraphLayout
+{
+public:
+	/**
+	 * Lay out a Blueprint graph
+	 * @param Params JSON parameters containing:
+	 *   - blueprint_name (string): Name or path of the Blueprint
+	 *   - function_name (string, optional): Function graph to lay out (default: EventGraph)
+	 *   - all_graphs (bool, optional): Lay out every event and function graph
+	 *   - spacing_x (float, optional): Horizontal distance between exec layers (default 400)
+	 *   - spacing_y (float, optional): Vertical gap between nodes (default 64)
+	 * @return JSON response with graphs, nodes_positioned, layers and layout_time_ms (one undo step)
+	 */
+	static TSharedPtr<FJsonObject> LayoutBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+
+	/**
+	 * Lay out a single graph in place. Callers that build graphs in bulk can run this once at the end.
+	 * Moved nodes are Modify()'d, so an open transaction makes the layout undoable.
+	 * @param Graph The graph to lay out
+	 * @param Settings Spacing options
+	 * @param OutLayerCount Number of exec layers produced (optional)
+	 * @return Number of nodes repositioned
+	 */
+	static int32 ApplyLayout(UEdGraph* Graph, const FBlueprintGraphLayoutSettings& Settings, int32* OutLayerCount = nullptr);
+};
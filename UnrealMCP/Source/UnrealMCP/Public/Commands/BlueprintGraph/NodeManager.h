@@ -32,6 +32,15 @@ class UNREALMCP_API FBlueprintNodeManager
 		static TSharedPtr<FJsonObject> AddNode(const TSharedPtr<FJsonObject>& Params);
 
 	private:
+		/** Signature shared by all node creators */
+		using FNodeCreatorFunc = class UK2Node* (*)(class UEdGraph*, const TSharedPtr<FJsonObject>&);
+
+		/**
+		 * Map of node_type to creator, built once on first use
+		 * @return Registry keyed by node type name (case-insensitive)
+		 */
+		static const TMap<FName, FNodeCreatorFunc>& GetNodeCreatorRegistry();
+
 		/**
 		 * Create a Print String node
 		 * @param Graph - Target graph
@@ -0,0 +1,48 @@
+// Cache of resolved classes and functions reused across node creation
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UClass;
+class UFunction;
+class UK2Node;
+class UEdGraph;
+
+/**
+ * Memoizes the reflection lookups behind node creation
+ *
+ * Repeated add_blueprint_node calls for the same node kind (Print, CallFunction on
+ * KismetMathLibrary, casts to the same class...) resolve the target UClass/UFunction once
+ * and reuse it afterwards. Entries are weak, so a class unloaded by hot reload or
+ * Blueprint recompilation is simply resolved again on next use.
+ */
+class UNREALMCP_API FNodeTemplateCache
+{
+public:
+	/**
+	 * Resolve a class from a full path ("/Script/Engine.KismetMathLibrary") or a short
+	 * name, with or without its U/A prefix ("KismetMathLibrary", "UKismetMathLibrary")
+	 * @param ClassName - Class path or name
+	 * @return The class or nullptr
+	 */
+	static UClass* ResolveClass(const FString& ClassName);
+
+	/**
+	 * Resolve a function on a class (including inherited functions)
+	 * @param Class - Owning class
+	 * @param FunctionName - Function name
+	 * @return The function or nullptr
+	 */
+	static UFunction* ResolveFunction(UClass* Class, FName FunctionName);
+
+	/**
+	 * Initialize a freshly created K2Node the way the editor's node spawners do:
+	 * pins are allocated once and PostPlacedNewNode runs, without the extra ReconstructNode pass.
+	 * Only valid for nodes whose pins are fully determined by their configuration
+	 * (CallFunction, VariableGet/Set).
+	 * @param Node - The node (already added to Graph)
+	 * @param Graph - The graph containing the node
+	 */
+	static void InitializeSpawnedNode(UK2Node* Node, UEdGraph* Graph);
+};
@@ -55,4 +55,13 @@ private:
 
     // Rename function in Blueprint
     TSharedPtr<FJsonObject> HandleRenameFunction(const TSharedPtr<FJsonObject>& Params);
+
+    // Search nodes, function/variable references and pin types across Blueprints
+    TSharedPtr<FJsonObject> HandleFindInBlueprints(const TSharedPtr<FJsonObject>& Params);
+
+    // Auto-layout nodes in a Blueprint graph
+    TSharedPtr<FJsonObject> HandleLayoutBlueprintGraph(const TSharedPtr<FJsonObject>& Params);
+
+    // Declare variables and function signatures in one transaction and compile
+    TSharedPtr<FJsonObject> HandleScaffoldBlueprintInterface(const TSharedPtr<FJsonObject>& Params);
 };
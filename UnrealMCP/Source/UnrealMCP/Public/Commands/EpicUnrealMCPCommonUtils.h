@@ -56,4 +56,7 @@ public:
     // Property utilities
     static bool SetObjectProperty(UObject* Object, const FString& PropertyName, 
                                  const TSharedPtr<FJsonValue>& Value, FString& OutErrorMessage);
+
+    // Index utilities
+    static void IntersectSortedIndices(TArray<int32>& InOut, const TArray<int32>& Other);
 }; 
\ No newline at end of file
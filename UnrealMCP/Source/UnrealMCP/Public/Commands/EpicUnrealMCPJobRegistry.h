@@ -0,0 +1,94 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+
+/**
+ * Registry of asynchronous jobs keyed by a generated id, shared by the command trackers that
+ * report long-running editor work through job ids.
+ *
+ * Jobs stay queryable after they finish; once more than MaxFinishedJobs are finished, the oldest
+ * finished ones are dropped. Running jobs are never pruned. Game thread only.
+ */
+template <typename JobType>
+class TEpicUnrealMCPJobRegistry
+{
+public:
+    typedef bool (*FIsJobDone)(const JobType&);
+
+    /**
+     * @param InMaxFinishedJobs Finished jobs kept for status queries
+     * @param InIsJobDone Whether a job reached a terminal state (and may be pruned)
+     */
+    TEpicUnrealMCPJobRegistry(int32 InMaxFinishedJobs, FIsJobDone InIsJobDone)
+        : MaxFinishedJobs(InMaxFinishedJobs)
+        , IsJobDone(InIsJobDone)
+    {
+    }
+
+    /**
+     * Add a job under a new id
+     * @param OutJobId The new id
+     * @return The job; valid until the next Add
+     */
+    JobType& Add(FString& OutJobId)
+    {
+        OutJobId = FGuid::NewGuid().ToString(EGuidFormats::DigitsLower);
+        Order.Add(OutJobId);
+        return Jobs.Add(OutJobId);
+    }
+
+    JobType* Find(const FString& JobId)
+    {
+        return Jobs.Find(JobId);
+    }
+
+    const JobType* Find(const FString& JobId) const
+    {
+        return Jobs.Find(JobId);
+    }
+
+    JobType& FindChecked(const FString& JobId)
+    {
+        return Jobs.FindChecked(JobId);
+    }
+
+    /** All jobs, for iteration (do not add or prune while iterating) */
+    TMap<FString, JobType>& GetJobs()
+    {
+        return Jobs;
+    }
+
+    /** Drop the oldest finished jobs once more than MaxFinishedJobs are finished */
+    void PruneFinished()
+    {
+        int32 FinishedCount = 0;
+        for (const FString& JobId : Order)
+        {
+            const JobType* Job = Jobs.Find(JobId);
+            FinishedCount += (Job && IsJobDone(*Job)) ? 1 : 0;
+        }
+
+        for (int32 Index = 0; Index < Order.Num() && FinishedCount > MaxFinishedJobs;)
+        {
+            const JobType* Job = Jobs.Find(Order[Index]);
+            if (Job && !IsJobDone(*Job))
+            {
+                ++Index;
+                continue;
+            }
+            FinishedCount -= Job ? 1 : 0;
+            Jobs.Remove(Order[Index]);
+            Order.RemoveAt(Index);
+        }
+    }
+
+private:
+    TMap<FString, JobType> Jobs;
+
+    // Job ids in creation order, for pruning
+    TArray<FString> Order;
+
+    int32 MaxFinishedJobs;
+    FIsJobDone IsJobDone;
+};
@@ -38,6 +38,12 @@ private:
     // Assign a material to a landscape actor
     TSharedPtr<FJsonObject> HandleSetLandscapeMaterial(const TSharedPtr<FJsonObject>& Params);
 
-    // Recompile a material
+    // Start a material recompile and return a job id (optionally wait and save)
     TSharedPtr<FJsonObject> HandleCompileMaterial(const TSharedPtr<FJsonObject>& Params);
+
+    // Save one or more material packages
+    TSharedPtr<FJsonObject> HandleSaveMaterials(const TSharedPtr<FJsonObject>& Params);
+
+    // Build a whole expression graph (nodes, params, links, outputs) in one undo step and start one compile
+    TSharedPtr<FJsonObject> HandleBuildMaterialGraph(const TSharedPtr<FJsonObject>& Params);
 };
@@ -53,6 +53,18 @@ private:
     // Force-generate a PCG graph on an actor's PCGComponent
     TSharedPtr<FJsonObject> HandleGeneratePCG(const TSharedPtr<FJsonObject>& Params);
 
+    // Generate all PCG components matching actor / graph / bounds filters as one batch
+    TSharedPtr<FJsonObject> HandleGeneratePCGAll(const TSharedPtr<FJsonObject>& Params);
+
     // Read a property value from a PCG node's settings
     TSharedPtr<FJsonObject> HandleGetPCGNodeProperty(const TSharedPtr<FJsonObject>& Params);
+
+    // Get the status and statistics of a PCG generation job or batch
+    TSharedPtr<FJsonObject> HandleGetPCGJobStatus(const TSharedPtr<FJsonObject>& Params);
+
+    // Build a whole PCG graph (nodes, properties, edges) from one spec
+    TSharedPtr<FJsonObject> HandleBuildPCGGraph(const TSharedPtr<FJsonObject>& Params);
+
+    // Export a PCG component's generated points as a columnar binary blob
+    TSharedPtr<FJsonObject> HandleGetPCGOutput(const TSharedPtr<FJsonObject>& Params);
 };
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UMaterial;
+
+/**
+ * Job registry for material compilation.
+ *
+ * Recompiling a material translates it on the game thread and hands its shaders to the shader
+ * compiling manager, which finishes them over later editor ticks. Each compile request gets a
+ * job id; a core ticker watches the material resource and records compile time, errors and
+ * shader statistics when it finishes, so callers poll status instead of blocking the game thread.
+ */
+class UNREALMCP_API FMaterialCompileTracker
+{
+public:
+    /**
+     * Recompile a material and start tracking its shader compilation
+     * @param Material The material to compile
+     * @param MaterialPath Path reported in job status
+     * @return The job id
+     */
+    static FString StartCompile(UMaterial* Material, const FString& MaterialPath);
+
+    /**
+     * Block until a job's shaders are compiled (used when the caller asked to wait)
+     * @param JobId Id returned by StartCompile
+     */
+    static void FinishCompile(const FString& JobId);
+
+    /**
+     * Get the status of a compile job
+     * @param Params JSON parameters:
+     *   - job_id (string): Id returned by compile_material
+     * @return JSON with job_id, material_path, state, done, compile_time_ms, shader_jobs_remaining;
+     *         once done: errors and platforms (shader platform, instruction and sampler counts)
+     */
+    static TSharedPtr<FJsonObject> GetJobStatus(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Describe a job without the success wrapper
+     * @param JobId Id returned by StartCompile
+     * @return Status object, or nullptr if the job is unknown
+     */
+    static TSharedPtr<FJsonObject> DescribeJob(const FString& JobId);
+};
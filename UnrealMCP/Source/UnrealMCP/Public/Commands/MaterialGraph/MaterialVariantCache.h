@@ -0,0 +1,102 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UMaterialInterface;
+class UActorComponent;
+
+/** Parameter overrides that define one material variant */
+struct FMaterialVariantParams
+{
+    TMap<FName, FLinearColor> VectorValues;
+    TMap<FName, float> ScalarValues;
+    TMap<FName, FSoftObjectPath> TextureValues;
+
+    /**
+     * Parse {"Name": [r, g, b(, a)] | number | "/Game/Path/To/Texture", ...}
+     * @return False with OutError set if a value has an unsupported type
+     */
+    static bool FromJson(const TSharedPtr<FJsonObject>& Json, FMaterialVariantParams& Out, FString& OutError);
+
+    /** Canonical text (sorted names, quantized values), so equal overrides share a key */
+    FString GetCanonicalKey() const;
+};
+
+/** Where a variant lives */
+enum class EMaterialVariantMode : uint8
+{
+    /** Persistent UMaterialInstanceConstant asset, reused across editor sessions */
+    Constant,
+    /**
+     * UMaterialInstanceDynamic outered to the component it is applied to, so it is saved with that
+     * component instead of pointing into the transient package. Reused for repeat requests on the
+     * same component only; use Constant or SharedDynamic to share one instance across components.
+     */
+    Dynamic,
+    /**
+     * UMaterialInstanceDynamic shared by every component saved in the same package: outered to the level
+     * for level actors (to the actor itself when it is saved in its own package) and to the generated
+     * class for blueprint component templates. No asset is created.
+     */
+    SharedDynamic
+};
+
+/**
+ * Cache of material variants keyed by (parent material, parameter overrides).
+ *
+ * Instead of a fresh MID per colour change, every request for the same overrides on the same parent
+ * resolves to one instance. Constant variants are named from a hash of the key, so they are found
+ * again after an editor restart. Fewer unique materials also lets the renderer batch more draws.
+ */
+class UNREALMCP_API FMaterialVariantCache
+{
+public:
+    /** Folder for constant variants when the caller does not pass one */
+    static const TCHAR* DefaultAssetFolder;
+
+    /**
+     * Find or create the variant of Parent with the given overrides
+     * @param Parent Base material; if it is itself a variant, its parent is used instead
+     * @param Params Parameter overrides
+     * @param Mode Persistent constant instance, or dynamic instance per component or per package
+     * @param AssetFolder Content folder for constant variants
+     * @param DynamicOuter Owner of a dynamic variant, from GetDynamicOuter (required for the dynamic modes, ignored for Constant)
+     * @param bOutCreated Set when a new instance was created
+     * @param OutError Error message on failure
+     * @return The variant, or nullptr on failure. An existing constant asset whose parent or overrides
+     *         differ is repaired in place and left dirty.
+     */
+    static UMaterialInterface* GetOrCreate(UMaterialInterface* Parent, const FMaterialVariantParams& Params, EMaterialVariantMode Mode,
+        const FString& AssetFolder, UObject* DynamicOuter, bool& bOutCreated, FString& OutError);
+
+    /**
+     * Save a constant variant's package if it has unsaved changes (new or repaired)
+     * @return True if the package was saved
+     */
+    static bool SaveVariant(UMaterialInterface* Variant);
+
+    /** Parse "constant" / "dynamic" / "shared_dynamic" */
+    static bool ParseMode(const FString& ModeName, EMaterialVariantMode& OutMode);
+
+    /**
+     * Owner of the dynamic variant applied to Component in the given mode
+     * @return Component for Dynamic, the object saved in the component's package for SharedDynamic, nullptr for Constant
+     */
+    static UObject* GetDynamicOuter(UActorComponent* Component, EMaterialVariantMode Mode);
+
+    /**
+     * Apply one variant to many level actors in one call
+     * @param Params JSON parameters:
+     *   - parent_material (string): Base material path
+     *   - parameters (object): Overrides, {"Name": [r, g, b(, a)] | number | texture path}
+     *   - targets (array): Actor names/labels, or objects with actor_name, component_name, material_slot
+     *   - material_slot (int, optional): Slot for targets that do not set one (default: 0)
+     *   - mode (string, optional): "constant" (default), "dynamic" or "shared_dynamic"
+     *   - asset_folder (string, optional): Folder for constant variants
+     *   - save (bool, optional): Save the constant variant if it was created or repaired (default: true)
+     * @return JSON with variant_path (the last dynamic instance in dynamic mode), mode, created,
+     *         created_count, saved, applied_components, missing_actors
+     */
+    static TSharedPtr<FJsonObject> ApplyMaterialVariant(const TSharedPtr<FJsonObject>& Params);
+};
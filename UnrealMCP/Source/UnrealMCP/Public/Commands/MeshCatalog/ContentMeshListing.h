@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+struct FAssetData;
+
+/**
+ * Cached static mesh listings per content path.
+ *
+ * The first listing of a path queries the asset registry once; after that the listing is kept
+ * current from asset add, remove and rename events. Lowercase names are stored alongside a
+ * trigram index, so name filters intersect a few posting lists and verify the survivors instead
+ * of converting and scanning every asset name. Results are ordered by object path, so offsets
+ * page consistently and totals are exact.
+ */
+class UNREALMCP_API FContentMeshListing
+{
+public:
+    /**
+     * List static meshes under a content path
+     * @param Params JSON parameters:
+     *   - search_path (string, optional): Content path, searched recursively (default: "/Game/")
+     *   - name_filter (string, optional): Case-insensitive substring of the asset name
+     *   - max_results (int, optional): Page size (default: 100)
+     *   - offset (int, optional): Matches to skip (default: 0)
+     *   - refresh (bool, optional): Rebuild the listing for this path from the asset registry
+     * @return JSON with meshes (name, path, package), count, total_found (meshes under the path),
+     *         total_matches (after the name filter), offset, next_offset (-1 on the last page) and query_ms
+     */
+    static TSharedPtr<FJsonObject> ListMeshes(const TSharedPtr<FJsonObject>& Params);
+
+    /** Remove the asset registry hooks (module shutdown); the next listing registers them again */
+    static void UnregisterDelegates();
+
+private:
+    /** Hook asset registry events once, on first use */
+    static void EnsureDelegatesRegistered();
+
+    static void OnAssetAdded(const FAssetData& AssetData);
+    static void OnAssetRemoved(const FAssetData& AssetData);
+    static void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+};
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+struct FAssetData;
+
+/**
+ * Native index over a static mesh catalog.
+ *
+ * Rows are built from asset registry data (name, path and the ApproxSize tag, so no mesh is
+ * loaded) and overlaid with the curated catalog JSON (category, tags, measured size, sockets,
+ * semantics). Columns are kept in flat arrays with posting lists per name token, category, tag
+ * and socket type plus size-sorted row orders, so filters intersect short lists instead of
+ * scanning every entry. Each catalog is persisted as a binary sidecar under Saved/MCP/MeshCatalog,
+ * reconciled with the asset registry when loaded and kept current from asset add, remove, rename
+ * and update events.
+ */
+class UNREALMCP_API FMeshCatalogIndex
+{
+public:
+    /**
+     * Query a catalog
+     * @param Params JSON parameters:
+     *   - catalog (string): Catalog name, used for the sidecar file
+     *   - root_path (string, optional): Content path indexed from the asset registry (default: the overlay's base_path)
+     *   - overlay_file (string, optional): Absolute path of the curated catalog JSON
+     *   - query (string, optional): Case-insensitive substring
+     *   - text_fields (string, optional): "name" (default) or "all" (name, display_name, description, function)
+     *   - category (string, optional): Exact category
+     *   - tags (array, optional): Require all of these tags (catalog tags and style tags)
+     *   - socket_types (array, optional): Require all of these socket types
+     *   - min_size_cm, max_size_cm (array, optional): [x, y, z] size range; null components are ignored
+     *   - has_bounds (bool, optional): Only rows with a known size (other rows pass size filters)
+     *   - offset, limit (int, optional): Page of results (limit 0 = all, default: 0)
+     *   - rebuild (bool, optional): Discard the index and sidecar and rebuild
+     * @return JSON with meshes, result_count, total_matches, row_count and timings
+     */
+    static TSharedPtr<FJsonObject> QueryCatalog(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Category counts and index statistics
+     * @param Params JSON parameters: catalog, root_path, overlay_file, rebuild (see QueryCatalog)
+     * @return JSON with asset_pack, total_meshes, categories, descriptions, source, sidecar_path and timings
+     */
+    static TSharedPtr<FJsonObject> GetCatalogInfo(const TSharedPtr<FJsonObject>& Params);
+
+    /** Remove the asset registry hooks (module shutdown); the next query registers them again */
+    static void UnregisterDelegates();
+
+private:
+    /** Hook asset registry events once, on first use */
+    static void EnsureDelegatesRegistered();
+
+    static void OnAssetAdded(const FAssetData& AssetData);
+    static void OnAssetRemoved(const FAssetData& AssetData);
+    static void OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath);
+    static void OnAssetUpdated(const FAssetData& AssetData);
+};
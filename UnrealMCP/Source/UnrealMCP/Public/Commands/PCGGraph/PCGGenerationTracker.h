@@ -0,0 +1,89 @@
+// Tracks asynchronous PCG generation jobs started through the MCP bridge
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class UPCGComponent;
+
+/** How a generation request treats previously generated results */
+enum class EPCGGenerationRequestMode : uint8
+{
+    /** CleanupLocal, then force-generate: every managed resource is rebuilt */
+    Full,
+    /** Regenerate in place, reusing PCG's graph cache; skipped when no input changed */
+    Incremental
+};
+
+/**
+ * Job registry for PCG generation.
+ *
+ * PCGComponent::Generate only schedules work; the graph executes over later editor ticks.
+ * Each generation request gets a job id and is completed from the component's generated /
+ * cleaned / cancelled delegates, so callers can poll status instead of blocking the game thread
+ * (which would stall the very ticks that drive generation).
+ *
+ * Incremental requests remember a signature of each component's inputs (graph topology, node
+ * settings, user parameters, seed, transform) at its last completed generation and skip the
+ * request when nothing changed.
+ */
+class UNREALMCP_API FPCGGenerationTracker
+{
+public:
+    /**
+     * Schedule generation on a component and start tracking it
+     * @param Component The PCG component to generate
+     * @param ActorName Display name reported in job status
+     * @param Mode Full rebuild or incremental regeneration
+     * @return The job id
+     */
+    static FString StartGeneration(UPCGComponent* Component, const FString& ActorName, EPCGGenerationRequestMode Mode);
+
+    /**
+     * Read the optional 'mode' field ("full" or "incremental", default full)
+     * @return False with OutError set if the value is not recognized
+     */
+    static bool ParseMode(const TSharedPtr<FJsonObject>& Params, EPCGGenerationRequestMode& OutMode, FString& OutError);
+
+    /**
+     * Get the status of a generation job or batch
+     * @param Params JSON parameters:
+     *   - job_id (string): Id returned by generate_pcg, or
+     *   - batch_id (string): Id returned by generate_pcg_all
+     *   - include_jobs (bool, optional): Include per-component status for a batch (default: true)
+     * @return JSON with job_id, state, actor_name, wall_time_ms, point_count, instance_count, node_timings;
+     *         for a batch: progress, per-state counts, aggregate counts and a jobs array
+     */
+    static TSharedPtr<FJsonObject> GetJobStatus(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Describe a job without the success wrapper
+     * @param JobId Id returned by StartGeneration
+     * @return Status object, or nullptr if the job is unknown
+     */
+    static TSharedPtr<FJsonObject> DescribeJob(const FString& JobId);
+
+    /**
+     * Check whether a job has reached a terminal state
+     * @param JobId Id returned by StartGeneration
+     * @return True when the job is completed, cancelled, failed or unknown
+     */
+    static bool IsJobFinished(const FString& JobId);
+
+    /**
+     * Group already started jobs so their progress can be queried together
+     * @param JobIds Ids returned by StartGeneration
+     * @return The batch id
+     */
+    static FString RegisterBatch(const TArray<FString>& JobIds);
+
+    /**
+     * Describe a batch without the success wrapper
+     * @param BatchId Id returned by RegisterBatch
+     * @param bIncludeJobs Include each job's status (per-component timing and counts)
+     * @return Aggregate status (pruned counts jobs dropped from the history, whose outcome is unknown),
+     *         or nullptr if the batch is unknown
+     */
+    static TSharedPtr<FJsonObject> DescribeBatch(const FString& BatchId, bool bIncludeJobs = true);
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Builds a whole PCG graph (nodes, properties, edges) from one declarative spec.
+ *
+ * Equivalent to a sequence of add_pcg_node / set_pcg_node_property / connect_pcg_nodes calls,
+ * but the graph is loaded once, nodes are looked up through a name map instead of a scan,
+ * and editor notifications are held until the end so the graph is notified and dirtied once.
+ */
+class UNREALMCP_API FPCGGraphBuilder
+{
+public:
+    /**
+     * Build or extend a PCG graph from a spec
+     * @param Params JSON parameters:
+     *   - graph_path (string, optional): Existing graph to build into
+     *   - graph_name (string, optional): Create a new graph with this name when graph_path is not given
+     *   - path (string, optional): Content folder for a new graph (default: /Game/PCG)
+     *   - clear_existing (bool, optional): Remove all nodes except Input/Output first (default: false)
+     *   - nodes (array): Objects with:
+     *       - name (string): Spec-local name used by edges and returned in node_map
+     *       - node_type (string): Friendly name or exact class name of the settings
+     *       - pos_x, pos_y (int, optional): Graph editor position (default: laid out left to right)
+     *       - properties (object, optional): property_name (dot-notation allowed) -> value
+     *   - edges (array, optional): Objects with from, to (spec names, existing node ids, or
+     *     "Input" / "Output") and optional from_pin (default "Out") and to_pin (default "In")
+     * @return JSON with graph_path, node_map, nodes_created, edges_created, properties_set, errors;
+     *         success is false (with a first-error summary in error) if any element failed
+     */
+    static TSharedPtr<FJsonObject> BuildPCGGraph(const TSharedPtr<FJsonObject>& Params);
+};
@@ -24,7 +24,7 @@ public:
      * Read/inspect an existing PCG graph
      * @param Params JSON parameters:
      *   - graph_path (string): Full content path to the graph
-     * @return JSON with nodes, connections, parameters arrays
+     * @return JSON with nodes, connections, parameters arrays (parameters include their current default_value)
      */
     static TSharedPtr<FJsonObject> ReadPCGGraph(const TSharedPtr<FJsonObject>& Params);
 
@@ -3,6 +3,10 @@
 #include "CoreMinimal.h"
 #include "Dom/JsonObject.h"
 
+class UPCGGraph;
+class UPCGNode;
+class UPCGPin;
+
 /**
  * Handles connecting nodes in PCG graphs via pin edges.
  */
@@ -20,4 +24,26 @@ public:
      * @return JSON with from_node_id, to_node_id
      */
     static TSharedPtr<FJsonObject> ConnectNodes(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Find a pin by label (exact, then case-insensitive, then the only pin if there is one)
+     */
+    static UPCGPin* FindPinByLabel(UPCGNode* Node, const FString& PinLabel, bool bIsInput);
+
+    /**
+     * Create an edge between two nodes without notifying the editor or dirtying the package
+     * @param OutFromPin Resolved output pin (set on success)
+     * @param OutToPin Resolved input pin (set on success)
+     * @param OutError Error message if the pins could not be resolved or connected
+     * @return true if the edge was created
+     */
+    static bool ConnectPins(
+        UPCGGraph* Graph,
+        UPCGNode* FromNode,
+        const FString& FromPin,
+        UPCGNode* ToNode,
+        const FString& ToPin,
+        UPCGPin*& OutFromPin,
+        UPCGPin*& OutToPin,
+        FString& OutError);
 };
@@ -38,15 +38,20 @@ public:
      */
     static UPCGNode* FindNodeByName(class UPCGGraph* Graph, const FString& NodeName);
 
-private:
     /**
      * Resolve a friendly node type name to a UClass* for UPCGSettings subclass.
-     * Falls back to FindObject<UClass> for exact class names.
+     * Names match in any casing and ignoring separators ("static_mesh_spawner").
+     * Fully qualified class paths ("/Script/Module.ClassName") are also accepted.
      */
     static UClass* ResolveNodeType(const FString& NodeType);
 
     /**
-     * Build the friendly name -> UClass* registry on first use.
+     * Suggest registered node type names close to an unresolved one, best match first
      */
-    static const TMap<FString, UClass*>& GetNodeTypeRegistry();
+    static TArray<FString> SuggestNodeTypes(const FString& NodeType, int32 MaxSuggestions = 5);
+
+    /**
+     * Stop refreshing the node type registry on module loads (module shutdown)
+     */
+    static void UnregisterDelegates();
 };
@@ -32,6 +32,20 @@ public:
      */
     static TSharedPtr<FJsonObject> GetNodeProperty(const TSharedPtr<FJsonObject>& Params);
 
+    /**
+     * Set a property (plain name or dot-notation path) on a settings object without
+     * notifying the graph or dirtying the package. Used by batch graph construction.
+     * @return true if the property was found and set
+     */
+    static bool ApplySettingsProperty(
+        UObject* Settings,
+        const FString& PropertyName,
+        const TSharedPtr<FJsonValue>& JsonValue,
+        FString& OutPropertyType);
+
+    /** Remove the reload hook that flushes the reflection caches, and drop the caches (module shutdown) */
+    static void UnregisterDelegates();
+
 private:
     /**
      * Set a property value on a UObject using reflection
@@ -46,6 +60,7 @@ private:
     /**
      * Set a property value using dot-notation path traversal for nested structs.
      * E.g., "InputSource1.AttributeName" traverses into FPCGAttributePropertyInputSelector.
+     * Paths may nest to any depth; resolved property chains are cached per settings class.
      * @return true if the nested property was found and set
      */
     static bool SetPropertyValueByPath(
@@ -75,7 +90,10 @@ public:
      *   - entries (array): Array of objects with:
      *       - mesh_path (string): Content path to a static mesh asset
      *       - weight (int, optional): Selection weight (default: 1)
-     * @return JSON with node_id, entry_count
+     *   - preload (string, optional): How referenced meshes are loaded, all in one streamable request:
+     *       "wait" (default) blocks once for the whole set, "async" lets it finish in the background,
+     *       "none" only writes the soft paths. Hard mesh pointer fields always wait
+     * @return JSON with node_id, entry_count, preload, mesh_count, load_time_ms, missing_meshes
      */
     static TSharedPtr<FJsonObject> SetSpawnerEntries(const TSharedPtr<FJsonObject>& Params);
 };
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Exports a PCG component's generated point data as a columnar binary blob.
+ *
+ * Each requested column (position, rotation, ...) is written as one contiguous little-endian
+ * array, so a client can map millions of points straight into typed arrays instead of parsing
+ * per-point JSON. The blob is returned inline as base64 or written to a file under Saved/.
+ */
+class UNREALMCP_API FPCGOutputExporter
+{
+public:
+    /**
+     * Export the generated output points of an actor's PCG component
+     * @param Params JSON parameters:
+     *   - actor_name (string): Label or name of the actor with the PCGComponent
+     *   - columns (array, optional): Any of position, rotation, scale, density, seed, bounds_min,
+     *     bounds_max, color, steepness (default: position, rotation, scale, density, seed)
+     *   - attributes (array, optional): Numeric metadata attributes to export as extra columns
+     *   - pin (string, optional): Only export data from this output pin
+     *   - max_points (int, optional): Stop after this many points (default: 0 = all)
+     *   - output (string, optional): "auto" (default), "base64" or "file". Auto writes a file when
+     *     the blob is too large to inline
+     * @return JSON with point_count, columns (name, dtype, components, offset, byte_length),
+     *         segments (one per exported point data), and data_base64 or file_path
+     */
+    static TSharedPtr<FJsonObject> GetPCGOutput(const TSharedPtr<FJsonObject>& Params);
+};
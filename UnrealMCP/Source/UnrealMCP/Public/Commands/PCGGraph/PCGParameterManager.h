@@ -36,18 +36,40 @@ public:
      *   - graph_path (string): Content path to the PCG graph
      *   - actor_name (string, optional): Name of actor in the level
      *   - blueprint_name (string, optional): Name of Blueprint with PCGComponent
-     * @return JSON with graph_path
+     *   - mode (string, optional): "full" (default) or "incremental" regeneration for level actors
+     * @return JSON with graph_path (and job_id when assigned to a level actor)
      */
     static TSharedPtr<FJsonObject> AssignPCGGraph(const TSharedPtr<FJsonObject>& Params);
 
     /**
-     * Force-generate a PCG graph on an actor's PCGComponent
+     * Force-generate a PCG graph on an actor's PCGComponent. Returns immediately;
+     * poll FPCGGenerationTracker::GetJobStatus with the returned job_id for completion.
      * @param Params JSON parameters:
      *   - actor_name (string): Name of actor in the level with a PCGComponent
-     * @return JSON with success, actor_name
+     *   - mode (string, optional): "full" cleans up and rebuilds (default); "incremental" regenerates
+     *     in place using PCG's cache and skips components whose inputs did not change
+     *   - seed (int, optional): Set the component's seed before generating
+     *   - graph_path (string, optional): Fail unless the component runs this graph
+     *   - require_defaults (array of string, optional): Fail if the component overrides any of these user parameters
+     *   - validate_only (bool, optional): Run the checks above and return without generating
+     * @return JSON with success, actor_name, job_id, seed (and previous_seed when it changed);
+     *   validate_only returns actor_name, graph_path and seed instead
      */
     static TSharedPtr<FJsonObject> GeneratePCG(const TSharedPtr<FJsonObject>& Params);
 
+    /**
+     * Generate every PCG component in the level that matches the filters, as one batch.
+     * All components are scheduled together so the PCG scheduler can overlap their work.
+     * @param Params JSON parameters (all optional; no filter means every component):
+     *   - actor_filter (string): Substring, or wildcard pattern with * / ?, matched against actor label or name
+     *   - graph_filter (string): Substring of the assigned graph's path
+     *   - bounds_min, bounds_max ([x, y, z]): Only actors whose bounds intersect this box
+     *   - mode (string): "full" (default) or "incremental"
+     * @return JSON with batch_id, component_count, local_components_skipped (partition-local components,
+     *         generated by their original), jobs (job_id, actor_name, graph_path)
+     */
+    static TSharedPtr<FJsonObject> GeneratePCGAll(const TSharedPtr<FJsonObject>& Params);
+
 private:
     /**
      * Convert a param_type string to EPropertyBagPropertyType
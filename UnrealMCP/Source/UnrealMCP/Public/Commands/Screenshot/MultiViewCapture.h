@@ -0,0 +1,36 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+/**
+ * Offscreen multi-view capture.
+ *
+ * Renders several cameras around a target with transient scene capture components, so validation
+ * does not depend on the editor viewport being visible or on moving its camera between shots.
+ * All captures and their pixel reads are queued together and resolved with a single flush.
+ */
+class UNREALMCP_API FMultiViewCapture
+{
+public:
+    /**
+     * Capture orbit, top-down and custom views of a target
+     * @param Params JSON parameters:
+     *   - actor_names (array, optional): Frame these actors (default: the editor selection)
+     *   - center, extent (array, optional): Frame an explicit box instead of actors
+     *   - orbit_count (int, optional): Perspective views evenly spaced around the target (default: 4)
+     *   - orbit_pitch (float, optional): Orbit camera pitch in degrees (default: -30)
+     *   - orbit_yaw (float, optional): Yaw of the first orbit view (default: 45)
+     *   - include_top (bool, optional): Add a top-down orthographic view (default: true)
+     *   - views (array, optional): Custom views, {location, rotation | look_at, fov, orthographic, ortho_width, name}
+     *   - resolution (int, optional): Square size of each view in pixels (default: 512)
+     *   - fov (float, optional): Perspective field of view (default: 60)
+     *   - layout (string, optional): "contact_sheet" (default) or "array"
+     *   - filename (string, optional): Output path (array layout appends _<index>)
+     *   - max_dimension, format, quality, output: Same as take_screenshot
+     *   - change_detection, view_key, tile_size, change_threshold: Same as take_screenshot; the array
+     *     layout compares each view under "<view_key>/<view name>" (default view_key: capture_views)
+     * @return JSON with views (name, camera, cell), the encoded sheet or images, and capture_ms
+     */
+    static TSharedPtr<FJsonObject> CaptureViews(const TSharedPtr<FJsonObject>& Params);
+};
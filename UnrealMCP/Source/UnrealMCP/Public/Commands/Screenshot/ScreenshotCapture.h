@@ -0,0 +1,145 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonObject.h"
+
+class FViewport;
+
+/** Image codecs screenshots can be encoded with */
+enum class EScreenshotCodec : uint8
+{
+    Png,
+    Jpeg
+};
+
+/** How a frame is compared with the previous capture of the same view */
+enum class EScreenshotChangeMode : uint8
+{
+    Off,
+    /** Report the changed region, still return the full frame */
+    BoundingBox,
+    /** Return only the changed region */
+    Crop
+};
+
+/** Outcome of change detection */
+enum class EScreenshotChange : uint8
+{
+    NotChecked,
+    /** No earlier frame for this view (or its size changed) */
+    First,
+    Changed,
+    Unchanged
+};
+
+/** How a captured frame is scaled, encoded and returned */
+struct FScreenshotEncodeOptions
+{
+    /** Downscale so the longer side is at most this many pixels (0 = native size) */
+    int32 MaxDimension = 0;
+    EScreenshotCodec Codec = EScreenshotCodec::Png;
+    /** JPEG quality, 1-100 */
+    int32 Quality = 90;
+    bool bWriteFile = true;
+    bool bInline = false;
+
+    EScreenshotChangeMode ChangeMode = EScreenshotChangeMode::Off;
+    /** Frames are compared with the last frame delivered (encoded and written) under the same key */
+    FString ViewKey = TEXT("viewport");
+    /** Side of the comparison tiles in source pixels */
+    int32 TileSize = 32;
+    /** A tile changed when a mean channel value moved by more than this (0-255) */
+    float ChangeThreshold = 2.0f;
+    /** Forget the stored frame before comparing */
+    bool bResetBaseline = false;
+
+    /**
+     * Parse max_dimension, format ("png", "jpeg"/"jpg"; "webp" is rejected as unavailable),
+     * quality, output ("file", "base64", "both"), change_detection ("off", "bbox", "crop"),
+     * view_key, tile_size, change_threshold and reset_baseline
+     */
+    static bool FromJson(const TSharedPtr<FJsonObject>& Params, FScreenshotEncodeOptions& Out, FString& OutError);
+
+    /** File extension for the codec, without the dot */
+    const TCHAR* GetExtension() const;
+
+    /** MIME type for the codec */
+    const TCHAR* GetMimeType() const;
+};
+
+/** Output of encoding one frame */
+struct FScreenshotEncodeResult
+{
+    bool bSuccess = false;
+    FString Message;
+    FIntPoint SourceSize = FIntPoint::ZeroValue;
+    FIntPoint Size = FIntPoint::ZeroValue;
+    double EncodeMs = 0.0;
+    int64 EncodedBytes = 0;
+    FString Base64;
+
+    EScreenshotChange Change = EScreenshotChange::NotChecked;
+    /** Changed region in source pixels (whole frame when first) */
+    FIntRect ChangedRect;
+    int32 ChangedTiles = 0;
+    int32 TotalTiles = 0;
+};
+
+/**
+ * Job registry for asynchronous viewport screenshots.
+ *
+ * A synchronous capture flushes the rendering thread, stalls on ReadPixels and encodes the PNG on
+ * the game thread. Here the viewport render target is copied into a GPU readback on the rendering
+ * thread, a core ticker polls the readback without flushing, and pixel conversion, encoding and the
+ * file write run on the thread pool. Callers poll the job id for the result.
+ */
+class UNREALMCP_API FScreenshotCapture
+{
+public:
+    /**
+     * Queue a GPU readback of the viewport's last rendered frame
+     * @param Viewport Viewport to capture (must have a separate render target)
+     * @param Filename Absolute path of the image to write
+     * @param Options Scaling, codec and output options
+     * @param OutError Why the capture could not start (caller should fall back to a synchronous capture)
+     * @return The job id, or an empty string on failure
+     */
+    static FString StartCapture(FViewport* Viewport, const FString& Filename, const FScreenshotEncodeOptions& Options, FString& OutError);
+
+    /**
+     * Compare with the previous frame of the view, then crop, downscale, encode and optionally
+     * write it. Unchanged frames are not encoded or written. Safe on worker threads once the
+     * ImageWrapper module is loaded (StartCapture and LoadEncoder do that on the game thread).
+     * @param Pixels Opaque BGRA8 pixels, consumed
+     * @param SourceSize Pixel dimensions
+     * @param Options Scaling, codec, output and change detection options
+     * @param Filename Path to write when Options.bWriteFile
+     */
+    static FScreenshotEncodeResult EncodeFrame(TArray<FColor>&& Pixels, const FIntPoint& SourceSize, const FScreenshotEncodeOptions& Options, const FString& Filename);
+
+    /** Load the image encoders (game thread) */
+    static void LoadEncoder();
+
+    /** Add size, codec, change, file and inline data fields for an encode result */
+    static void AddEncodeResultFields(const FScreenshotEncodeResult& Result, const FScreenshotEncodeOptions& Options, const FString& Filename,
+        const TSharedPtr<FJsonObject>& OutJson);
+
+    /**
+     * Get the status of a capture job
+     * @param Params JSON parameters:
+     *   - job_id (string): Id returned by take_screenshot with async=true
+     * @return JSON with job_id, state (reading_back, encoding, completed, failed), done, width, height,
+     *         readback_ms, encode_ms, total_ms; once completed: format, mime_type, encoded_bytes,
+     *         source_width, source_height, file_path (file output) and data_base64 (inline output).
+     *         data_base64 is returned by the first query after completion only; later queries set
+     *         data_base64_delivered instead
+     */
+    static TSharedPtr<FJsonObject> GetJobStatus(const TSharedPtr<FJsonObject>& Params);
+
+    /**
+     * Describe a job without the success wrapper
+     * @param JobId Id returned by StartCapture
+     * @return Status object, or nullptr if the job is unknown
+     */
+    static TSharedPtr<FJsonObject> DescribeJob(const FString& JobId);
+};
@@ -17,7 +17,9 @@ public class UnrealMCP : ModuleRules
 				System.IO.Path.Combine(ModuleDirectory, "Public/Commands/BlueprintGraph"),
 				System.IO.Path.Combine(ModuleDirectory, "Public/Commands/BlueprintGraph/Nodes"),
 				System.IO.Path.Combine(ModuleDirectory, "Public/Commands/PCGGraph"),
-				System.IO.Path.Combine(ModuleDirectory, "Public/Commands/MaterialGraph")
+				System.IO.Path.Combine(ModuleDirectory, "Public/Commands/MaterialGraph"),
+				System.IO.Path.Combine(ModuleDirectory, "Public/Commands/Screenshot"),
+				System.IO.Path.Combine(ModuleDirectory, "Public/Commands/MeshCatalog")
 			}
 		);
 
@@ -28,7 +30,9 @@ public class UnrealMCP : ModuleRules
 				System.IO.Path.Combine(ModuleDirectory, "Private/Commands/BlueprintGraph"),
 				System.IO.Path.Combine(ModuleDirectory, "Private/Commands/BlueprintGraph/Nodes"),
 				System.IO.Path.Combine(ModuleDirectory, "Private/Commands/PCGGraph"),
-				System.IO.Path.Combine(ModuleDirectory, "Private/Commands/MaterialGraph")
+				System.IO.Path.Combine(ModuleDirectory, "Private/Commands/MaterialGraph"),
+				System.IO.Path.Combine(ModuleDirectory, "Private/Commands/Screenshot"),
+				System.IO.Path.Combine(ModuleDirectory, "Private/Commands/MeshCatalog")
 			}
 		);
 
@@ -47,6 +51,7 @@ public class UnrealMCP : ModuleRules
 				"DeveloperSettings",
 				"PhysicsCore",
 				"RenderCore",         // For FlushRenderingCommands (screenshot)
+				"RHI",                // For FRHIGPUTextureReadback (async screenshot)
 				"UnrealEd",           // For Blueprint editing
 				"BlueprintGraph",     // For K2Node classes (F15-F22)
 				"KismetCompiler",     // For Blueprint compilation (F15-F22)
@@ -66,7 +71,8 @@ public class UnrealMCP : ModuleRules
 				"SlateCore",
 				"Kismet",
 				"Projects",
-				"AssetRegistry"
+				"AssetRegistry",
+				"ImageWrapper"        // For encoding screenshots off the game thread
 			}
 		);
 